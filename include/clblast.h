@@ -36,6 +36,8 @@ enum class StatusCode {
   kSuccess                   =   0, // CL_SUCCESS
   kTempBufferAllocFailure    =  -4, // CL_MEM_OBJECT_ALLOCATION_FAILURE
   kBuildProgramFailure       = -11, // CL_BUILD_PROGRAM_FAILURE: OpenCL compilation error
+  kDevicePartitionFailed     = -18, // CL_DEVICE_PARTITION_FAILED: Cannot create sub-devices
+  kInvalidValue              = -30, // CL_INVALID_VALUE: e.g. an output array which is too small
   kInvalidBinary             = -42, // CL_INVALID_BINARY
   kInvalidKernel             = -48, // CL_INVALID_KERNEL
   kInvalidLocalNumDimensions = -53, // CL_INVALID_WORK_DIMENSION: Too many thread dimensions
@@ -68,6 +70,9 @@ enum class StatusCode {
   kInvalidLocalMemUsage      = -2046, // Not enough local memory available on this device
   kNoHalfPrecision           = -2045, // Half precision (16-bits) not supported by the device
   kNoDoublePrecision         = -2044, // Double precision (64-bits) not supported by the device
+  kInvalidEpilogue           = -2043, // Epilogue vector is not a valid or large enough buffer
+  kInvalidVectorScalar       = -2042, // Vector scalar is not a valid OpenCL buffer
+  kInsufficientMemoryScalar  = -2041, // Vector scalar's OpenCL buffer is too small
 };
 
 // Matrix layout and transpose types
@@ -77,24 +82,183 @@ enum class Side { kLeft, kRight };
 enum class Triangle { kUpper, kLower };
 enum class Diagonal { kUnit, kNonUnit };
 
-// Precision scoped enum (values in bits)
+// Precision scoped enum (values in bits). The half-precision routines take their scalars as the
+// 16-bit 'cl_half' data-type, see clblast_half.h for conversions from and to 'float'.
 enum class Precision { kHalf = 16, kSingle = 32, kDouble = 64,
                        kComplexSingle = 3232, kComplexDouble = 6464 };
 
+// Element-wise operations on the result of GemmEpilogue (see below), applied in the order: scale,
+// bias, activation, and clamp. The scale and bias are vectors holding either one value per row (M)
+// or one value per column (N) of matrix C.
+enum class EpilogueVector { kNone, kPerRow, kPerColumn };
+enum class Activation { kNone, kReLU, kGELU };
+struct Epilogue {
+  EpilogueVector scale = EpilogueVector::kNone;
+  cl_mem scale_buffer = nullptr;
+  size_t scale_offset = 0;
+  EpilogueVector bias = EpilogueVector::kNone;
+  cl_mem bias_buffer = nullptr;
+  size_t bias_offset = 0;
+  Activation activation = Activation::kNone;
+  bool clamp = false;
+  double clamp_min = 0.0;
+  double clamp_max = 0.0;
+};
+
 // =================================================================================================
 // BLAS level-1 (vector-vector) routines
 
-// Templated-precision vector-times-constant plus vector: SAXPY/DAXPY/CAXPY/ZAXPY
+// Templated-precision generation of a plane rotation: SROTG/DROTG. The scalars are stored in
+// device memory: on output, 'a' holds r, 'b' holds z, and 'c' and 's' hold the rotation.
+template <typename T>
+StatusCode Rotg(cl_mem a_buffer, const size_t a_offset,
+                cl_mem b_buffer, const size_t b_offset,
+                cl_mem c_buffer, const size_t c_offset,
+                cl_mem s_buffer, const size_t s_offset,
+                cl_command_queue* queue, cl_event* event);
+
+// Templated-precision generation of a modified plane rotation: SROTMG/DROTMG. The scalars and the
+// 5-element parameter array are stored in device memory.
+template <typename T>
+StatusCode Rotmg(cl_mem d1_buffer, const size_t d1_offset,
+                 cl_mem d2_buffer, const size_t d2_offset,
+                 cl_mem x1_buffer, const size_t x1_offset,
+                 const cl_mem y1_buffer, const size_t y1_offset,
+                 cl_mem param_buffer, const size_t param_offset,
+                 cl_command_queue* queue, cl_event* event);
+
+// Templated-precision application of a plane rotation: SROT/DROT. The cosine and sine are read
+// from device memory, such that they can be the output of Rotg.
+template <typename T>
+StatusCode Rot(const size_t n,
+               cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+               cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+               const cl_mem c_buffer, const size_t c_offset,
+               const cl_mem s_buffer, const size_t s_offset,
+               cl_command_queue* queue, cl_event* event);
+
+// Templated-precision application of a modified plane rotation: SROTM/DROTM. The 5-element
+// parameter array is read from device memory, such that it can be the output of Rotmg.
+template <typename T>
+StatusCode Rotm(const size_t n,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                const cl_mem param_buffer, const size_t param_offset,
+                cl_command_queue* queue, cl_event* event);
+
+// Templated-precision swap of two vectors: SSWAP/DSWAP/CSWAP/ZSWAP
+template <typename T>
+StatusCode Swap(const size_t n,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_command_queue* queue, cl_event* event);
+
+// Templated-precision vector scaling: SSCAL/DSCAL/CSCAL/ZSCAL
+template <typename T>
+StatusCode Scal(const size_t n, const T alpha,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event);
+
+// Templated-precision vector copy: SCOPY/DCOPY/CCOPY/ZCOPY
+template <typename T>
+StatusCode Copy(const size_t n,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_command_queue* queue, cl_event* event);
+
+// Templated-precision vector-times-constant plus vector: HAXPY/SAXPY/DAXPY/CAXPY/ZAXPY
 template <typename T>
 StatusCode Axpy(const size_t n, const T alpha,
                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event);
 
+// As AXPY above, but with the work spread over multiple devices (see GemmMultiDevice below)
+template <typename T>
+StatusCode AxpyMultiDevice(const size_t n, const T alpha,
+                           const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                           cl_command_queue* queues, const size_t num_queues, cl_event* event);
+
+// Templated-precision dot-product of two vectors: SDOT/DDOT. The result is stored in
+// element 'dot_offset' of the device buffer 'dot_buffer'.
+template <typename T>
+StatusCode Dot(const size_t n,
+               cl_mem dot_buffer, const size_t dot_offset,
+               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+               const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+               cl_command_queue* queue, cl_event* event);
+
+// Templated-precision dot-product of two complex vectors: CDOTU/ZDOTU
+template <typename T>
+StatusCode Dotu(const size_t n,
+                cl_mem dot_buffer, const size_t dot_offset,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_command_queue* queue, cl_event* event);
+
+// Templated-precision dot-product of two complex vectors, the first conjugated: CDOTC/ZDOTC
+template <typename T>
+StatusCode Dotc(const size_t n,
+                cl_mem dot_buffer, const size_t dot_offset,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_command_queue* queue, cl_event* event);
+
+// Dot-product of two single-precision vectors plus the scalar 'sb', accumulated in extended
+// precision: SDSDOT. The result is stored as a float, as for Dot.
+template <typename T>
+StatusCode Sdsdot(const size_t n, const T sb,
+                  cl_mem dot_buffer, const size_t dot_offset,
+                  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                  const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                  cl_command_queue* queue, cl_event* event);
+
+// Dot-product of two single-precision vectors, accumulated in extended precision: DSDOT. The
+// template argument is the type of the result, which is stored as a double in 'dot_buffer'.
+template <typename T>
+StatusCode Dsdot(const size_t n,
+                 cl_mem dot_buffer, const size_t dot_offset,
+                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                 const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                 cl_command_queue* queue, cl_event* event);
+
+// Templated-precision Euclidean norm of a vector: SNRM2/DNRM2/ScNRM2/DzNRM2. For complex
+// data-types, the result is stored in the real part of element 'nrm2_offset' of 'nrm2_buffer'.
+template <typename T>
+StatusCode Nrm2(const size_t n,
+                cl_mem nrm2_buffer, const size_t nrm2_offset,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event);
+
+// Templated-precision sum of absolute values: SASUM/DASUM/ScASUM/DzASUM. For complex data-
+// types, the result is stored in the real part of element 'asum_offset' of 'asum_buffer'.
+template <typename T>
+StatusCode Asum(const size_t n,
+                cl_mem asum_buffer, const size_t asum_offset,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event);
+
+// Templated-precision index of the maximum absolute value: iSAMAX/iDAMAX/iCAMAX/iZAMAX. The
+// zero-based index is stored as an unsigned integer in element 'imax_offset' of 'imax_buffer'.
+template <typename T>
+StatusCode Amax(const size_t n,
+                cl_mem imax_buffer, const size_t imax_offset,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event);
+
+// Templated-precision index of the minimum absolute value: iSAMIN/iDAMIN/iCAMIN/iZAMIN (non-BLAS
+// extension). The zero-based index is stored as an unsigned integer, as for Amax.
+template <typename T>
+StatusCode Amin(const size_t n,
+                cl_mem imin_buffer, const size_t imin_offset,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event);
+
 // =================================================================================================
 // BLAS level-2 (matrix-vector) routines
 
-// Templated-precision generalized matrix-vector multiplication: SGEMV/DGEMV/CGEMV/ZGEMV
+// Templated-precision generalized matrix-vector multiplication: HGEMV/SGEMV/DGEMV/CGEMV/ZGEMV
 template <typename T>
 StatusCode Gemv(const Layout layout, const Transpose a_transpose,
                 const size_t m, const size_t n,
@@ -105,10 +269,246 @@ StatusCode Gemv(const Layout layout, const Transpose a_transpose,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event);
 
+// Templated-precision general banded matrix-vector multiplication: SGBMV/DGBMV/CGBMV/ZGBMV. Matrix
+// A is stored in band format with 'kl' sub-diagonals and 'ku' super-diagonals.
+template <typename T>
+StatusCode Gbmv(const Layout layout, const Transpose a_transpose,
+                const size_t m, const size_t n, const size_t kl, const size_t ku,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                const T beta,
+                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_command_queue* queue, cl_event* event);
+
+// Templated-precision symmetric matrix-vector multiplication: SSYMV/DSYMV. Only the given triangle
+// of A is read.
+template <typename T>
+StatusCode Symv(const Layout layout, const Triangle triangle,
+                const size_t n,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                const T beta,
+                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_command_queue* queue, cl_event* event);
+
+// Templated-precision Hermitian matrix-vector multiplication: CHEMV/ZHEMV. Only the given triangle
+// of A is read and the imaginary parts of its diagonal are assumed to be zero.
+template <typename T>
+StatusCode Hemv(const Layout layout, const Triangle triangle,
+                const size_t n,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                const T beta,
+                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_command_queue* queue, cl_event* event);
+
+// Templated-precision symmetric banded matrix-vector multiplication: SSBMV/DSBMV. Only the given
+// triangle of A is read, stored in band format with 'k' off-diagonals.
+template <typename T>
+StatusCode Sbmv(const Layout layout, const Triangle triangle,
+                const size_t n, const size_t k,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                const T beta,
+                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_command_queue* queue, cl_event* event);
+
+// Templated-precision Hermitian banded matrix-vector multiplication: CHBMV/ZHBMV. Only the given
+// triangle of A is read, stored in band format with 'k' off-diagonals.
+template <typename T>
+StatusCode Hbmv(const Layout layout, const Triangle triangle,
+                const size_t n, const size_t k,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                const T beta,
+                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_command_queue* queue, cl_event* event);
+
+// Templated-precision symmetric packed matrix-vector multiplication: SSPMV/DSPMV. Only the given
+// triangle of A is read, stored in packed format.
+template <typename T>
+StatusCode Spmv(const Layout layout, const Triangle triangle,
+                const size_t n,
+                const T alpha,
+                const cl_mem ap_buffer, const size_t ap_offset,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                const T beta,
+                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_command_queue* queue, cl_event* event);
+
+// Templated-precision Hermitian packed matrix-vector multiplication: CHPMV/ZHPMV. Only the given
+// triangle of A is read, stored in packed format.
+template <typename T>
+StatusCode Hpmv(const Layout layout, const Triangle triangle,
+                const size_t n,
+                const T alpha,
+                const cl_mem ap_buffer, const size_t ap_offset,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                const T beta,
+                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_command_queue* queue, cl_event* event);
+
+// Templated-precision triangular matrix-vector multiplication: STRMV/DTRMV/CTRMV/ZTRMV. Vector X
+// is overwritten by op(A) * X.
+template <typename T>
+StatusCode Trmv(const Layout layout, const Triangle triangle,
+                const Transpose a_transpose, const Diagonal diagonal,
+                const size_t n,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event);
+
+// Templated-precision triangular banded matrix-vector multiplication: STBMV/DTBMV/CTBMV/ZTBMV.
+// Matrix A is stored in band format with 'k' off-diagonals. Vector X is overwritten by op(A) * X.
+template <typename T>
+StatusCode Tbmv(const Layout layout, const Triangle triangle,
+                const Transpose a_transpose, const Diagonal diagonal,
+                const size_t n, const size_t k,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event);
+
+// Templated-precision triangular packed matrix-vector multiplication: STPMV/DTPMV/CTPMV/ZTPMV.
+// Matrix A is stored in packed format. Vector X is overwritten by op(A) * X.
+template <typename T>
+StatusCode Tpmv(const Layout layout, const Triangle triangle,
+                const Transpose a_transpose, const Diagonal diagonal,
+                const size_t n,
+                const cl_mem ap_buffer, const size_t ap_offset,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event);
+
+// Templated-precision triangular solver: STRSV/DTRSV/CTRSV/ZTRSV. Vector X holds the right-hand
+// side on input and is overwritten by the solution of op(A) * X = B.
+template <typename T>
+StatusCode Trsv(const Layout layout, const Triangle triangle,
+                const Transpose a_transpose, const Diagonal diagonal,
+                const size_t n,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event);
+
+// Templated-precision triangular banded solver: STBSV/DTBSV/CTBSV/ZTBSV. Matrix A is stored in band
+// format with 'k' off-diagonals. Vector X is overwritten by the solution of op(A) * X = B.
+template <typename T>
+StatusCode Tbsv(const Layout layout, const Triangle triangle,
+                const Transpose a_transpose, const Diagonal diagonal,
+                const size_t n, const size_t k,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event);
+
+// Templated-precision triangular packed solver: STPSV/DTPSV/CTPSV/ZTPSV. Matrix A is stored in
+// packed format. Vector X is overwritten by the solution of op(A) * X = B.
+template <typename T>
+StatusCode Tpsv(const Layout layout, const Triangle triangle,
+                const Transpose a_transpose, const Diagonal diagonal,
+                const size_t n,
+                const cl_mem ap_buffer, const size_t ap_offset,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event);
+
+// Templated-precision rank-1 matrix update: SGER/DGER
+template <typename T>
+StatusCode Ger(const Layout layout,
+               const size_t m, const size_t n,
+               const T alpha,
+               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+               const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+               cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+               cl_command_queue* queue, cl_event* event);
+
+// Templated-precision rank-1 complex matrix update: CGERU/ZGERU
+template <typename T>
+StatusCode Geru(const Layout layout,
+                const size_t m, const size_t n,
+                const T alpha,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_command_queue* queue, cl_event* event);
+
+// Templated-precision rank-1 complex conjugated matrix update: CGERC/ZGERC
+template <typename T>
+StatusCode Gerc(const Layout layout,
+                const size_t m, const size_t n,
+                const T alpha,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_command_queue* queue, cl_event* event);
+
+// Templated-precision rank-1 update of a symmetric matrix: SSYR/DSYR. Only the given triangle of
+// A is updated.
+template <typename T>
+StatusCode Syr(const Layout layout, const Triangle triangle,
+               const size_t n,
+               const T alpha,
+               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+               cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+               cl_command_queue* queue, cl_event* event);
+
+// Templated-precision rank-1 update of a Hermitian matrix: CHER/ZHER. Only the given triangle of A
+// is updated and the imaginary parts of its diagonal are set to zero.
+template <typename T>
+StatusCode Her(const Layout layout, const Triangle triangle,
+               const size_t n,
+               const T alpha,
+               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+               cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+               cl_command_queue* queue, cl_event* event);
+
+// Templated-precision rank-1 update of a symmetric packed matrix: SSPR/DSPR. Only the given
+// triangle of A is updated.
+template <typename T>
+StatusCode Spr(const Layout layout, const Triangle triangle,
+               const size_t n,
+               const T alpha,
+               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+               cl_mem ap_buffer, const size_t ap_offset,
+               cl_command_queue* queue, cl_event* event);
+
+// Templated-precision rank-1 update of a Hermitian packed matrix: CHPR/ZHPR. Only the given
+// triangle of A is updated and the imaginary parts of its diagonal are set to zero.
+template <typename T>
+StatusCode Hpr(const Layout layout, const Triangle triangle,
+               const size_t n,
+               const T alpha,
+               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+               cl_mem ap_buffer, const size_t ap_offset,
+               cl_command_queue* queue, cl_event* event);
+
+// Templated-precision rank-2 update of a symmetric matrix: SSYR2/DSYR2. Only the given triangle of
+// A is updated.
+template <typename T>
+StatusCode Syr2(const Layout layout, const Triangle triangle,
+                const size_t n,
+                const T alpha,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_command_queue* queue, cl_event* event);
+
+// Templated-precision rank-2 update of a Hermitian matrix: CHER2/ZHER2. Only the given triangle of
+// A is updated and the imaginary parts of its diagonal are set to zero.
+template <typename T>
+StatusCode Her2(const Layout layout, const Triangle triangle,
+                const size_t n,
+                const T alpha,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_command_queue* queue, cl_event* event);
+
 // =================================================================================================
 // BLAS level-3 (matrix-matrix) routines
 
-// Templated-precision generalized matrix-matrix multiplication: SGEMM/DGEMM/CGEMM/ZGEMM
+// Templated-precision generalized matrix-matrix multiplication: HGEMM/SGEMM/DGEMM/CGEMM/ZGEMM
 template <typename T>
 StatusCode Gemm(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
                 const size_t m, const size_t n, const size_t k,
@@ -119,6 +519,44 @@ StatusCode Gemm(const Layout layout, const Transpose a_transpose, const Transpos
                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
                 cl_command_queue* queue, cl_event* event);
 
+// As GEMM above, but with the work spread over multiple devices. The devices' queues are passed in
+// as an array and have to share a single OpenCL context (otherwise 'kNotImplemented' is returned).
+// The event is set to a single event signalling completion of the work on all devices.
+template <typename T>
+StatusCode GemmMultiDevice(const Layout layout, const Transpose a_transpose,
+                           const Transpose b_transpose,
+                           const size_t m, const size_t n, const size_t k, const T alpha,
+                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                           const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                           const T beta,
+                           cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                           cl_command_queue* queues, const size_t num_queues, cl_event* event);
+
+// As GEMM above, but with an epilogue applied to each element of C before it is stored, avoiding
+// separate passes over C (e.g. for a bias and an activation function). Real data-types only.
+template <typename T>
+StatusCode GemmEpilogue(const Layout layout, const Transpose a_transpose,
+                        const Transpose b_transpose,
+                        const size_t m, const size_t n, const size_t k, const T alpha,
+                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                        const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                        const T beta,
+                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                        const Epilogue &epilogue,
+                        cl_command_queue* queue, cl_event* event);
+
+// As GEMM above, but with the matrices in host memory. On devices sharing their memory with the
+// host (CPUs and integrated GPUs) the host memory is used directly without any copies. For best
+// results, allocate the matrices aligned to a page (4096 bytes) with a size multiple of 64 bytes.
+// Without a command-queue (a null pointer) the multiplication is computed on the host.
+template <typename T>
+StatusCode GemmHost(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                    const size_t m, const size_t n, const size_t k, const T alpha,
+                    const T* a, const size_t a_ld,
+                    const T* b, const size_t b_ld, const T beta,
+                    T* c, const size_t c_ld,
+                    cl_command_queue* queue, cl_event* event);
+
 // Templated-precision symmetric matrix-matrix multiplication: SSYMM/DSYMM/CSYMM/ZSYMM
 template <typename T>
 StatusCode Symm(const Layout layout, const Side side, const Triangle triangle,
@@ -194,7 +632,6 @@ StatusCode Trmm(const Layout layout, const Side side, const Triangle triangle,
                 cl_command_queue* queue, cl_event* event);
 
 // Templated-precision matrix equation solver: STRSM/DTRSM/CTRSM/ZTRSM
-/*
 template <typename T>
 StatusCode Trsm(const Layout layout, const Side side, const Triangle triangle,
                 const Transpose a_transpose, const Diagonal diagonal,
@@ -203,7 +640,20 @@ StatusCode Trsm(const Layout layout, const Side side, const Triangle triangle,
                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                 cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
                 cl_command_queue* queue, cl_event* event);
-*/
+
+// =================================================================================================
+// Device partitioning
+
+// Partitions a device (e.g. a multi-socket CPU) into sub-devices, one per NUMA node. If that is not
+// supported, the next partitionable affinity domain is used instead. On input, 'num_sub_devices'
+// holds the number of entries of the 'sub_devices' array, on output the number of sub-devices. If
+// the array is too small, no sub-devices are returned and the status is kInvalidValue. If
+// 'sub_devices' is a null-pointer, only the number of sub-devices is returned (as for the OpenCL
+// clCreateSubDevices function). The resulting sub-devices can be used to create a single context
+// and a queue per sub-device for the multi-device routines above. They have to be released by the
+// caller using clReleaseDevice.
+StatusCode PartitionDevice(const cl_device_id device,
+                           cl_device_id* sub_devices, size_t* num_sub_devices);
 
 // =================================================================================================
 } // namespace clblast
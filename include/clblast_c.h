@@ -28,6 +28,12 @@
 // Include CLBlast header
 #include <clblast.h>
 
+// Include the conversions from and to the half-precision data-type 'cl_half'
+#include <clblast_half.h>
+
+// Include the complex data-types of the C++ routines
+#include <complex>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -48,6 +54,8 @@ typedef enum StatusCode_e {
   kSuccess                   =   0, // CL_SUCCESS
   kTempBufferAllocFailure    =  -4, // CL_MEM_OBJECT_ALLOCATION_FAILURE
   kBuildProgramFailure       = -11, // CL_BUILD_PROGRAM_FAILURE: OpenCL compilation error
+  kDevicePartitionFailed     = -18, // CL_DEVICE_PARTITION_FAILED: Cannot create sub-devices
+  kInvalidValue              = -30, // CL_INVALID_VALUE: e.g. an output array which is too small
   kInvalidBinary             = -42, // CL_INVALID_BINARY
   kInvalidKernel             = -48, // CL_INVALID_KERNEL
   kInvalidLocalNumDimensions = -53, // CL_INVALID_WORK_DIMENSION: Too many thread dimensions
@@ -80,6 +88,9 @@ typedef enum StatusCode_e {
   kInvalidLocalMemUsage      = -2046, // Not enough local memory available on this device
   kNoHalfPrecision           = -2045, // Half precision (16-bits) not supported by the device
   kNoDoublePrecision         = -2044, // Double precision (64-bits) not supported by the device
+  kInvalidEpilogue           = -2043, // Epilogue vector is not a valid or large enough buffer
+  kInvalidVectorScalar       = -2042, // Vector scalar is not a valid OpenCL buffer
+  kInsufficientMemoryScalar  = -2041, // Vector scalar's OpenCL buffer is too small
 } StatusCode;
 
 // Matrix layout and transpose types
@@ -112,6 +123,8 @@ static inline StatusCode convert_status(clblast::StatusCode status) {
   case (clblast::StatusCode::kSuccess) : return kSuccess; break; 
   case (clblast::StatusCode::kTempBufferAllocFailure) : return kTempBufferAllocFailure; break; 
   case (clblast::StatusCode::kBuildProgramFailure) : return kBuildProgramFailure; break; 
+  case (clblast::StatusCode::kDevicePartitionFailed) : return kDevicePartitionFailed; break; 
+  case (clblast::StatusCode::kInvalidValue) : return kInvalidValue; break; 
   case (clblast::StatusCode::kInvalidBinary) : return kInvalidBinary; break; 
   case (clblast::StatusCode::kInvalidKernel) : return kInvalidKernel; break; 
   case (clblast::StatusCode::kInvalidLocalNumDimensions) : return kInvalidLocalNumDimensions; break; 
@@ -140,6 +153,9 @@ static inline StatusCode convert_status(clblast::StatusCode status) {
   case (clblast::StatusCode::kInvalidLocalMemUsage) : return kInvalidLocalMemUsage; break; 
   case (clblast::StatusCode::kNoHalfPrecision) : return kNoHalfPrecision; break; 
   case (clblast::StatusCode::kNoDoublePrecision) : return kNoDoublePrecision; break; 
+  case (clblast::StatusCode::kInvalidEpilogue) : return kInvalidEpilogue; break; 
+  case (clblast::StatusCode::kInvalidVectorScalar) : return kInvalidVectorScalar; break; 
+  case (clblast::StatusCode::kInsufficientMemoryScalar) : return kInsufficientMemoryScalar; break; 
   default : return kNotImplemented; break;
   }
 }
@@ -163,6 +179,21 @@ static inline StatusCode convert_status(clblast::StatusCode status) {
 #define CONVERT_SIDE(side) \
   (side == kLeft ? clblast::Side::kLeft : clblast::Side::kRight)
 
+// The complex routines of the C++ backend are instantiated for std::complex rather than for the
+// vector types of this header: the scalars are converted and the template argument follows them
+extern "C++" {
+  static inline std::complex<float> convert_scalar(const float2 value) {
+    return std::complex<float>{value[0], value[1]};
+  }
+  static inline std::complex<double> convert_scalar(const double2 value) {
+    return std::complex<double>{value[0], value[1]};
+  }
+  template <typename T> static inline T convert_scalar(const T value) { return value; }
+}
+
+#define CONVERT_TYPE(T) \
+  decltype(convert_scalar(T{}))
+
 // =================================================================================================
 // Utility macros for function declaration
 //                             Example :  StatusCode  clblastSgemm     (...)    
@@ -181,6 +212,151 @@ static inline StatusCode convert_status(clblast::StatusCode status) {
 // =================================================================================================
 // BLAS level-1 (vector-vector) routines
 
+// ROTG
+#define ROTG_SIGNATURE(T)                                                         \
+  (cl_mem a_buffer, const size_t a_offset,                                        \
+  cl_mem b_buffer, const size_t b_offset,                                         \
+  cl_mem c_buffer, const size_t c_offset,                                         \
+  cl_mem s_buffer, const size_t s_offset,                                         \
+  cl_command_queue* queue, cl_event* event)
+
+#define ROTG_RETURN(T)                                               \
+  return convert_status(clblast::Rotg<CONVERT_TYPE(T)>(              \
+          a_buffer, a_offset,                                        \
+          b_buffer, b_offset,                                        \
+          c_buffer, c_offset,                                        \
+          s_buffer, s_offset,                                        \
+          queue, event));
+
+DECLARE_FUNCTION(Srotg, ROTG_SIGNATURE(float));
+DECLARE_FUNCTION(Drotg, ROTG_SIGNATURE(double));
+
+// ROTMG
+#define ROTMG_SIGNATURE(T)                                                        \
+  (cl_mem d1_buffer, const size_t d1_offset,                                      \
+  cl_mem d2_buffer, const size_t d2_offset,                                       \
+  cl_mem x1_buffer, const size_t x1_offset,                                       \
+  const cl_mem y1_buffer, const size_t y1_offset,                                 \
+  cl_mem param_buffer, const size_t param_offset,                                 \
+  cl_command_queue* queue, cl_event* event)
+
+#define ROTMG_RETURN(T)                                              \
+  return convert_status(clblast::Rotmg<CONVERT_TYPE(T)>(             \
+          d1_buffer, d1_offset,                                      \
+          d2_buffer, d2_offset,                                      \
+          x1_buffer, x1_offset,                                      \
+          y1_buffer, y1_offset,                                      \
+          param_buffer, param_offset,                                \
+          queue, event));
+
+DECLARE_FUNCTION(Srotmg, ROTMG_SIGNATURE(float));
+DECLARE_FUNCTION(Drotmg, ROTMG_SIGNATURE(double));
+
+// ROT
+#define ROT_SIGNATURE(T)                                                          \
+  (const size_t n,                                                                \
+  cl_mem x_buffer, const size_t x_offset, const size_t x_inc,                     \
+  cl_mem y_buffer, const size_t y_offset, const size_t y_inc,                     \
+  const cl_mem c_buffer, const size_t c_offset,                                   \
+  const cl_mem s_buffer, const size_t s_offset,                                   \
+  cl_command_queue* queue, cl_event* event)
+
+#define ROT_RETURN(T)                                                \
+  return convert_status(clblast::Rot<CONVERT_TYPE(T)>(               \
+          n,                                                         \
+          x_buffer, x_offset, x_inc,                                 \
+          y_buffer, y_offset, y_inc,                                 \
+          c_buffer, c_offset,                                        \
+          s_buffer, s_offset,                                        \
+          queue, event));
+
+DECLARE_FUNCTION(Srot, ROT_SIGNATURE(float));
+DECLARE_FUNCTION(Drot, ROT_SIGNATURE(double));
+
+// ROTM
+#define ROTM_SIGNATURE(T)                                                         \
+  (const size_t n,                                                                \
+  cl_mem x_buffer, const size_t x_offset, const size_t x_inc,                     \
+  cl_mem y_buffer, const size_t y_offset, const size_t y_inc,                     \
+  const cl_mem param_buffer, const size_t param_offset,                           \
+  cl_command_queue* queue, cl_event* event)
+
+#define ROTM_RETURN(T)                                               \
+  return convert_status(clblast::Rotm<CONVERT_TYPE(T)>(              \
+          n,                                                         \
+          x_buffer, x_offset, x_inc,                                 \
+          y_buffer, y_offset, y_inc,                                 \
+          param_buffer, param_offset,                                \
+          queue, event));
+
+DECLARE_FUNCTION(Srotm, ROTM_SIGNATURE(float));
+DECLARE_FUNCTION(Drotm, ROTM_SIGNATURE(double));
+
+// SWAP
+#define SWAP_SIGNATURE(T)                                                         \
+  (const size_t n,                                                                \
+  cl_mem x_buffer, const size_t x_offset, const size_t x_inc,                     \
+  cl_mem y_buffer, const size_t y_offset, const size_t y_inc,                     \
+  cl_command_queue* queue, cl_event* event)
+
+#define SWAP_RETURN(T)                                               \
+  return convert_status(clblast::Swap<CONVERT_TYPE(T)>(              \
+          n,                                                         \
+          x_buffer, x_offset, x_inc,                                 \
+          y_buffer, y_offset, y_inc,                                 \
+          queue, event));
+
+DECLARE_FUNCTION(Sswap, SWAP_SIGNATURE(float));
+DECLARE_FUNCTION(Dswap, SWAP_SIGNATURE(double));
+DECLARE_FUNCTION(Cswap, SWAP_SIGNATURE(float2));
+DECLARE_FUNCTION(Zswap, SWAP_SIGNATURE(double2));
+
+// SCAL
+#define SCAL_SIGNATURE(T)                                                         \
+  (const size_t n, const T alpha,                                                 \
+  cl_mem x_buffer, const size_t x_offset, const size_t x_inc,                     \
+  cl_command_queue* queue, cl_event* event)
+
+#define SCAL_RETURN(T)                                               \
+  return convert_status(clblast::Scal<CONVERT_TYPE(T)>(              \
+          n, convert_scalar(alpha),                                  \
+          x_buffer, x_offset, x_inc,                                 \
+          queue, event));
+
+DECLARE_FUNCTION(Sscal, SCAL_SIGNATURE(float));
+DECLARE_FUNCTION(Dscal, SCAL_SIGNATURE(double));
+DECLARE_FUNCTION(Cscal, SCAL_SIGNATURE(float2));
+DECLARE_FUNCTION(Zscal, SCAL_SIGNATURE(double2));
+
+// SCAL with a real scalar on a complex vector: CSSCAL/ZDSCAL
+#define SCAL_REAL_RETURN(T)                                          \
+  return convert_status(clblast::Scal<CONVERT_TYPE(T)>(              \
+          n, CONVERT_TYPE(T){alpha, 0},                              \
+          x_buffer, x_offset, x_inc,                                 \
+          queue, event));
+
+DECLARE_FUNCTION(Csscal, SCAL_SIGNATURE(float));
+DECLARE_FUNCTION(Zdscal, SCAL_SIGNATURE(double));
+
+// COPY
+#define COPY_SIGNATURE(T)                                                         \
+  (const size_t n,                                                                \
+  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,               \
+  cl_mem y_buffer, const size_t y_offset, const size_t y_inc,                     \
+  cl_command_queue* queue, cl_event* event)
+
+#define COPY_RETURN(T)                                               \
+  return convert_status(clblast::Copy<CONVERT_TYPE(T)>(              \
+          n,                                                         \
+          x_buffer, x_offset, x_inc,                                 \
+          y_buffer, y_offset, y_inc,                                 \
+          queue, event));
+
+DECLARE_FUNCTION(Scopy, COPY_SIGNATURE(float));
+DECLARE_FUNCTION(Dcopy, COPY_SIGNATURE(double));
+DECLARE_FUNCTION(Ccopy, COPY_SIGNATURE(float2));
+DECLARE_FUNCTION(Zcopy, COPY_SIGNATURE(double2));
+
 // AXPY
 #define AXPY_SIGNATURE(T)                                                         \
   (const size_t n, const T alpha,                                                 \
@@ -189,17 +365,187 @@ static inline StatusCode convert_status(clblast::StatusCode status) {
   cl_command_queue* queue, cl_event* event)
 
 #define AXPY_RETURN(T)                                               \
-  return convert_status(clblast::Axpy<T>(                            \
-          n, alpha,                                                  \
+  return convert_status(clblast::Axpy<CONVERT_TYPE(T)>(              \
+          n, convert_scalar(alpha),                                  \
           x_buffer, x_offset, x_inc,                                 \
           y_buffer, y_offset, y_inc,                                 \
           queue, event));
 
+DECLARE_FUNCTION(Haxpy, AXPY_SIGNATURE(cl_half));
 DECLARE_FUNCTION(Saxpy, AXPY_SIGNATURE(float));
 DECLARE_FUNCTION(Daxpy, AXPY_SIGNATURE(double));
 DECLARE_FUNCTION(Caxpy, AXPY_SIGNATURE(float2));
 DECLARE_FUNCTION(Zaxpy, AXPY_SIGNATURE(double2));
 
+// DOT
+#define DOT_SIGNATURE(T)                                                          \
+  (const size_t n,                                                                \
+  cl_mem dot_buffer, const size_t dot_offset,                                     \
+  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,               \
+  const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,               \
+  cl_command_queue* queue, cl_event* event)
+
+#define DOT_RETURN(T)                                                \
+  return convert_status(clblast::Dot<CONVERT_TYPE(T)>(               \
+          n,                                                         \
+          dot_buffer, dot_offset,                                    \
+          x_buffer, x_offset, x_inc,                                 \
+          y_buffer, y_offset, y_inc,                                 \
+          queue, event));
+
+DECLARE_FUNCTION(Sdot, DOT_SIGNATURE(float));
+DECLARE_FUNCTION(Ddot, DOT_SIGNATURE(double));
+
+// DOTU
+#define DOTU_SIGNATURE(T)                                                         \
+  (const size_t n,                                                                \
+  cl_mem dot_buffer, const size_t dot_offset,                                     \
+  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,               \
+  const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,               \
+  cl_command_queue* queue, cl_event* event)
+
+#define DOTU_RETURN(T)                                               \
+  return convert_status(clblast::Dotu<CONVERT_TYPE(T)>(              \
+          n,                                                         \
+          dot_buffer, dot_offset,                                    \
+          x_buffer, x_offset, x_inc,                                 \
+          y_buffer, y_offset, y_inc,                                 \
+          queue, event));
+
+DECLARE_FUNCTION(Cdotu, DOTU_SIGNATURE(float2));
+DECLARE_FUNCTION(Zdotu, DOTU_SIGNATURE(double2));
+
+// DOTC
+#define DOTC_SIGNATURE(T)                                                         \
+  (const size_t n,                                                                \
+  cl_mem dot_buffer, const size_t dot_offset,                                     \
+  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,               \
+  const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,               \
+  cl_command_queue* queue, cl_event* event)
+
+#define DOTC_RETURN(T)                                               \
+  return convert_status(clblast::Dotc<CONVERT_TYPE(T)>(              \
+          n,                                                         \
+          dot_buffer, dot_offset,                                    \
+          x_buffer, x_offset, x_inc,                                 \
+          y_buffer, y_offset, y_inc,                                 \
+          queue, event));
+
+DECLARE_FUNCTION(Cdotc, DOTC_SIGNATURE(float2));
+DECLARE_FUNCTION(Zdotc, DOTC_SIGNATURE(double2));
+
+// SDSDOT
+#define SDSDOT_SIGNATURE(T)                                                       \
+  (const size_t n, const T sb,                                                    \
+  cl_mem dot_buffer, const size_t dot_offset,                                     \
+  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,               \
+  const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,               \
+  cl_command_queue* queue, cl_event* event)
+
+#define SDSDOT_RETURN(T)                                             \
+  return convert_status(clblast::Sdsdot<CONVERT_TYPE(T)>(            \
+          n, sb,                                                     \
+          dot_buffer, dot_offset,                                    \
+          x_buffer, x_offset, x_inc,                                 \
+          y_buffer, y_offset, y_inc,                                 \
+          queue, event));
+
+DECLARE_FUNCTION(Sdsdot, SDSDOT_SIGNATURE(float));
+
+// DSDOT
+#define DSDOT_SIGNATURE(T)                                                        \
+  (const size_t n,                                                                \
+  cl_mem dot_buffer, const size_t dot_offset,                                     \
+  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,               \
+  const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,               \
+  cl_command_queue* queue, cl_event* event)
+
+#define DSDOT_RETURN(T)                                              \
+  return convert_status(clblast::Dsdot<CONVERT_TYPE(T)>(             \
+          n,                                                         \
+          dot_buffer, dot_offset,                                    \
+          x_buffer, x_offset, x_inc,                                 \
+          y_buffer, y_offset, y_inc,                                 \
+          queue, event));
+
+DECLARE_FUNCTION(Dsdot, DSDOT_SIGNATURE(double));
+
+// NRM2
+#define NRM2_SIGNATURE(T)                                                         \
+  (const size_t n,                                                                \
+  cl_mem nrm2_buffer, const size_t nrm2_offset,                                   \
+  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,               \
+  cl_command_queue* queue, cl_event* event)
+
+#define NRM2_RETURN(T)                                               \
+  return convert_status(clblast::Nrm2<CONVERT_TYPE(T)>(              \
+          n,                                                         \
+          nrm2_buffer, nrm2_offset,                                  \
+          x_buffer, x_offset, x_inc,                                 \
+          queue, event));
+
+DECLARE_FUNCTION(Snrm2, NRM2_SIGNATURE(float));
+DECLARE_FUNCTION(Dnrm2, NRM2_SIGNATURE(double));
+DECLARE_FUNCTION(Scnrm2, NRM2_SIGNATURE(float2));
+DECLARE_FUNCTION(Dznrm2, NRM2_SIGNATURE(double2));
+
+// ASUM
+#define ASUM_SIGNATURE(T)                                                         \
+  (const size_t n,                                                                \
+  cl_mem asum_buffer, const size_t asum_offset,                                   \
+  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,               \
+  cl_command_queue* queue, cl_event* event)
+
+#define ASUM_RETURN(T)                                               \
+  return convert_status(clblast::Asum<CONVERT_TYPE(T)>(              \
+          n,                                                         \
+          asum_buffer, asum_offset,                                  \
+          x_buffer, x_offset, x_inc,                                 \
+          queue, event));
+
+DECLARE_FUNCTION(Sasum, ASUM_SIGNATURE(float));
+DECLARE_FUNCTION(Dasum, ASUM_SIGNATURE(double));
+DECLARE_FUNCTION(Scasum, ASUM_SIGNATURE(float2));
+DECLARE_FUNCTION(Dzasum, ASUM_SIGNATURE(double2));
+
+// AMAX
+#define AMAX_SIGNATURE(T)                                                         \
+  (const size_t n,                                                                \
+  cl_mem imax_buffer, const size_t imax_offset,                                   \
+  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,               \
+  cl_command_queue* queue, cl_event* event)
+
+#define AMAX_RETURN(T)                                               \
+  return convert_status(clblast::Amax<CONVERT_TYPE(T)>(              \
+          n,                                                         \
+          imax_buffer, imax_offset,                                  \
+          x_buffer, x_offset, x_inc,                                 \
+          queue, event));
+
+DECLARE_FUNCTION(iSamax, AMAX_SIGNATURE(float));
+DECLARE_FUNCTION(iDamax, AMAX_SIGNATURE(double));
+DECLARE_FUNCTION(iCamax, AMAX_SIGNATURE(float2));
+DECLARE_FUNCTION(iZamax, AMAX_SIGNATURE(double2));
+
+// AMIN
+#define AMIN_SIGNATURE(T)                                                         \
+  (const size_t n,                                                                \
+  cl_mem imin_buffer, const size_t imin_offset,                                   \
+  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,               \
+  cl_command_queue* queue, cl_event* event)
+
+#define AMIN_RETURN(T)                                               \
+  return convert_status(clblast::Amin<CONVERT_TYPE(T)>(              \
+          n,                                                         \
+          imin_buffer, imin_offset,                                  \
+          x_buffer, x_offset, x_inc,                                 \
+          queue, event));
+
+DECLARE_FUNCTION(iSamin, AMIN_SIGNATURE(float));
+DECLARE_FUNCTION(iDamin, AMIN_SIGNATURE(double));
+DECLARE_FUNCTION(iCamin, AMIN_SIGNATURE(float2));
+DECLARE_FUNCTION(iZamin, AMIN_SIGNATURE(double2));
+
 // =================================================================================================
 // BLAS level-2 (matrix-vector) routines
 
@@ -213,20 +559,528 @@ DECLARE_FUNCTION(Zaxpy, AXPY_SIGNATURE(double2));
   cl_command_queue* queue, cl_event* event)
 
 #define GEMV_RETURN(T)                                               \
-  return convert_status(clblast::Gemv<T>(                            \
+  return convert_status(clblast::Gemv<CONVERT_TYPE(T)>(              \
           CONVERT_LAYOUT(layout),                                    \
           CONVERT_TRANS(a_transpose),                                \
-          m, n, alpha,                                               \
+          m, n, convert_scalar(alpha),                               \
           a_buffer, a_offset, a_ld,                                  \
-          x_buffer, x_offset, x_inc, beta,                           \
+          x_buffer, x_offset, x_inc, convert_scalar(beta),           \
           y_buffer, y_offset, y_inc,                                 \
           queue, event));
 
+DECLARE_FUNCTION(Hgemv, GEMV_SIGNATURE(cl_half));
 DECLARE_FUNCTION(Sgemv, GEMV_SIGNATURE(float));
 DECLARE_FUNCTION(Dgemv, GEMV_SIGNATURE(double));
 DECLARE_FUNCTION(Cgemv, GEMV_SIGNATURE(float2));
 DECLARE_FUNCTION(Zgemv, GEMV_SIGNATURE(double2));
 
+// GBMV
+#define GBMV_SIGNATURE(T)                                                         \
+  (const Layout layout, const Transpose a_transpose,                              \
+  const size_t m, const size_t n, const size_t kl, const size_t ku,               \
+  const T alpha,                                                                  \
+  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,                \
+  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const T beta, \
+  cl_mem y_buffer, const size_t y_offset, const size_t y_inc,                     \
+  cl_command_queue* queue, cl_event* event)
+
+#define GBMV_RETURN(T)                                               \
+  return convert_status(clblast::Gbmv<CONVERT_TYPE(T)>(              \
+          CONVERT_LAYOUT(layout),                                    \
+          CONVERT_TRANS(a_transpose),                                \
+          m, n, kl, ku, convert_scalar(alpha),                       \
+          a_buffer, a_offset, a_ld,                                  \
+          x_buffer, x_offset, x_inc, convert_scalar(beta),           \
+          y_buffer, y_offset, y_inc,                                 \
+          queue, event));
+
+DECLARE_FUNCTION(Sgbmv, GBMV_SIGNATURE(float));
+DECLARE_FUNCTION(Dgbmv, GBMV_SIGNATURE(double));
+DECLARE_FUNCTION(Cgbmv, GBMV_SIGNATURE(float2));
+DECLARE_FUNCTION(Zgbmv, GBMV_SIGNATURE(double2));
+
+// SYMV
+#define SYMV_SIGNATURE(T)                                                         \
+  (const Layout layout, const Triangle triangle,                                  \
+  const size_t n, const T alpha,                                                  \
+  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,                \
+  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const T beta, \
+  cl_mem y_buffer, const size_t y_offset, const size_t y_inc,                     \
+  cl_command_queue* queue, cl_event* event)
+
+#define SYMV_RETURN(T)                                               \
+  return convert_status(clblast::Symv<CONVERT_TYPE(T)>(              \
+          CONVERT_LAYOUT(layout),                                    \
+          CONVERT_TRIANGLE(triangle),                                \
+          n, convert_scalar(alpha),                                  \
+          a_buffer, a_offset, a_ld,                                  \
+          x_buffer, x_offset, x_inc, convert_scalar(beta),           \
+          y_buffer, y_offset, y_inc,                                 \
+          queue, event));
+
+DECLARE_FUNCTION(Ssymv, SYMV_SIGNATURE(float));
+DECLARE_FUNCTION(Dsymv, SYMV_SIGNATURE(double));
+
+// HEMV
+#define HEMV_SIGNATURE(T)                                                         \
+  (const Layout layout, const Triangle triangle,                                  \
+  const size_t n, const T alpha,                                                  \
+  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,                \
+  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const T beta, \
+  cl_mem y_buffer, const size_t y_offset, const size_t y_inc,                     \
+  cl_command_queue* queue, cl_event* event)
+
+#define HEMV_RETURN(T)                                               \
+  return convert_status(clblast::Hemv<CONVERT_TYPE(T)>(              \
+          CONVERT_LAYOUT(layout),                                    \
+          CONVERT_TRIANGLE(triangle),                                \
+          n, convert_scalar(alpha),                                  \
+          a_buffer, a_offset, a_ld,                                  \
+          x_buffer, x_offset, x_inc, convert_scalar(beta),           \
+          y_buffer, y_offset, y_inc,                                 \
+          queue, event));
+
+DECLARE_FUNCTION(Chemv, HEMV_SIGNATURE(float2));
+DECLARE_FUNCTION(Zhemv, HEMV_SIGNATURE(double2));
+
+// SBMV
+#define SBMV_SIGNATURE(T)                                                         \
+  (const Layout layout, const Triangle triangle,                                  \
+  const size_t n, const size_t k, const T alpha,                                  \
+  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,                \
+  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const T beta, \
+  cl_mem y_buffer, const size_t y_offset, const size_t y_inc,                     \
+  cl_command_queue* queue, cl_event* event)
+
+#define SBMV_RETURN(T)                                               \
+  return convert_status(clblast::Sbmv<CONVERT_TYPE(T)>(              \
+          CONVERT_LAYOUT(layout),                                    \
+          CONVERT_TRIANGLE(triangle),                                \
+          n, k, convert_scalar(alpha),                               \
+          a_buffer, a_offset, a_ld,                                  \
+          x_buffer, x_offset, x_inc, convert_scalar(beta),           \
+          y_buffer, y_offset, y_inc,                                 \
+          queue, event));
+
+DECLARE_FUNCTION(Ssbmv, SBMV_SIGNATURE(float));
+DECLARE_FUNCTION(Dsbmv, SBMV_SIGNATURE(double));
+
+// HBMV
+#define HBMV_SIGNATURE(T)                                                         \
+  (const Layout layout, const Triangle triangle,                                  \
+  const size_t n, const size_t k, const T alpha,                                  \
+  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,                \
+  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const T beta, \
+  cl_mem y_buffer, const size_t y_offset, const size_t y_inc,                     \
+  cl_command_queue* queue, cl_event* event)
+
+#define HBMV_RETURN(T)                                               \
+  return convert_status(clblast::Hbmv<CONVERT_TYPE(T)>(              \
+          CONVERT_LAYOUT(layout),                                    \
+          CONVERT_TRIANGLE(triangle),                                \
+          n, k, convert_scalar(alpha),                               \
+          a_buffer, a_offset, a_ld,                                  \
+          x_buffer, x_offset, x_inc, convert_scalar(beta),           \
+          y_buffer, y_offset, y_inc,                                 \
+          queue, event));
+
+DECLARE_FUNCTION(Chbmv, HBMV_SIGNATURE(float2));
+DECLARE_FUNCTION(Zhbmv, HBMV_SIGNATURE(double2));
+
+// SPMV
+#define SPMV_SIGNATURE(T)                                                         \
+  (const Layout layout, const Triangle triangle,                                  \
+  const size_t n,                                                                 \
+  const T alpha,                                                                  \
+  const cl_mem ap_buffer, const size_t ap_offset,                                 \
+  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,               \
+  const T beta,                                                                   \
+  cl_mem y_buffer, const size_t y_offset, const size_t y_inc,                     \
+  cl_command_queue* queue, cl_event* event)
+
+#define SPMV_RETURN(T)                                               \
+  return convert_status(clblast::Spmv<CONVERT_TYPE(T)>(              \
+          CONVERT_LAYOUT(layout),                                    \
+          CONVERT_TRIANGLE(triangle),                                \
+          n, convert_scalar(alpha),                                  \
+          ap_buffer, ap_offset,                                      \
+          x_buffer, x_offset, x_inc, convert_scalar(beta),           \
+          y_buffer, y_offset, y_inc,                                 \
+          queue, event));
+
+DECLARE_FUNCTION(Sspmv, SPMV_SIGNATURE(float));
+DECLARE_FUNCTION(Dspmv, SPMV_SIGNATURE(double));
+
+// HPMV
+#define HPMV_SIGNATURE(T)                                                         \
+  (const Layout layout, const Triangle triangle,                                  \
+  const size_t n,                                                                 \
+  const T alpha,                                                                  \
+  const cl_mem ap_buffer, const size_t ap_offset,                                 \
+  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,               \
+  const T beta,                                                                   \
+  cl_mem y_buffer, const size_t y_offset, const size_t y_inc,                     \
+  cl_command_queue* queue, cl_event* event)
+
+#define HPMV_RETURN(T)                                               \
+  return convert_status(clblast::Hpmv<CONVERT_TYPE(T)>(              \
+          CONVERT_LAYOUT(layout),                                    \
+          CONVERT_TRIANGLE(triangle),                                \
+          n, convert_scalar(alpha),                                  \
+          ap_buffer, ap_offset,                                      \
+          x_buffer, x_offset, x_inc, convert_scalar(beta),           \
+          y_buffer, y_offset, y_inc,                                 \
+          queue, event));
+
+DECLARE_FUNCTION(Chpmv, HPMV_SIGNATURE(float2));
+DECLARE_FUNCTION(Zhpmv, HPMV_SIGNATURE(double2));
+
+// TRMV
+#define TRMV_SIGNATURE(T)                                                         \
+  (const Layout layout, const Triangle triangle,                                  \
+  const Transpose a_transpose, const Diagonal diagonal,                           \
+  const size_t n,                                                                 \
+  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,                \
+  cl_mem x_buffer, const size_t x_offset, const size_t x_inc,                     \
+  cl_command_queue* queue, cl_event* event)
+
+#define TRMV_RETURN(T)                                               \
+  return convert_status(clblast::Trmv<CONVERT_TYPE(T)>(              \
+          CONVERT_LAYOUT(layout),                                    \
+          CONVERT_TRIANGLE(triangle),                                \
+          CONVERT_TRANS(a_transpose),                                \
+          CONVERT_DIAG(diagonal),                                    \
+          n,                                                         \
+          a_buffer, a_offset, a_ld,                                  \
+          x_buffer, x_offset, x_inc,                                 \
+          queue, event));
+
+DECLARE_FUNCTION(Strmv, TRMV_SIGNATURE(float));
+DECLARE_FUNCTION(Dtrmv, TRMV_SIGNATURE(double));
+DECLARE_FUNCTION(Ctrmv, TRMV_SIGNATURE(float2));
+DECLARE_FUNCTION(Ztrmv, TRMV_SIGNATURE(double2));
+
+// TBMV
+#define TBMV_SIGNATURE(T)                                                         \
+  (const Layout layout, const Triangle triangle,                                  \
+  const Transpose a_transpose, const Diagonal diagonal,                           \
+  const size_t n, const size_t k,                                                 \
+  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,                \
+  cl_mem x_buffer, const size_t x_offset, const size_t x_inc,                     \
+  cl_command_queue* queue, cl_event* event)
+
+#define TBMV_RETURN(T)                                               \
+  return convert_status(clblast::Tbmv<CONVERT_TYPE(T)>(              \
+          CONVERT_LAYOUT(layout),                                    \
+          CONVERT_TRIANGLE(triangle),                                \
+          CONVERT_TRANS(a_transpose),                                \
+          CONVERT_DIAG(diagonal),                                    \
+          n, k,                                                      \
+          a_buffer, a_offset, a_ld,                                  \
+          x_buffer, x_offset, x_inc,                                 \
+          queue, event));
+
+DECLARE_FUNCTION(Stbmv, TBMV_SIGNATURE(float));
+DECLARE_FUNCTION(Dtbmv, TBMV_SIGNATURE(double));
+DECLARE_FUNCTION(Ctbmv, TBMV_SIGNATURE(float2));
+DECLARE_FUNCTION(Ztbmv, TBMV_SIGNATURE(double2));
+
+// TPMV
+#define TPMV_SIGNATURE(T)                                                         \
+  (const Layout layout, const Triangle triangle,                                  \
+  const Transpose a_transpose, const Diagonal diagonal,                           \
+  const size_t n,                                                                 \
+  const cl_mem ap_buffer, const size_t ap_offset,                                 \
+  cl_mem x_buffer, const size_t x_offset, const size_t x_inc,                     \
+  cl_command_queue* queue, cl_event* event)
+
+#define TPMV_RETURN(T)                                               \
+  return convert_status(clblast::Tpmv<CONVERT_TYPE(T)>(              \
+          CONVERT_LAYOUT(layout),                                    \
+          CONVERT_TRIANGLE(triangle),                                \
+          CONVERT_TRANS(a_transpose),                                \
+          CONVERT_DIAG(diagonal),                                    \
+          n,                                                         \
+          ap_buffer, ap_offset,                                      \
+          x_buffer, x_offset, x_inc,                                 \
+          queue, event));
+
+DECLARE_FUNCTION(Stpmv, TPMV_SIGNATURE(float));
+DECLARE_FUNCTION(Dtpmv, TPMV_SIGNATURE(double));
+DECLARE_FUNCTION(Ctpmv, TPMV_SIGNATURE(float2));
+DECLARE_FUNCTION(Ztpmv, TPMV_SIGNATURE(double2));
+
+// TRSV
+#define TRSV_SIGNATURE(T)                                                         \
+  (const Layout layout, const Triangle triangle,                                  \
+  const Transpose a_transpose, const Diagonal diagonal,                           \
+  const size_t n,                                                                 \
+  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,                \
+  cl_mem x_buffer, const size_t x_offset, const size_t x_inc,                     \
+  cl_command_queue* queue, cl_event* event)
+
+#define TRSV_RETURN(T)                                               \
+  return convert_status(clblast::Trsv<CONVERT_TYPE(T)>(              \
+          CONVERT_LAYOUT(layout),                                    \
+          CONVERT_TRIANGLE(triangle),                                \
+          CONVERT_TRANS(a_transpose),                                \
+          CONVERT_DIAG(diagonal),                                    \
+          n,                                                         \
+          a_buffer, a_offset, a_ld,                                  \
+          x_buffer, x_offset, x_inc,                                 \
+          queue, event));
+
+DECLARE_FUNCTION(Strsv, TRSV_SIGNATURE(float));
+DECLARE_FUNCTION(Dtrsv, TRSV_SIGNATURE(double));
+DECLARE_FUNCTION(Ctrsv, TRSV_SIGNATURE(float2));
+DECLARE_FUNCTION(Ztrsv, TRSV_SIGNATURE(double2));
+
+// TBSV
+#define TBSV_SIGNATURE(T)                                                         \
+  (const Layout layout, const Triangle triangle,                                  \
+  const Transpose a_transpose, const Diagonal diagonal,                           \
+  const size_t n, const size_t k,                                                 \
+  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,                \
+  cl_mem x_buffer, const size_t x_offset, const size_t x_inc,                     \
+  cl_command_queue* queue, cl_event* event)
+
+#define TBSV_RETURN(T)                                               \
+  return convert_status(clblast::Tbsv<CONVERT_TYPE(T)>(              \
+          CONVERT_LAYOUT(layout),                                    \
+          CONVERT_TRIANGLE(triangle),                                \
+          CONVERT_TRANS(a_transpose),                                \
+          CONVERT_DIAG(diagonal),                                    \
+          n, k,                                                      \
+          a_buffer, a_offset, a_ld,                                  \
+          x_buffer, x_offset, x_inc,                                 \
+          queue, event));
+
+DECLARE_FUNCTION(Stbsv, TBSV_SIGNATURE(float));
+DECLARE_FUNCTION(Dtbsv, TBSV_SIGNATURE(double));
+DECLARE_FUNCTION(Ctbsv, TBSV_SIGNATURE(float2));
+DECLARE_FUNCTION(Ztbsv, TBSV_SIGNATURE(double2));
+
+// TPSV
+#define TPSV_SIGNATURE(T)                                                         \
+  (const Layout layout, const Triangle triangle,                                  \
+  const Transpose a_transpose, const Diagonal diagonal,                           \
+  const size_t n,                                                                 \
+  const cl_mem ap_buffer, const size_t ap_offset,                                 \
+  cl_mem x_buffer, const size_t x_offset, const size_t x_inc,                     \
+  cl_command_queue* queue, cl_event* event)
+
+#define TPSV_RETURN(T)                                               \
+  return convert_status(clblast::Tpsv<CONVERT_TYPE(T)>(              \
+          CONVERT_LAYOUT(layout),                                    \
+          CONVERT_TRIANGLE(triangle),                                \
+          CONVERT_TRANS(a_transpose),                                \
+          CONVERT_DIAG(diagonal),                                    \
+          n,                                                         \
+          ap_buffer, ap_offset,                                      \
+          x_buffer, x_offset, x_inc,                                 \
+          queue, event));
+
+DECLARE_FUNCTION(Stpsv, TPSV_SIGNATURE(float));
+DECLARE_FUNCTION(Dtpsv, TPSV_SIGNATURE(double));
+DECLARE_FUNCTION(Ctpsv, TPSV_SIGNATURE(float2));
+DECLARE_FUNCTION(Ztpsv, TPSV_SIGNATURE(double2));
+
+// GER
+#define GER_SIGNATURE(T)                                                          \
+  (const Layout layout,                                                           \
+  const size_t m, const size_t n,                                                 \
+  const T alpha,                                                                  \
+  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,               \
+  const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,               \
+  cl_mem a_buffer, const size_t a_offset, const size_t a_ld,                      \
+  cl_command_queue* queue, cl_event* event)
+
+#define GER_RETURN(T)                                                \
+  return convert_status(clblast::Ger<CONVERT_TYPE(T)>(               \
+          CONVERT_LAYOUT(layout),                                    \
+          m, n, convert_scalar(alpha),                               \
+          x_buffer, x_offset, x_inc,                                 \
+          y_buffer, y_offset, y_inc,                                 \
+          a_buffer, a_offset, a_ld,                                  \
+          queue, event));
+
+DECLARE_FUNCTION(Sger, GER_SIGNATURE(float));
+DECLARE_FUNCTION(Dger, GER_SIGNATURE(double));
+
+// GERU
+#define GERU_SIGNATURE(T)                                                         \
+  (const Layout layout,                                                           \
+  const size_t m, const size_t n,                                                 \
+  const T alpha,                                                                  \
+  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,               \
+  const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,               \
+  cl_mem a_buffer, const size_t a_offset, const size_t a_ld,                      \
+  cl_command_queue* queue, cl_event* event)
+
+#define GERU_RETURN(T)                                               \
+  return convert_status(clblast::Geru<CONVERT_TYPE(T)>(              \
+          CONVERT_LAYOUT(layout),                                    \
+          m, n, convert_scalar(alpha),                               \
+          x_buffer, x_offset, x_inc,                                 \
+          y_buffer, y_offset, y_inc,                                 \
+          a_buffer, a_offset, a_ld,                                  \
+          queue, event));
+
+DECLARE_FUNCTION(Cgeru, GERU_SIGNATURE(float2));
+DECLARE_FUNCTION(Zgeru, GERU_SIGNATURE(double2));
+
+// GERC
+#define GERC_SIGNATURE(T)                                                         \
+  (const Layout layout,                                                           \
+  const size_t m, const size_t n,                                                 \
+  const T alpha,                                                                  \
+  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,               \
+  const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,               \
+  cl_mem a_buffer, const size_t a_offset, const size_t a_ld,                      \
+  cl_command_queue* queue, cl_event* event)
+
+#define GERC_RETURN(T)                                               \
+  return convert_status(clblast::Gerc<CONVERT_TYPE(T)>(              \
+          CONVERT_LAYOUT(layout),                                    \
+          m, n, convert_scalar(alpha),                               \
+          x_buffer, x_offset, x_inc,                                 \
+          y_buffer, y_offset, y_inc,                                 \
+          a_buffer, a_offset, a_ld,                                  \
+          queue, event));
+
+DECLARE_FUNCTION(Cgerc, GERC_SIGNATURE(float2));
+DECLARE_FUNCTION(Zgerc, GERC_SIGNATURE(double2));
+
+// SYR
+#define SYR_SIGNATURE(T)                                                          \
+  (const Layout layout, const Triangle triangle,                                  \
+  const size_t n,                                                                 \
+  const T alpha,                                                                  \
+  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,               \
+  cl_mem a_buffer, const size_t a_offset, const size_t a_ld,                      \
+  cl_command_queue* queue, cl_event* event)
+
+#define SYR_RETURN(T)                                                \
+  return convert_status(clblast::Syr<CONVERT_TYPE(T)>(               \
+          CONVERT_LAYOUT(layout),                                    \
+          CONVERT_TRIANGLE(triangle),                                \
+          n, convert_scalar(alpha),                                  \
+          x_buffer, x_offset, x_inc,                                 \
+          a_buffer, a_offset, a_ld,                                  \
+          queue, event));
+
+DECLARE_FUNCTION(Ssyr, SYR_SIGNATURE(float));
+DECLARE_FUNCTION(Dsyr, SYR_SIGNATURE(double));
+
+// HER
+#define HER_SIGNATURE(T)                                                          \
+  (const Layout layout, const Triangle triangle,                                  \
+  const size_t n,                                                                 \
+  const T alpha,                                                                  \
+  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,               \
+  cl_mem a_buffer, const size_t a_offset, const size_t a_ld,                      \
+  cl_command_queue* queue, cl_event* event)
+
+#define HER_RETURN(T)                                                \
+  return convert_status(clblast::Her<CONVERT_TYPE(T)>(               \
+          CONVERT_LAYOUT(layout),                                    \
+          CONVERT_TRIANGLE(triangle),                                \
+          n, convert_scalar(alpha),                                  \
+          x_buffer, x_offset, x_inc,                                 \
+          a_buffer, a_offset, a_ld,                                  \
+          queue, event));
+
+DECLARE_FUNCTION(Cher, HER_SIGNATURE(float));
+DECLARE_FUNCTION(Zher, HER_SIGNATURE(double));
+
+// SPR
+#define SPR_SIGNATURE(T)                                                          \
+  (const Layout layout, const Triangle triangle,                                  \
+  const size_t n,                                                                 \
+  const T alpha,                                                                  \
+  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,               \
+  cl_mem ap_buffer, const size_t ap_offset,                                       \
+  cl_command_queue* queue, cl_event* event)
+
+#define SPR_RETURN(T)                                                \
+  return convert_status(clblast::Spr<CONVERT_TYPE(T)>(               \
+          CONVERT_LAYOUT(layout),                                    \
+          CONVERT_TRIANGLE(triangle),                                \
+          n, convert_scalar(alpha),                                  \
+          x_buffer, x_offset, x_inc,                                 \
+          ap_buffer, ap_offset,                                      \
+          queue, event));
+
+DECLARE_FUNCTION(Sspr, SPR_SIGNATURE(float));
+DECLARE_FUNCTION(Dspr, SPR_SIGNATURE(double));
+
+// HPR
+#define HPR_SIGNATURE(T)                                                          \
+  (const Layout layout, const Triangle triangle,                                  \
+  const size_t n,                                                                 \
+  const T alpha,                                                                  \
+  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,               \
+  cl_mem ap_buffer, const size_t ap_offset,                                       \
+  cl_command_queue* queue, cl_event* event)
+
+#define HPR_RETURN(T)                                                \
+  return convert_status(clblast::Hpr<CONVERT_TYPE(T)>(               \
+          CONVERT_LAYOUT(layout),                                    \
+          CONVERT_TRIANGLE(triangle),                                \
+          n, convert_scalar(alpha),                                  \
+          x_buffer, x_offset, x_inc,                                 \
+          ap_buffer, ap_offset,                                      \
+          queue, event));
+
+DECLARE_FUNCTION(Chpr, HPR_SIGNATURE(float));
+DECLARE_FUNCTION(Zhpr, HPR_SIGNATURE(double));
+
+// SYR2
+#define SYR2_SIGNATURE(T)                                                         \
+  (const Layout layout, const Triangle triangle,                                  \
+  const size_t n,                                                                 \
+  const T alpha,                                                                  \
+  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,               \
+  const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,               \
+  cl_mem a_buffer, const size_t a_offset, const size_t a_ld,                      \
+  cl_command_queue* queue, cl_event* event)
+
+#define SYR2_RETURN(T)                                               \
+  return convert_status(clblast::Syr2<CONVERT_TYPE(T)>(              \
+          CONVERT_LAYOUT(layout),                                    \
+          CONVERT_TRIANGLE(triangle),                                \
+          n, convert_scalar(alpha),                                  \
+          x_buffer, x_offset, x_inc,                                 \
+          y_buffer, y_offset, y_inc,                                 \
+          a_buffer, a_offset, a_ld,                                  \
+          queue, event));
+
+DECLARE_FUNCTION(Ssyr2, SYR2_SIGNATURE(float));
+DECLARE_FUNCTION(Dsyr2, SYR2_SIGNATURE(double));
+
+// HER2
+#define HER2_SIGNATURE(T)                                                         \
+  (const Layout layout, const Triangle triangle,                                  \
+  const size_t n,                                                                 \
+  const T alpha,                                                                  \
+  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,               \
+  const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,               \
+  cl_mem a_buffer, const size_t a_offset, const size_t a_ld,                      \
+  cl_command_queue* queue, cl_event* event)
+
+#define HER2_RETURN(T)                                               \
+  return convert_status(clblast::Her2<CONVERT_TYPE(T)>(              \
+          CONVERT_LAYOUT(layout),                                    \
+          CONVERT_TRIANGLE(triangle),                                \
+          n, convert_scalar(alpha),                                  \
+          x_buffer, x_offset, x_inc,                                 \
+          y_buffer, y_offset, y_inc,                                 \
+          a_buffer, a_offset, a_ld,                                  \
+          queue, event));
+
+DECLARE_FUNCTION(Cher2, HER2_SIGNATURE(float2));
+DECLARE_FUNCTION(Zher2, HER2_SIGNATURE(double2));
+
 // =================================================================================================
 // BLAS level-3 (matrix-matrix) routines
 
@@ -242,15 +1096,16 @@ DECLARE_FUNCTION(Zgemv, GEMV_SIGNATURE(double2));
   cl_command_queue* queue, cl_event* event)   
 
 #define GEMM_RETURN(T)                                               \
-  return convert_status(clblast::Gemm<T>(                            \
+  return convert_status(clblast::Gemm<CONVERT_TYPE(T)>(              \
           CONVERT_LAYOUT(layout),                                    \
           CONVERT_TRANS(a_transpose),                                \
           CONVERT_TRANS(b_transpose),                                \
-          m, n, k, alpha,                                            \
+          m, n, k, convert_scalar(alpha),                            \
           a_buffer, a_offset, a_ld,                                  \
-          b_buffer, b_offset, b_ld, beta,                            \
+          b_buffer, b_offset, b_ld, convert_scalar(beta),            \
           c_buffer, c_offset, c_ld, queue, event));
 
+DECLARE_FUNCTION(Hgemm, GEMM_SIGNATURE(cl_half));
 DECLARE_FUNCTION(Sgemm, GEMM_SIGNATURE(float));
 DECLARE_FUNCTION(Dgemm, GEMM_SIGNATURE(double));
 DECLARE_FUNCTION(Cgemm, GEMM_SIGNATURE(float2));
@@ -270,13 +1125,13 @@ DECLARE_FUNCTION(Zgemm, GEMM_SIGNATURE(double2));
   cl_command_queue* queue, cl_event* event)
 
 #define SYMM_RETURN(T)                                               \
-  return convert_status(clblast::Symm<T>(                            \
+  return convert_status(clblast::Symm<CONVERT_TYPE(T)>(              \
           CONVERT_LAYOUT(layout),                                    \
           CONVERT_SIDE(side),                                        \
           CONVERT_TRIANGLE(triangle),                                \
-          m, n, alpha,                                               \
+          m, n, convert_scalar(alpha),                               \
           a_buffer, a_offset, a_ld,                                  \
-          b_buffer, b_offset, b_ld, beta,                            \
+          b_buffer, b_offset, b_ld, convert_scalar(beta),            \
           c_buffer, c_offset, c_ld, queue, event));
 
 DECLARE_FUNCTION(Ssymm, SYMM_SIGNATURE(float));
@@ -296,13 +1151,13 @@ DECLARE_FUNCTION(Zsymm, SYMM_SIGNATURE(double2));
   cl_command_queue* queue, cl_event* event)
 
 #define HEMM_RETURN(T)                                               \
-  return convert_status(clblast::Hemm<T>(                            \
+  return convert_status(clblast::Hemm<CONVERT_TYPE(T)>(              \
           CONVERT_LAYOUT(layout),                                    \
           CONVERT_SIDE(side),                                        \
           CONVERT_TRIANGLE(triangle),                                \
-          m, n, alpha,                                               \
+          m, n, convert_scalar(alpha),                               \
           a_buffer, a_offset, a_ld,                                  \
-          b_buffer, b_offset, b_ld, beta,                            \
+          b_buffer, b_offset, b_ld, convert_scalar(beta),            \
           c_buffer, c_offset, c_ld, queue, event));
 
 DECLARE_FUNCTION(Chemm, HEMM_SIGNATURE(float2));
@@ -319,12 +1174,12 @@ DECLARE_FUNCTION(Zhemm, HEMM_SIGNATURE(double2));
   cl_command_queue* queue, cl_event* event)
 
 #define SYRK_RETURN(T)                                               \
-  return convert_status(clblast::Syrk<T>(                            \
+  return convert_status(clblast::Syrk<CONVERT_TYPE(T)>(              \
           CONVERT_LAYOUT(layout),                                    \
           CONVERT_TRIANGLE(triangle),                                \
           CONVERT_TRANS(a_transpose),                                \
-          n, k, alpha,                                               \
-          a_buffer, a_offset, a_ld, beta,                            \
+          n, k, convert_scalar(alpha),                               \
+          a_buffer, a_offset, a_ld, convert_scalar(beta),            \
           c_buffer, c_offset, c_ld, queue, event));
 
 DECLARE_FUNCTION(Ssyrk, SYRK_SIGNATURE(float));
@@ -343,12 +1198,12 @@ DECLARE_FUNCTION(Zsyrk, SYRK_SIGNATURE(double2));
   cl_command_queue* queue, cl_event* event)
 
 #define HERK_RETURN(T)                                               \
-  return convert_status(clblast::Herk<T>(                            \
+  return convert_status(clblast::Herk<CONVERT_TYPE(T)>(              \
           CONVERT_LAYOUT(layout),                                    \
           CONVERT_TRIANGLE(triangle),                                \
           CONVERT_TRANS(a_transpose),                                \
-          n, k, alpha,                                               \
-          a_buffer, a_offset, a_ld, beta,                            \
+          n, k, convert_scalar(alpha),                               \
+          a_buffer, a_offset, a_ld, convert_scalar(beta),            \
           c_buffer, c_offset, c_ld, queue, event));
 
 DECLARE_FUNCTION(Cherk, HERK_SIGNATURE(float));
@@ -366,13 +1221,13 @@ DECLARE_FUNCTION(Zherk, HERK_SIGNATURE(double));
   cl_command_queue* queue, cl_event* event) 
 
 #define SYR2K_RETURN(T)                                              \
-  return convert_status(clblast::Syr2k<T>(                           \
+  return convert_status(clblast::Syr2k<CONVERT_TYPE(T)>(             \
           CONVERT_LAYOUT(layout),                                    \
           CONVERT_TRIANGLE(triangle),                                \
           CONVERT_TRANS(ab_transpose),                               \
-          n, k, alpha,                                               \
+          n, k, convert_scalar(alpha),                               \
           a_buffer, a_offset, a_ld,                                  \
-          b_buffer, b_offset, b_ld, beta,                            \
+          b_buffer, b_offset, b_ld, convert_scalar(beta),            \
           c_buffer, c_offset, c_ld, queue, event));
 
 DECLARE_FUNCTION(Ssyr2k, SYR2K_SIGNATURE(float));
@@ -392,13 +1247,13 @@ DECLARE_FUNCTION(Zsyr2k, SYR2K_SIGNATURE(double2));
   cl_command_queue* queue, cl_event* event)
 
 #define HER2K_RETURN(T, U)                                           \
-  return convert_status(clblast::Her2k<T, U>(                        \
+  return convert_status(clblast::Her2k<CONVERT_TYPE(T), U>(          \
           CONVERT_LAYOUT(layout),                                    \
           CONVERT_TRIANGLE(triangle),                                \
           CONVERT_TRANS(ab_transpose),                               \
-          n, k, alpha,                                               \
+          n, k, convert_scalar(alpha),                               \
           a_buffer, a_offset, a_ld,                                  \
-          b_buffer, b_offset, b_ld, beta,                            \
+          b_buffer, b_offset, b_ld, convert_scalar(beta),            \
           c_buffer, c_offset, c_ld, queue, event));
 
 DECLARE_FUNCTION(Cher2k, HER2K_SIGNATURE(float2, float));
@@ -417,13 +1272,13 @@ DECLARE_FUNCTION(Zher2k, HER2K_SIGNATURE(double2, double));
   cl_command_queue* queue, cl_event* event)
 
 #define TRMM_RETURN(T)                                               \
-  return convert_status(clblast::Trmm<T>(                            \
+  return convert_status(clblast::Trmm<CONVERT_TYPE(T)>(              \
           CONVERT_LAYOUT(layout),                                    \
           CONVERT_SIDE(side),                                        \
           CONVERT_TRIANGLE(triangle),                                \
           CONVERT_TRANS(a_transpose),                                \
           CONVERT_DIAG(diagonal),                                    \
-          m, n, alpha,                                               \
+          m, n, convert_scalar(alpha),                               \
           a_buffer, a_offset, a_ld,                                  \
           b_buffer, b_offset, b_ld, queue, event));
 
@@ -435,7 +1290,6 @@ DECLARE_FUNCTION(Ztrmm, TRMM_SIGNATURE(double2));
 // =================================================================================================
 
 // TRSM
-/*
 #define TRSM_SIGNATURE(T)                                                         \
   (const Layout layout, const Side side, const Triangle triangle,                 \
   const Transpose a_transpose, const Diagonal diagonal,                           \
@@ -446,22 +1300,21 @@ DECLARE_FUNCTION(Ztrmm, TRMM_SIGNATURE(double2));
   cl_command_queue* queue, cl_event* event)
 
 #define TRSM_RETURN(T)                                               \
-  return convert_status(clblast::Trsm<T>(                            \
+  return convert_status(clblast::Trsm<CONVERT_TYPE(T)>(              \
           CONVERT_LAYOUT(layout),                                    \
           CONVERT_SIDE(side),                                        \
           CONVERT_TRIANGLE(triangle),                                \
           CONVERT_TRANS(a_transpose),                                \
           CONVERT_DIAG(diagonal),                                    \
-          m, n, alpha,                                               \
+          m, n, convert_scalar(alpha),                               \
           a_buffer, a_offset, a_ld,                                  \
           b_buffer, b_offset, b_ld, queue, event));
 
-
 DECLARE_FUNCTION(Strsm, TRSM_SIGNATURE(float));
 DECLARE_FUNCTION(Dtrsm, TRSM_SIGNATURE(double));
 DECLARE_FUNCTION(Ctrsm, TRSM_SIGNATURE(float2));
 DECLARE_FUNCTION(Ztrsm, TRSM_SIGNATURE(double2));
-*/
+
 // =================================================================================================
 
 // Add more here ...
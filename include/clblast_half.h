@@ -0,0 +1,105 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file provides conversions between the 32-bit 'float' data-type and the 16-bit OpenCL
+// 'cl_half' data-type, which is used on the host to store half-precision values for the
+// half-precision routines. The host has no native half-precision arithmetic, so values are
+// converted to single-precision to be computed with. This header can be used from both C and C++.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_HALF_H_
+#define CLBLAST_HALF_H_
+
+// Includes the normal OpenCL C header
+#if defined(__APPLE__) || defined(__MACOSX)
+  #include <OpenCL/opencl.h>
+#else
+  #include <CL/opencl.h>
+#endif
+
+// =================================================================================================
+
+// Converts a 32-bit float into a 16-bit half, rounding to the nearest value (ties to even). Values
+// too large for half-precision become infinity, values too small become (signed) zero.
+static inline cl_half FloatToHalf(const float value) {
+  union { float f; cl_uint u; } bits;
+  cl_uint sign, exponent, mantissa, result, remainder, halfway;
+  int half_exponent, shift;
+  bits.f = value;
+  sign = (bits.u >> 16) & 0x8000;
+  exponent = (bits.u >> 23) & 0xFF;
+  mantissa = bits.u & 0x7FFFFF;
+
+  // Infinity and NaN (keeping a quiet NaN a NaN)
+  if (exponent == 0xFF) {
+    return (cl_half)(sign | 0x7C00 | ((mantissa != 0) ? 0x200 : 0));
+  }
+
+  // Overflow to infinity
+  half_exponent = (int)exponent - 127 + 15;
+  if (half_exponent >= 0x1F) { return (cl_half)(sign | 0x7C00); }
+
+  // Denormalised numbers (or zero), including the implicit leading one of the float mantissa
+  if (half_exponent <= 0) {
+    if (half_exponent < -10) { return (cl_half)sign; }
+    mantissa |= 0x800000;
+    shift = 14 - half_exponent;
+    result = mantissa >> shift;
+    remainder = mantissa & ((1u << shift) - 1);
+    halfway = 1u << (shift - 1);
+    if (remainder > halfway || (remainder == halfway && (result & 1))) { result++; }
+    return (cl_half)(sign | result);
+  }
+
+  // Normalised numbers: a carry of the rounding correctly moves into the exponent
+  result = ((cl_uint)half_exponent << 10) | (mantissa >> 13);
+  remainder = mantissa & 0x1FFF;
+  if (remainder > 0x1000 || (remainder == 0x1000 && (result & 1))) { result++; }
+  return (cl_half)(sign | result);
+}
+
+// Converts a 16-bit half into a 32-bit float. This conversion is exact.
+static inline float HalfToFloat(const cl_half value) {
+  union { float f; cl_uint u; } bits;
+  cl_uint sign = ((cl_uint)value & 0x8000) << 16;
+  cl_uint exponent = ((cl_uint)value >> 10) & 0x1F;
+  cl_uint mantissa = (cl_uint)value & 0x3FF;
+
+  // Infinity and NaN
+  if (exponent == 0x1F) {
+    bits.u = sign | 0x7F800000 | (mantissa << 13);
+  }
+
+  // Normalised numbers
+  else if (exponent != 0) {
+    bits.u = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+  }
+
+  // Zero
+  else if (mantissa == 0) {
+    bits.u = sign;
+  }
+
+  // Denormalised numbers: these are normalised numbers in single-precision
+  else {
+    exponent = 127 - 15 + 1;
+    while ((mantissa & 0x400) == 0) {
+      mantissa <<= 1;
+      exponent--;
+    }
+    bits.u = sign | (exponent << 23) | ((mantissa & 0x3FF) << 13);
+  }
+  return bits.f;
+}
+
+// =================================================================================================
+
+// CLBLAST_HALF_H_
+#endif
@@ -169,6 +169,10 @@ class Device: public Object {
   std::string Extensions()  const { return GetInfoString(CL_DEVICE_EXTENSIONS); }
   size_t MaxWorkGroupSize() const { return GetInfo<size_t>(CL_DEVICE_MAX_WORK_GROUP_SIZE); }
   cl_ulong LocalMemSize()   const { return GetInfo<cl_ulong>(CL_DEVICE_LOCAL_MEM_SIZE); }
+  cl_uint ComputeUnits()    const { return GetInfo<cl_uint>(CL_DEVICE_MAX_COMPUTE_UNITS); }
+  cl_uint ClockFrequency()  const { return GetInfo<cl_uint>(CL_DEVICE_MAX_CLOCK_FREQUENCY); }
+  cl_uint MemBaseAddrAlign() const { return GetInfo<cl_uint>(CL_DEVICE_MEM_BASE_ADDR_ALIGN); }
+  bool HostUnifiedMemory() const { return GetInfo<cl_bool>(CL_DEVICE_HOST_UNIFIED_MEMORY); }
   cl_uint MaxWorkItemDimensions() const {
     return GetInfo<cl_uint>(CL_DEVICE_MAX_WORK_ITEM_DIMENSIONS);
   }
@@ -176,6 +180,23 @@ class Device: public Object {
     return GetInfoVector<size_t>(CL_DEVICE_MAX_WORK_ITEM_SIZES);
   }
 
+  // Partitions the device into sub-devices along an affinity domain (e.g. NUMA nodes). Note that
+  // this function can throw exceptions and that the sub-devices have to be released manually.
+  std::vector<Device> CreateSubDevices(const cl_device_affinity_domain domain) const {
+    const cl_device_partition_property properties[] = {
+      CL_DEVICE_PARTITION_BY_AFFINITY_DOMAIN, static_cast<cl_device_partition_property>(domain), 0
+    };
+    auto num_devices = cl_uint{0};
+    auto status = clCreateSubDevices(device_, properties, 0, nullptr, &num_devices);
+    if (status != CL_SUCCESS) { Error(status); }
+    auto devices = std::vector<cl_device_id>(num_devices);
+    status = clCreateSubDevices(device_, properties, num_devices, devices.data(), nullptr);
+    if (status != CL_SUCCESS) { Error(status); }
+    auto result = std::vector<Device>();
+    for (auto &device: devices) { result.push_back(Device(device)); }
+    return result;
+  }
+
   // Configuration-validity checks
   bool IsLocalMemoryValid(const size_t local_mem_usage) const {
     return (local_mem_usage <= LocalMemSize());
@@ -241,6 +262,14 @@ class Context: public ObjectWithState {
     context_ = clCreateContext(nullptr, 1, &dev, nullptr, nullptr, &status);
     if (status != CL_SUCCESS) { Error(status); }
   }
+  explicit Context(const std::vector<Device> &devices) {
+    auto status = CL_SUCCESS;
+    auto devs = std::vector<cl_device_id>();
+    for (auto &device: devices) { devs.push_back(device()); }
+    context_ = clCreateContext(nullptr, static_cast<cl_uint>(devs.size()), devs.data(),
+                               nullptr, nullptr, &status);
+    if (status != CL_SUCCESS) { Error(status); }
+  }
   ~Context() {
     clReleaseContext(context_);
   }
@@ -411,6 +440,16 @@ class CommandQueue: public ObjectWithState {
     return clEnqueueNDRangeKernel(queue_, kernel(), static_cast<cl_uint>(global.size()), nullptr,
                                   global.data(), local.data(), 0, nullptr, &(event()));
   }
+  cl_int EnqueueKernel(const Kernel &kernel, const std::vector<size_t> &global,
+                       const std::vector<size_t> &local, Event &event,
+                       const std::vector<Event> &wait_for_events) {
+    if (wait_for_events.empty()) { return EnqueueKernel(kernel, global, local, event); }
+    auto events = std::vector<cl_event>();
+    for (auto &wait_event: wait_for_events) { events.push_back(wait_event()); }
+    return clEnqueueNDRangeKernel(queue_, kernel(), static_cast<cl_uint>(global.size()), nullptr,
+                                  global.data(), local.data(),
+                                  static_cast<cl_uint>(events.size()), events.data(), &(event()));
+  }
   Context GetContext() const {
     auto bytes = size_t{0};
     clGetCommandQueueInfo(queue_, CL_QUEUE_CONTEXT, 0, nullptr, &bytes);
@@ -425,6 +464,12 @@ class CommandQueue: public ObjectWithState {
     clGetCommandQueueInfo(queue_, CL_QUEUE_DEVICE, bytes, &result, nullptr);
     return Device(result);
   }
+  cl_int EnqueueMarker(Event &event) {
+    return clEnqueueMarkerWithWaitList(queue_, 0, nullptr, &(event()));
+  }
+  cl_int Flush() {
+    return clFlush(queue_);
+  }
   cl_int Finish() {
     return clFinish(queue_);
   }
@@ -452,6 +497,19 @@ class Buffer: public ObjectWithState {
     buffer_ = clCreateBuffer(context(), flags, bytes, nullptr, &status);
     if (status != CL_SUCCESS) { Error(status); }
   }
+  explicit Buffer(const Context &context, const cl_mem_flags flags, const size_t bytes,
+                  void* host) {
+    auto status = CL_SUCCESS;
+    buffer_ = clCreateBuffer(context(), flags | CL_MEM_USE_HOST_PTR, bytes, host, &status);
+    if (status != CL_SUCCESS) { Error(status); }
+  }
+  explicit Buffer(const Buffer &parent, const cl_mem_flags flags, const size_t origin,
+                  const size_t bytes) {
+    auto status = CL_SUCCESS;
+    const cl_buffer_region region = {origin, bytes};
+    buffer_ = clCreateSubBuffer(parent(), flags, CL_BUFFER_CREATE_TYPE_REGION, &region, &status);
+    if (status != CL_SUCCESS) { Error(status); }
+  }
   ~Buffer() {
     clReleaseMemObject(buffer_);
   }
@@ -477,6 +535,11 @@ class Buffer: public ObjectWithState {
     return ReadBuffer(queue, bytes, host.data());
   }
   template <typename T>
+  cl_int ReadBufferAsync(const CommandQueue &queue, const size_t bytes, T* host, Event &event) {
+    return clEnqueueReadBuffer(queue(), buffer_, CL_FALSE, 0, bytes, host, 0, nullptr,
+                               &(event()));
+  }
+  template <typename T>
   cl_int WriteBuffer(const CommandQueue &queue, const size_t bytes, const T* host) {
     return clEnqueueWriteBuffer(queue(), buffer_, CL_TRUE, 0, bytes, host, 0, nullptr, nullptr);
   }
@@ -484,6 +547,33 @@ class Buffer: public ObjectWithState {
   cl_int WriteBuffer(const CommandQueue &queue, const size_t bytes, const std::vector<T> &host) {
     return WriteBuffer(queue, bytes, &host[0]);
   }
+  template <typename T>
+  cl_int WriteBufferAsync(const CommandQueue &queue, const size_t bytes, const T* host,
+                          Event &event) {
+    return clEnqueueWriteBuffer(queue(), buffer_, CL_FALSE, 0, bytes, host, 0, nullptr,
+                                &(event()));
+  }
+  void* MapBuffer(const CommandQueue &queue, const cl_map_flags flags, const size_t bytes) {
+    auto status = CL_SUCCESS;
+    auto host = clEnqueueMapBuffer(queue(), buffer_, CL_TRUE, flags, 0, bytes, 0, nullptr, nullptr,
+                                   &status);
+    if (status != CL_SUCCESS) { Error(status); }
+    return host;
+  }
+  cl_int UnmapBuffer(const CommandQueue &queue, void* host) {
+    return clEnqueueUnmapMemObject(queue(), buffer_, host, 0, nullptr, nullptr);
+  }
+  template <typename T> // Copies a 2D region, sizes/offsets/leading-dimensions given in elements
+  cl_int CopyToRect(const CommandQueue &queue, const size_t one, const size_t two,
+                    const size_t offset, const size_t ld,
+                    const Buffer &destination, const size_t dest_offset,
+                    const size_t dest_ld) const {
+    const size_t origin[3] = {(offset % ld)*sizeof(T), offset / ld, 0};
+    const size_t dest_origin[3] = {(dest_offset % dest_ld)*sizeof(T), dest_offset / dest_ld, 0};
+    const size_t region[3] = {one*sizeof(T), two, 1};
+    return clEnqueueCopyBufferRect(queue(), buffer_, destination(), origin, dest_origin, region,
+                                   ld*sizeof(T), 0, dest_ld*sizeof(T), 0, 0, nullptr, nullptr);
+  }
   size_t GetSize() const {
     auto bytes = size_t{0};
     auto status = clGetMemObjectInfo(buffer_, CL_MEM_SIZE, 0, nullptr, &bytes);
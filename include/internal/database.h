@@ -54,12 +54,24 @@ class Database {
 
   // The database consists of separate database entries, stored together in a vector
   static const DatabaseEntry XaxpySingle, XaxpyDouble, XaxpyComplexSingle, XaxpyComplexDouble;
+  static const DatabaseEntry XscalSingle, XscalDouble, XscalComplexSingle, XscalComplexDouble;
+  static const DatabaseEntry XcopySingle, XcopyDouble, XcopyComplexSingle, XcopyComplexDouble;
+  static const DatabaseEntry XswapSingle, XswapDouble, XswapComplexSingle, XswapComplexDouble;
+  static const DatabaseEntry XrotSingle, XrotDouble;
+  static const DatabaseEntry XdotSingle, XdotDouble, XdotComplexSingle, XdotComplexDouble;
+  static const DatabaseEntry XamaxSingle, XamaxDouble, XamaxComplexSingle, XamaxComplexDouble;
   static const DatabaseEntry XgemvSingle, XgemvDouble, XgemvComplexSingle, XgemvComplexDouble;
+  static const DatabaseEntry XgerSingle, XgerDouble, XgerComplexSingle, XgerComplexDouble;
+  static const DatabaseEntry XsymvSingle, XsymvDouble, XsymvComplexSingle, XsymvComplexDouble;
+  static const DatabaseEntry XgbmvSingle, XgbmvDouble, XgbmvComplexSingle, XgbmvComplexDouble;
+  static const DatabaseEntry XspmvSingle, XspmvDouble, XspmvComplexSingle, XspmvComplexDouble;
   static const DatabaseEntry XgemmSingle, XgemmDouble, XgemmComplexSingle, XgemmComplexDouble;
   static const DatabaseEntry CopySingle, CopyDouble, CopyComplexSingle, CopyComplexDouble;
   static const DatabaseEntry PadSingle, PadDouble, PadComplexSingle, PadComplexDouble;
   static const DatabaseEntry TraSingle, TraDouble, TraComplexSingle, TraComplexDouble;
   static const DatabaseEntry PadTraSingle, PadTraDouble, PadTraComplexSingle, PadTraComplexDouble;
+  static const DatabaseEntry XaxpyHalf, XgemvHalf, XgemmHalf;
+  static const DatabaseEntry CopyHalf, PadHalf, TraHalf, PadTraHalf;
   static const std::vector<DatabaseEntry> database;
 
   // The constructor
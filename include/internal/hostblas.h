@@ -0,0 +1,277 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file provides a native host backend: multi-threaded C++ implementations of the supported
+// routines operating on host memory. It serves two purposes:
+// - Computing routines when no OpenCL device is available at all (see 'GemmHost').
+// - Computing small problems on devices which share their memory with the host (CPUs and integrated
+//   GPUs), for which mapping the buffers is cheaper than compiling and launching a kernel.
+// All matrices are processed in column-major layout: row-major problems are first converted into
+// their equivalent column-major problem. The inner loops are unit-stride, such that the compiler
+// can vectorise them.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_HOSTBLAS_H_
+#define CLBLAST_HOSTBLAS_H_
+
+#include <string>
+#include <vector>
+
+#include "internal/utilities.h"
+
+namespace clblast {
+// =================================================================================================
+
+// Problems with at most this amount of work (in multiply-add operations) are computed by the host
+// backend on devices sharing their memory with the host. The default can be overridden through the
+// CLBLAST_HOST_THRESHOLD environmental variable (e.g. based on results of the performance clients),
+// where a value of zero disables the host backend.
+constexpr size_t kHostBackendThreshold = 64*64*64;
+size_t HostBackendThreshold();
+
+// =================================================================================================
+
+// Maps OpenCL buffers into host memory for the lifetime of this object, such that the host backend
+// can operate on them directly. A buffer passed more than once (aliasing) is mapped only once.
+class HostMapping {
+ public:
+  HostMapping(const CommandQueue &queue, const std::vector<Buffer> &buffers);
+  ~HostMapping();
+  HostMapping(const HostMapping&) = delete;
+  HostMapping& operator=(const HostMapping&) = delete;
+
+  // Retrieves the host pointer of the buffer at 'index', moved forward by 'offset' elements
+  template <typename T>
+  T* Get(const size_t index, const size_t offset) const {
+    return static_cast<T*>(pointers_[index]) + offset;
+  }
+
+ private:
+  void Unmap();
+
+  CommandQueue queue_;
+  std::vector<Buffer> buffers_;
+  std::vector<void*> pointers_;
+  std::vector<bool> owners_;
+};
+
+// =================================================================================================
+
+// Level-1 and level-2 routines
+template <typename T>
+void HostAxpy(const size_t n, const T alpha,
+              const T* x, const size_t x_inc,
+              T* y, const size_t y_inc);
+template <typename T>
+void HostScal(const size_t n, const T alpha,
+              T* x, const size_t x_inc);
+template <typename T>
+void HostCopy(const size_t n,
+              const T* x, const size_t x_inc,
+              T* y, const size_t y_inc);
+template <typename T>
+void HostSwap(const size_t n,
+              T* x, const size_t x_inc,
+              T* y, const size_t y_inc);
+template <typename T>
+void HostRot(const size_t n,
+             T* x, const size_t x_inc,
+             T* y, const size_t y_inc,
+             const T c, const T s);
+template <typename T>
+void HostRotm(const size_t n,
+              T* x, const size_t x_inc,
+              T* y, const size_t y_inc,
+              const T* param);
+template <typename T>
+void HostDot(const size_t n, T* dot,
+             const T* x, const size_t x_inc,
+             const T* y, const size_t y_inc,
+             const bool do_conjugate);
+template <typename T>
+void HostDsdot(const size_t n, T* dot,
+               const float* x, const size_t x_inc,
+               const float* y, const size_t y_inc,
+               const float sb);
+template <typename T>
+void HostNrm2(const size_t n, T* nrm2,
+              const T* x, const size_t x_inc);
+template <typename T>
+void HostAsum(const size_t n, T* asum,
+              const T* x, const size_t x_inc);
+template <typename T>
+void HostAmax(const size_t n, unsigned int* imax,
+              const T* x, const size_t x_inc,
+              const bool do_min);
+template <typename T>
+void HostGemv(const Layout layout, const Transpose a_transpose,
+              const size_t m, const size_t n, const T alpha,
+              const T* a, const size_t a_ld,
+              const T* x, const size_t x_inc, const T beta,
+              T* y, const size_t y_inc);
+template <typename T>
+void HostGer(const Layout layout,
+             const size_t m, const size_t n, const T alpha,
+             const T* x, const size_t x_inc,
+             const T* y, const size_t y_inc,
+             T* a, const size_t a_ld,
+             const bool do_conjugate);
+template <typename T>
+void HostSymv(const Layout layout, const Triangle triangle,
+              const size_t n, const T alpha,
+              const T* a, const size_t a_ld,
+              const T* x, const size_t x_inc, const T beta,
+              T* y, const size_t y_inc,
+              const bool is_hermitian);
+template <typename T>
+void HostTrmv(const Layout layout, const Triangle triangle,
+              const Transpose a_transpose, const Diagonal diagonal,
+              const size_t n,
+              const T* a, const size_t a_ld,
+              T* x, const size_t x_inc);
+template <typename T>
+void HostTrsv(const Layout layout, const Triangle triangle,
+              const Transpose a_transpose, const Diagonal diagonal,
+              const size_t n,
+              const T* a, const size_t a_ld,
+              T* x, const size_t x_inc);
+template <typename T>
+void HostGbmv(const Layout layout, const Transpose a_transpose,
+              const size_t m, const size_t n, const size_t kl, const size_t ku, const T alpha,
+              const T* a, const size_t a_ld,
+              const T* x, const size_t x_inc, const T beta,
+              T* y, const size_t y_inc);
+template <typename T>
+void HostSbmv(const Layout layout, const Triangle triangle,
+              const size_t n, const size_t k, const T alpha,
+              const T* a, const size_t a_ld,
+              const T* x, const size_t x_inc, const T beta,
+              T* y, const size_t y_inc,
+              const bool is_hermitian);
+template <typename T>
+void HostTbmv(const Layout layout, const Triangle triangle,
+              const Transpose a_transpose, const Diagonal diagonal,
+              const size_t n, const size_t k,
+              const T* a, const size_t a_ld,
+              T* x, const size_t x_inc);
+template <typename T>
+void HostTbsv(const Layout layout, const Triangle triangle,
+              const Transpose a_transpose, const Diagonal diagonal,
+              const size_t n, const size_t k,
+              const T* a, const size_t a_ld,
+              T* x, const size_t x_inc);
+
+template <typename T>
+void HostSpmv(const Layout layout, const Triangle triangle,
+              const size_t n, const T alpha,
+              const T* ap,
+              const T* x, const size_t x_inc, const T beta,
+              T* y, const size_t y_inc,
+              const bool is_hermitian);
+template <typename T>
+void HostTpmv(const Layout layout, const Triangle triangle,
+              const Transpose a_transpose, const Diagonal diagonal,
+              const size_t n,
+              const T* ap,
+              T* x, const size_t x_inc);
+template <typename T>
+void HostTpsv(const Layout layout, const Triangle triangle,
+              const Transpose a_transpose, const Diagonal diagonal,
+              const size_t n,
+              const T* ap,
+              T* x, const size_t x_inc);
+template <typename T>
+void HostSpr(const Layout layout, const Triangle triangle,
+             const size_t n, const T alpha,
+             const T* x, const size_t x_inc,
+             T* ap,
+             const bool is_hermitian);
+template <typename T>
+void HostSyr2(const Layout layout, const Triangle triangle,
+              const size_t n, const T alpha,
+              const T* x, const size_t x_inc,
+              const T* y, const size_t y_inc,
+              T* a, const size_t a_ld,
+              const bool is_rank_two, const bool is_hermitian);
+
+// Level-3 routines
+template <typename T>
+void HostGemm(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+              const size_t m, const size_t n, const size_t k, const T alpha,
+              const T* a, const size_t a_ld,
+              const T* b, const size_t b_ld, const T beta,
+              T* c, const size_t c_ld);
+template <typename T>
+void HostSymm(const Layout layout, const Side side, const Triangle triangle,
+              const size_t m, const size_t n, const T alpha,
+              const T* a, const size_t a_ld,
+              const T* b, const size_t b_ld, const T beta,
+              T* c, const size_t c_ld);
+template <typename T>
+void HostHemm(const Layout layout, const Side side, const Triangle triangle,
+              const size_t m, const size_t n, const T alpha,
+              const T* a, const size_t a_ld,
+              const T* b, const size_t b_ld, const T beta,
+              T* c, const size_t c_ld);
+template <typename T>
+void HostSyrk(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+              const size_t n, const size_t k, const T alpha,
+              const T* a, const size_t a_ld, const T beta,
+              T* c, const size_t c_ld);
+template <typename T, typename U>
+void HostHerk(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+              const size_t n, const size_t k, const U alpha,
+              const T* a, const size_t a_ld, const U beta,
+              T* c, const size_t c_ld);
+template <typename T>
+void HostSyr2k(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+               const size_t n, const size_t k, const T alpha,
+               const T* a, const size_t a_ld,
+               const T* b, const size_t b_ld, const T beta,
+               T* c, const size_t c_ld);
+template <typename T, typename U>
+void HostHer2k(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+               const size_t n, const size_t k, const T alpha,
+               const T* a, const size_t a_ld,
+               const T* b, const size_t b_ld, const U beta,
+               T* c, const size_t c_ld);
+template <typename T>
+void HostTrmm(const Layout layout, const Side side, const Triangle triangle,
+              const Transpose a_transpose, const Diagonal diagonal,
+              const size_t m, const size_t n, const T alpha,
+              const T* a, const size_t a_ld,
+              T* b, const size_t b_ld);
+
+// =================================================================================================
+
+// Half-precision versions of some of the above: as the host has no half-precision arithmetic, these
+// convert the data into single-precision and back
+template <>
+void HostAxpy<half>(const size_t n, const half alpha,
+                    const half* x, const size_t x_inc,
+                    half* y, const size_t y_inc);
+template <>
+void HostGemv<half>(const Layout layout, const Transpose a_transpose,
+                    const size_t m, const size_t n, const half alpha,
+                    const half* a, const size_t a_ld,
+                    const half* x, const size_t x_inc, const half beta,
+                    half* y, const size_t y_inc);
+template <>
+void HostGemm<half>(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                    const size_t m, const size_t n, const size_t k, const half alpha,
+                    const half* a, const size_t a_ld,
+                    const half* b, const size_t b_ld, const half beta,
+                    half* c, const size_t c_ld);
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_HOSTBLAS_H_
+#endif
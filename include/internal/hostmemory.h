@@ -0,0 +1,104 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file provides support for running routines directly on matrices in host memory. On devices
+// which share their memory with the host (CPUs and integrated GPUs), the host memory is wrapped in
+// OpenCL buffers using CL_MEM_USE_HOST_PTR, such that no copies are made (zero-copy). On other
+// devices, the computation is split into chunks along the largest dimension of C. The transfers of
+// the next and previous chunks (on a separate transfer queue, through pinned staging buffers) then
+// overlap with the computation of the current chunk. Small problems are computed by the host
+// backend instead, as are all problems if no device is available.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_HOSTMEMORY_H_
+#define CLBLAST_HOSTMEMORY_H_
+
+#include <string>
+#include <vector>
+
+#include "internal/utilities.h"
+#include "internal/routines/level3/xgemm.h"
+
+namespace clblast {
+// =================================================================================================
+
+// The Xgemm routine operating on host memory
+template <typename T>
+class XgemmHost {
+ public:
+  XgemmHost(CommandQueue &queue, Event &event);
+
+  // Compiles the kernels
+  StatusCode SetUp();
+
+  // Templated-precision implementation of the routine
+  StatusCode DoGemm(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                    const size_t m, const size_t n, const size_t k,
+                    const T alpha,
+                    const T* a, const size_t a_ld,
+                    const T* b, const size_t b_ld,
+                    const T beta,
+                    T* c, const size_t c_ld);
+
+  // The two versions selected by the main routine above: the zero-copy version for devices sharing
+  // their memory with the host and the version for discrete devices, pipelining transfers and
+  // computation. These are public such that both can be tested on any device. The arguments are
+  // assumed to be tested already.
+  StatusCode DoGemmZeroCopy(const Layout layout,
+                            const Transpose a_transpose, const Transpose b_transpose,
+                            const size_t m, const size_t n, const size_t k,
+                            const T alpha,
+                            const T* a, const size_t a_ld,
+                            const T* b, const size_t b_ld,
+                            const T beta,
+                            T* c, const size_t c_ld);
+  StatusCode DoGemmPipelined(const Layout layout,
+                             const Transpose a_transpose, const Transpose b_transpose,
+                             const size_t m, const size_t n, const size_t k,
+                             const T alpha,
+                             const T* a, const size_t a_ld,
+                             const T* b, const size_t b_ld,
+                             const T beta,
+                             T* c, const size_t c_ld);
+
+ private:
+  // Settings for the chunks: each chunk is at least 'kMinChunkSize' rows or columns
+  static constexpr size_t kMinChunkSize = 256;
+  static constexpr size_t kMaxNumChunks = 8;
+  static constexpr size_t kNumStages = 2;
+
+  // The OpenCL objects
+  CommandQueue queue_;
+  const Context context_;
+  const Device device_;
+
+  // The regular routine operating on OpenCL buffers
+  Xgemm<T> routine_;
+};
+
+// =================================================================================================
+
+// Computes GEMM on host memory without any OpenCL device, using only the host backend (see the
+// 'hostblas.h' header). This is used when no command-queue is passed to the GemmHost function.
+template <typename T>
+StatusCode GemmWithoutDevice(const Layout layout,
+                             const Transpose a_transpose, const Transpose b_transpose,
+                             const size_t m, const size_t n, const size_t k,
+                             const T alpha,
+                             const T* a, const size_t a_ld,
+                             const T* b, const size_t b_ld,
+                             const T beta,
+                             T* c, const size_t c_ld);
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_HOSTMEMORY_H_
+#endif
@@ -0,0 +1,119 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file provides support for running a single routine on multiple devices at once. The devices
+// should share a single OpenCL context, such that the user's buffers are accessible by all of them.
+// These can be separate devices (e.g. multiple GPUs) or sub-devices of a single device (e.g. the
+// NUMA nodes of a multi-socket CPU, see 'CreateNumaSubDevices' below).
+// The work is partitioned proportionally to the (estimated or measured) throughput of each device.
+// Each device computes its part of the output into a private temporary buffer, after which the
+// results are copied into the user's output buffer. This avoids concurrent writes to a single
+// OpenCL buffer from multiple devices, which is undefined behaviour according to the standard.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_MULTIDEVICE_H_
+#define CLBLAST_MULTIDEVICE_H_
+
+#include <string>
+#include <vector>
+
+#include "internal/utilities.h"
+#include "internal/routines/level1/xaxpy.h"
+#include "internal/routines/level3/xgemm.h"
+
+namespace clblast {
+// =================================================================================================
+
+// Partitions 'size' into one part per device, proportional to each device's throughput for the
+// given routine. All parts (except for the last one) are a multiple of 'granularity'. Parts can be
+// zero.
+std::vector<size_t> PartitionWork(const size_t size, const std::vector<Device> &devices,
+                                  const size_t granularity, const std::string &routine_name);
+
+// Stores the measured throughput of a device for a routine, used to improve later partitionings
+void RecordThroughput(const Device &device, const std::string &routine_name,
+                      const double throughput);
+
+// Partitions a device into sub-devices, one per NUMA node. If this is not supported, the device is
+// partitioned along the next partitionable affinity domain instead (e.g. caches). Throws an
+// exception if the device cannot be partitioned at all.
+std::vector<Device> CreateNumaSubDevices(const Device &device);
+
+// =================================================================================================
+
+// The Xaxpy routine spread over multiple devices: vector Y is split into non-overlapping
+// sub-buffers, aligned to the devices' base-address alignment. A strided vector Y is processed on a
+// single device.
+template <typename T>
+class XaxpyMultiDevice {
+ public:
+  XaxpyMultiDevice(std::vector<CommandQueue> &queues, Event &event);
+
+  // Compiles the kernels for all devices
+  StatusCode SetUp();
+
+  // Templated-precision implementation of the routine
+  StatusCode DoAxpy(const size_t n, const T alpha,
+                    const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                    const Buffer &y_buffer, const size_t y_offset, const size_t y_inc);
+
+ private:
+  // The amount of elements a device's part is a multiple of (before alignment)
+  static constexpr size_t kGranularity = 4096;
+
+  // The OpenCL objects (see the XgemmMultiDevice class below)
+  std::vector<CommandQueue> queues_;
+  std::vector<Device> devices_;
+  Event &event_;
+
+  // One regular single-device routine per queue
+  std::vector<Xaxpy<T>> routines_;
+};
+
+// =================================================================================================
+
+// The Xgemm routine spread over multiple devices: C is split into row-blocks (row-major layout) or
+// column-blocks (column-major layout), such that each device's part of C is contiguous in memory.
+template <typename T>
+class XgemmMultiDevice {
+ public:
+  XgemmMultiDevice(std::vector<CommandQueue> &queues, Event &event);
+
+  // Compiles the kernels for all devices
+  StatusCode SetUp();
+
+  // Templated-precision implementation of the routine
+  StatusCode DoGemm(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                    const size_t m, const size_t n, const size_t k,
+                    const T alpha,
+                    const Buffer &a_buffer, const size_t a_offset, const size_t a_ld,
+                    const Buffer &b_buffer, const size_t b_offset, const size_t b_ld,
+                    const T beta,
+                    const Buffer &c_buffer, const size_t c_offset, const size_t c_ld);
+
+ private:
+  // The amount of rows/columns of C a device's part is a multiple of
+  static constexpr size_t kGranularity = 64;
+
+  // The OpenCL objects: one queue and device per part of the work. The event is a reference, such
+  // that the combined completion event is passed back to the caller.
+  std::vector<CommandQueue> queues_;
+  std::vector<Device> devices_;
+  Event &event_;
+
+  // One regular single-device routine per queue
+  std::vector<Xgemm<T>> routines_;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_MULTIDEVICE_H_
+#endif
@@ -29,17 +29,22 @@ namespace clblast {
 class Routine {
  public:
 
-  // The cache of compiled OpenCL programs, along with some meta-data
+  // The cache of compiled OpenCL programs, along with some meta-data. A program is only valid for
+  // the context and the device it was built for: identical devices (or the sub-devices of a single
+  // device) share a name, so these are identified by their OpenCL handles instead. These handles
+  // stay valid, since the cached program retains its context, which in turn retains its devices.
   struct ProgramCache {
     Program program;
-    std::string device_name;
+    cl_context context;
+    cl_device_id device;
     Precision precision;
     std::string routine_name_;
 
     // Finds out whether the properties match
-    bool MatchInCache(const std::string &ref_device, const Precision &ref_precision,
-                      const std::string &ref_routine) {
-      return (device_name == ref_device &&
+    bool MatchInCache(const cl_context ref_context, const cl_device_id ref_device,
+                      const Precision &ref_precision, const std::string &ref_routine) {
+      return (context == ref_context &&
+              device == ref_device &&
               precision == ref_precision &&
               routine_name_ == ref_routine);
     }
@@ -60,9 +65,17 @@ class Routine {
 
  protected:
   
-  // Runs a kernel given the global and local thread sizes
+  // Runs a kernel given the global and local thread sizes. Without waiting for its completion, a
+  // sequence of dependent kernels can be chained on the queue: each kernel then has to be given the
+  // event of its predecessor, since the queue might execute out-of-order.
   StatusCode RunKernel(const Kernel &kernel, std::vector<size_t> &global,
-                       const std::vector<size_t> &local);
+                       const std::vector<size_t> &local, const bool wait = true,
+                       const std::vector<Event> &wait_for_events = {});
+
+  // Runs the XgemmUpper or XgemmLower kernel on n_ceiled by n_ceiled matrices. Work-groups are only
+  // launched for the tiles of C containing elements of the triangle (see the kernel for details).
+  StatusCode RunTriangularKernel(const Kernel &kernel, const size_t n_ceiled,
+                                 const Triangle triangle);
 
   // Tests for valid inputs of matrices A, B, and C
   StatusCode TestMatrixA(const size_t one, const size_t two, const Buffer &buffer,
@@ -72,12 +85,24 @@ class Routine {
   StatusCode TestMatrixC(const size_t one, const size_t two, const Buffer &buffer,
                          const size_t offset, const size_t ld, const size_t data_size);
 
+  // Tests for a valid input of a packed matrix AP, holding the triangle of an n-by-n matrix
+  StatusCode TestMatrixAP(const size_t n, const Buffer &buffer, const size_t offset,
+                          const size_t data_size);
+
   // Tests for valid inputs of vectors X and Y
   StatusCode TestVectorX(const size_t n, const Buffer &buffer, const size_t offset,
                          const size_t inc, const size_t data_size);
   StatusCode TestVectorY(const size_t n, const Buffer &buffer, const size_t offset,
                          const size_t inc, const size_t data_size);
 
+  // Tests for a valid single-value output of a reduction (e.g. the result of a dot-product)
+  StatusCode TestVectorScalar(const size_t n, const Buffer &buffer, const size_t offset,
+                              const size_t data_size);
+
+  // Whether or not to compute a problem with the given amount of work (in multiply-add operations)
+  // with the host backend (see internal/hostblas.h) instead of on the device
+  bool UseHostBackend(const size_t work) const;
+
   // Copies/transposes a matrix and padds/unpads it with zeroes. This method is also able to write
   // to symmetric and triangular matrices through optional arguments.
   StatusCode PadCopyTransposeMatrix(const size_t src_one, const size_t src_two,
@@ -112,7 +137,6 @@ class Routine {
   const Device device_;
 
   // OpenCL device properties
-  const std::string device_name_;
   const cl_uint max_work_item_dimensions_;
   const std::vector<size_t> max_work_item_sizes_;
   const size_t max_work_group_size_;
@@ -0,0 +1,46 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xamax routine. The precision is implemented using a template argument.
+// It finds the index of the element with the maximum absolute value (or the minimum, see Xamin)
+// through a two-stage reduction of (value, index) pairs, breaking ties by the lowest index. The
+// zero-based index is stored as an unsigned integer in a device buffer. For complex data-types,
+// the absolute value is computed as the sum of the absolute values of the real and imaginary part.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XAMAX_H_
+#define CLBLAST_ROUTINES_XAMAX_H_
+
+#include "internal/routine.h"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xamax: public Routine {
+ public:
+  Xamax(CommandQueue &queue, Event &event);
+
+  // Templated-precision implementation of the routine
+  StatusCode DoAmax(const size_t n,
+                    const Buffer &imax_buffer, const size_t imax_offset,
+                    const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                    const bool do_min = false);
+
+ private:
+  // Static variable to get the precision
+  const static Precision precision_;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XAMAX_H_
+#endif
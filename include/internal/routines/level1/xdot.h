@@ -0,0 +1,46 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xdot routine. The precision is implemented using a template argument.
+// The dot-product is computed in two stages: a first kernel computes partial sums per work-group,
+// after which a second kernel (a single work-group) reduces these into the final result. This
+// result is stored in a device buffer.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XDOT_H_
+#define CLBLAST_ROUTINES_XDOT_H_
+
+#include "internal/routine.h"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xdot: public Routine {
+ public:
+  Xdot(CommandQueue &queue, Event &event);
+
+  // Templated-precision implementation of the routine
+  StatusCode DoDot(const size_t n,
+                   const Buffer &dot_buffer, const size_t dot_offset,
+                   const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                   const Buffer &y_buffer, const size_t y_offset, const size_t y_inc,
+                   const bool do_conjugate = false);
+
+ private:
+  // Static variable to get the precision
+  const static Precision precision_;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XDOT_H_
+#endif
@@ -0,0 +1,53 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xdsdot routine, computing the dot-product of two single-precision
+// vectors with an extended-precision accumulator (DSDOT). The template argument is the type of the
+// result: double for DSDOT and float for SDSDOT (see Xsdsdot). The two-stage reduction follows the
+// Xdot routine and uses its tuning parameters. Devices without support for double precision use a
+// compensated single-precision accumulator instead.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XDSDOT_H_
+#define CLBLAST_ROUTINES_XDSDOT_H_
+
+#include <string>
+
+#include "internal/routine.h"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xdsdot: public Routine {
+ public:
+  Xdsdot(CommandQueue &queue, Event &event);
+
+  // Templated-precision implementation of the routine. The scalar 'sb' is added to the result.
+  StatusCode DoDsdot(const size_t n,
+                     const Buffer &dot_buffer, const size_t dot_offset,
+                     const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                     const Buffer &y_buffer, const size_t y_offset, const size_t y_inc,
+                     const float sb = 0.0f);
+
+ private:
+  // Static variables to get the precision of the inputs and the name of the routine
+  const static Precision precision_;
+  const static std::string name_;
+
+  // Whether or not the device supports accumulation in double precision
+  const bool use_double_;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XDSDOT_H_
+#endif
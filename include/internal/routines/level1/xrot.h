@@ -0,0 +1,45 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xrot routine. The precision is implemented using a template argument.
+// The cosine and sine of the rotation are read from device memory, e.g. as generated by Xrotg.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XROT_H_
+#define CLBLAST_ROUTINES_XROT_H_
+
+#include "internal/routine.h"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xrot: public Routine {
+ public:
+  Xrot(CommandQueue &queue, Event &event);
+
+  // Templated-precision implementation of the routine
+  StatusCode DoRot(const size_t n,
+                   const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                   const Buffer &y_buffer, const size_t y_offset, const size_t y_inc,
+                   const Buffer &c_buffer, const size_t c_offset,
+                   const Buffer &s_buffer, const size_t s_offset);
+
+ private:
+  // Static variable to get the precision
+  const static Precision precision_;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XROT_H_
+#endif
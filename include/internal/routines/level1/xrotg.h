@@ -0,0 +1,44 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xrotg routine. The precision is implemented using a template argument.
+// The rotation is generated by a single work-item, keeping all scalars in device memory.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XROTG_H_
+#define CLBLAST_ROUTINES_XROTG_H_
+
+#include "internal/routine.h"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xrotg: public Routine {
+ public:
+  Xrotg(CommandQueue &queue, Event &event);
+
+  // Templated-precision implementation of the routine
+  StatusCode DoRotg(const Buffer &a_buffer, const size_t a_offset,
+                    const Buffer &b_buffer, const size_t b_offset,
+                    const Buffer &c_buffer, const size_t c_offset,
+                    const Buffer &s_buffer, const size_t s_offset);
+
+ private:
+  // Static variable to get the precision
+  const static Precision precision_;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XROTG_H_
+#endif
@@ -0,0 +1,45 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xrotm routine. The precision is implemented using a template argument.
+// The 5-element parameter array of the modified rotation is read from device memory, e.g. as
+// generated by Xrotmg.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XROTM_H_
+#define CLBLAST_ROUTINES_XROTM_H_
+
+#include "internal/routine.h"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xrotm: public Routine {
+ public:
+  Xrotm(CommandQueue &queue, Event &event);
+
+  // Templated-precision implementation of the routine
+  StatusCode DoRotm(const size_t n,
+                    const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                    const Buffer &y_buffer, const size_t y_offset, const size_t y_inc,
+                    const Buffer &param_buffer, const size_t param_offset);
+
+ private:
+  // Static variable to get the precision
+  const static Precision precision_;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XROTM_H_
+#endif
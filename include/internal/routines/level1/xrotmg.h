@@ -0,0 +1,45 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xrotmg routine. The precision is implemented using a template argument.
+// The modified rotation is generated by a single work-item, keeping all scalars in device memory.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XROTMG_H_
+#define CLBLAST_ROUTINES_XROTMG_H_
+
+#include "internal/routine.h"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xrotmg: public Routine {
+ public:
+  Xrotmg(CommandQueue &queue, Event &event);
+
+  // Templated-precision implementation of the routine
+  StatusCode DoRotmg(const Buffer &d1_buffer, const size_t d1_offset,
+                     const Buffer &d2_buffer, const size_t d2_offset,
+                     const Buffer &x1_buffer, const size_t x1_offset,
+                     const Buffer &y1_buffer, const size_t y1_offset,
+                     const Buffer &param_buffer, const size_t param_offset);
+
+ private:
+  // Static variable to get the precision
+  const static Precision precision_;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XROTMG_H_
+#endif
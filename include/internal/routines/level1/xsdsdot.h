@@ -0,0 +1,45 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xsdsdot routine, computing the dot-product of two single-precision
+// vectors plus a scalar with an extended-precision accumulator (SDSDOT). It is based on the Xdsdot
+// routine.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XSDSDOT_H_
+#define CLBLAST_ROUTINES_XSDSDOT_H_
+
+#include "internal/routines/level1/xdsdot.h"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xsdsdot: public Xdsdot<T> {
+ public:
+
+  // Uses the regular Xdsdot routine
+  using Xdsdot<T>::DoDsdot;
+
+  // Constructor
+  Xsdsdot(CommandQueue &queue, Event &event);
+
+  // Templated-precision implementation of the routine
+  StatusCode DoSdsdot(const size_t n, const T sb,
+                      const Buffer &dot_buffer, const size_t dot_offset,
+                      const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                      const Buffer &y_buffer, const size_t y_offset, const size_t y_inc);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XSDSDOT_H_
+#endif
@@ -0,0 +1,62 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xgbmv routine. The precision is implemented using a template argument.
+// The other banded matrix-vector routines (SBMV, HBMV, TBMV and TBSV) are based on this routine as
+// well: they share its kernel, which only reads the stored diagonals of the band.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGBMV_H_
+#define CLBLAST_ROUTINES_XGBMV_H_
+
+#include "internal/routine.h"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xgbmv: public Routine {
+ public:
+  Xgbmv(CommandQueue &queue, Event &event);
+
+  // Templated-precision implementation of the routine
+  StatusCode DoGbmv(const Layout layout, const Transpose a_transpose,
+                    const size_t m, const size_t n, const size_t kl, const size_t ku,
+                    const T alpha,
+                    const Buffer &a_buffer, const size_t a_offset, const size_t a_ld,
+                    const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                    const T beta,
+                    const Buffer &y_buffer, const size_t y_offset, const size_t y_inc);
+
+ protected:
+  // Runs the Xgbmv kernel for the m-by-n matrix op(A), of which 'kl' sub-diagonals and 'ku' super-
+  // diagonals are stored (see the kernel for the meaning of the other arguments). The arguments are
+  // not tested. The band can be negative on one side to describe an off-diagonal block of a band.
+  // The kernel is started after the completion of the given events.
+  StatusCode BandMatVec(const size_t m, const size_t n, const int kl, const int ku,
+                        const T alpha, const T beta,
+                        const Buffer &a_buffer, const size_t a_offset, const size_t a_ld,
+                        const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                        const Buffer &y_buffer, const size_t y_offset, const size_t y_inc,
+                        const bool a_rotated, const bool a_conjugate, const bool is_symmetric,
+                        const bool is_hermitian, const bool unit_diagonal,
+                        const bool wait = true,
+                        const std::vector<Event> &wait_for_events = {});
+
+ private:
+  // Static variable to get the precision
+  const static Precision precision_;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGBMV_H_
+#endif
@@ -0,0 +1,58 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xsbmv routine, the matrix-vector product with a symmetric band matrix.
+// It is based on the Xgbmv routine. The Hermitian version (HBMV) is based on this routine as well.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XSBMV_H_
+#define CLBLAST_ROUTINES_XSBMV_H_
+
+#include "internal/routines/level2/xgbmv.h"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xsbmv: public Xgbmv<T> {
+ public:
+
+  // Uses several variables from the Routine class
+  using Routine::queue_;
+
+  // Uses several helper functions from the Routine class
+  using Routine::ErrorIn;
+  using Routine::TestMatrixA;
+  using Routine::TestVectorX;
+  using Routine::TestVectorY;
+  using Routine::UseHostBackend;
+
+  // Uses the regular Xgbmv kernel
+  using Xgbmv<T>::BandMatVec;
+
+  // Constructor
+  Xsbmv(CommandQueue &queue, Event &event);
+
+  // Templated-precision implementation of the routine
+  StatusCode DoSbmv(const Layout layout, const Triangle triangle,
+                    const size_t n, const size_t k,
+                    const T alpha,
+                    const Buffer &a_buffer, const size_t a_offset, const size_t a_ld,
+                    const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                    const T beta,
+                    const Buffer &y_buffer, const size_t y_offset, const size_t y_inc,
+                    const bool is_hermitian = false);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XSBMV_H_
+#endif
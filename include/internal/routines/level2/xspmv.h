@@ -0,0 +1,65 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xspmv routine, the matrix-vector product with a symmetric matrix in
+// packed storage. The precision is implemented using a template argument. The other packed-storage
+// routines (HPMV, TPMV, TPSV, SPR and HPR) are based on this routine as well: they share its
+// kernels, which compute the packed indices on the fly.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XSPMV_H_
+#define CLBLAST_ROUTINES_XSPMV_H_
+
+#include "internal/routine.h"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xspmv: public Routine {
+ public:
+  Xspmv(CommandQueue &queue, Event &event);
+
+  // Templated-precision implementation of the routine
+  StatusCode DoSpmv(const Layout layout, const Triangle triangle,
+                    const size_t n,
+                    const T alpha,
+                    const Buffer &ap_buffer, const size_t ap_offset,
+                    const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                    const T beta,
+                    const Buffer &y_buffer, const size_t y_offset, const size_t y_inc,
+                    const bool is_hermitian = false);
+
+ protected:
+  // Runs the Xspmv kernel for the m-by-n block of op(A) starting at row 'row_offset' and column
+  // 'col_offset' of the 'a_n' by 'a_n' packed matrix (see the kernel for the meaning of the other
+  // arguments). The arguments are not tested. The kernel is started after the completion of the
+  // given events.
+  StatusCode PackedMatVec(const size_t m, const size_t n, const size_t a_n,
+                          const size_t row_offset, const size_t col_offset,
+                          const T alpha, const T beta,
+                          const Buffer &ap_buffer, const size_t ap_offset,
+                          const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                          const Buffer &y_buffer, const size_t y_offset, const size_t y_inc,
+                          const bool a_rotated, const bool a_conjugate, const bool is_lower,
+                          const bool is_symmetric, const bool is_hermitian,
+                          const bool unit_diagonal, const bool wait = true,
+                          const std::vector<Event> &wait_for_events = {});
+
+ private:
+  // Static variable to get the precision
+  const static Precision precision_;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XSPMV_H_
+#endif
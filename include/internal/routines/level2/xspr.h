@@ -0,0 +1,56 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xspr routine, the rank-1 update of a symmetric matrix in packed storage.
+// It is based on the Xspmv routine, of which it uses the Xspr kernel. The Hermitian version (HPR)
+// is based on this routine as well.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XSPR_H_
+#define CLBLAST_ROUTINES_XSPR_H_
+
+#include "internal/routines/level2/xspmv.h"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xspr: public Xspmv<T> {
+ public:
+
+  // Uses several variables from the Routine class
+  using Routine::queue_;
+  using Routine::db_;
+
+  // Uses several helper functions from the Routine class
+  using Routine::ErrorIn;
+  using Routine::TestMatrixAP;
+  using Routine::TestVectorX;
+  using Routine::UseHostBackend;
+  using Routine::GetProgramFromCache;
+  using Routine::RunKernel;
+
+  // Constructor
+  Xspr(CommandQueue &queue, Event &event);
+
+  // Templated-precision implementation of the routine
+  StatusCode DoSpr(const Layout layout, const Triangle triangle,
+                   const size_t n,
+                   const T alpha,
+                   const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                   const Buffer &ap_buffer, const size_t ap_offset,
+                   const bool is_hermitian = false);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XSPR_H_
+#endif
@@ -0,0 +1,70 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xsyr routine, the rank-1 update of a symmetric matrix. It is based on
+// the Xger routine, of which it uses the tuning parameters, but runs the triangular Xsyr2 kernel
+// such that only the given triangle of A is updated. The Hermitian version (HER) and the rank-2
+// updates (SYR2 and HER2) are based on this routine as well.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XSYR_H_
+#define CLBLAST_ROUTINES_XSYR_H_
+
+#include "internal/routines/level2/xger.h"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xsyr: public Xger<T> {
+ public:
+
+  // Uses several variables from the Routine class
+  using Routine::queue_;
+  using Routine::db_;
+
+  // Uses several helper functions from the Routine class
+  using Routine::ErrorIn;
+  using Routine::TestMatrixA;
+  using Routine::TestVectorX;
+  using Routine::TestVectorY;
+  using Routine::UseHostBackend;
+  using Routine::GetProgramFromCache;
+  using Routine::RunKernel;
+
+  // Constructor
+  Xsyr(CommandQueue &queue, Event &event);
+
+  // Templated-precision implementation of the routine
+  StatusCode DoSyr(const Layout layout, const Triangle triangle,
+                   const size_t n,
+                   const T alpha,
+                   const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                   const Buffer &a_buffer, const size_t a_offset, const size_t a_ld,
+                   const bool is_hermitian = false);
+
+ protected:
+
+  // Computes the rank-1 or rank-2 update of the given triangle of A, using 'alpha2' for the second
+  // product of a rank-2 update (for a rank-1 update, Y has to be X). Also used by SYR2 and HER2.
+  StatusCode RankUpdate(const Layout layout, const Triangle triangle,
+                        const size_t n,
+                        const T alpha, const T alpha2,
+                        const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                        const Buffer &y_buffer, const size_t y_offset, const size_t y_inc,
+                        const Buffer &a_buffer, const size_t a_offset, const size_t a_ld,
+                        const bool is_rank_two, const bool is_hermitian);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XSYR_H_
+#endif
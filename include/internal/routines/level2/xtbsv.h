@@ -0,0 +1,59 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xtbsv routine, the solver for a triangular band matrix. It is based on
+// the Xgbmv routine: each diagonal block is solved by a single work-group, after which the rows
+// within the band of the solved block are updated using the Xgbmv kernel.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XTBSV_H_
+#define CLBLAST_ROUTINES_XTBSV_H_
+
+#include "internal/routines/level2/xgbmv.h"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xtbsv: public Xgbmv<T> {
+ public:
+
+  // Uses several variables from the Routine class
+  using Routine::queue_;
+  using Routine::db_;
+  using Routine::event_;
+
+  // Uses several helper functions from the Routine class
+  using Routine::ErrorIn;
+  using Routine::TestMatrixA;
+  using Routine::TestVectorX;
+  using Routine::UseHostBackend;
+  using Routine::GetProgramFromCache;
+  using Routine::RunKernel;
+
+  // Uses the regular Xgbmv kernel
+  using Xgbmv<T>::BandMatVec;
+
+  // Constructor
+  Xtbsv(CommandQueue &queue, Event &event);
+
+  // Templated-precision implementation of the routine
+  StatusCode DoTbsv(const Layout layout, const Triangle triangle,
+                    const Transpose a_transpose, const Diagonal diagonal,
+                    const size_t n, const size_t k,
+                    const Buffer &a_buffer, const size_t a_offset, const size_t a_ld,
+                    const Buffer &x_buffer, const size_t x_offset, const size_t x_inc);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XTBSV_H_
+#endif
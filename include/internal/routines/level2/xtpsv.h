@@ -0,0 +1,58 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xtpsv routine, solving a triangular system of equations with a matrix
+// in packed storage. It is based on the Xspmv routine, of which it also uses the Xtpsv kernel.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XTPSV_H_
+#define CLBLAST_ROUTINES_XTPSV_H_
+
+#include "internal/routines/level2/xspmv.h"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xtpsv: public Xspmv<T> {
+ public:
+
+  // Uses several variables from the Routine class
+  using Routine::queue_;
+  using Routine::db_;
+  using Routine::event_;
+
+  // Uses several helper functions from the Routine class
+  using Routine::ErrorIn;
+  using Routine::TestMatrixAP;
+  using Routine::TestVectorX;
+  using Routine::UseHostBackend;
+  using Routine::GetProgramFromCache;
+  using Routine::RunKernel;
+
+  // Uses the regular Xspmv kernel
+  using Xspmv<T>::PackedMatVec;
+
+  // Constructor
+  Xtpsv(CommandQueue &queue, Event &event);
+
+  // Templated-precision implementation of the routine
+  StatusCode DoTpsv(const Layout layout, const Triangle triangle,
+                    const Transpose a_transpose, const Diagonal diagonal,
+                    const size_t n,
+                    const Buffer &ap_buffer, const size_t ap_offset,
+                    const Buffer &x_buffer, const size_t x_offset, const size_t x_inc);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XTPSV_H_
+#endif
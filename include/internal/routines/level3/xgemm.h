@@ -23,18 +23,40 @@ namespace clblast {
 template <typename T>
 class Xgemm: public Routine {
  public:
-  Xgemm(CommandQueue &queue, Event &event);
 
-  // Templated-precision implementation of the routine
+  // Constructor, optionally with an epilogue applied to C. Each variant of the epilogue results in
+  // a separately compiled program.
+  Xgemm(CommandQueue &queue, Event &event, const Epilogue &epilogue = Epilogue());
+
+  // Templated-precision implementation of the routine. Optionally, the A or B matrix is a square
+  // symmetric or hermitian matrix of which only a triangle is stored. In that case, the name of the
+  // kernel to expand it into its padded copy is given (e.g. "SymmUpperToPadded").
   StatusCode DoGemm(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
                     const size_t m, const size_t n, const size_t k,
                     const T alpha,
                     const Buffer &a_buffer, const size_t a_offset, const size_t a_ld,
                     const Buffer &b_buffer, const size_t b_offset, const size_t b_ld,
                     const T beta,
-                    const Buffer &c_buffer, const size_t c_offset, const size_t c_ld);
+                    const Buffer &c_buffer, const size_t c_offset, const size_t c_ld,
+                    const std::string &a_pad_kernel = "", const std::string &b_pad_kernel = "");
 
  private:
+  // Expands a symmetric or hermitian matrix stored as a triangle into a padded (and optionally
+  // transposed and/or conjugated) matrix using the given kernel
+  StatusCode PadTriangleToMatrix(const std::string &kernel_name, const size_t src_dim,
+                                 const size_t src_ld, const size_t src_offset, const Buffer &src,
+                                 const size_t dest_one, const size_t dest_two, const Buffer &dest,
+                                 const Program &program,
+                                 const bool do_transpose, const bool do_conjugate);
+
+  // Tests a vector of the epilogue for validity: it holds one value per row or column of C
+  StatusCode TestEpilogueVector(const EpilogueVector type, const cl_mem buffer, const size_t offset,
+                                const size_t m, const size_t n) const;
+
+  // The epilogue and whether or not it does anything
+  const Epilogue epilogue_;
+  const bool use_epilogue_;
+
   // Static variable to get the precision
   const static Precision precision_;
 };
@@ -26,14 +26,14 @@ class Xhemm: public Xgemm<T> {
  public:
 
   // Uses several variables from the Routine class
-  using Routine::db_;
-  using Routine::context_;
+  using Routine::queue_;
 
   // Uses several helper functions from the Routine class
-  using Routine::RunKernel;
   using Routine::ErrorIn;
   using Routine::TestMatrixA;
-  using Routine::GetProgramFromCache;
+  using Routine::TestMatrixB;
+  using Routine::TestMatrixC;
+  using Routine::UseHostBackend;
 
   // Uses the regular Xgemm routine
   using Xgemm<T>::DoGemm;
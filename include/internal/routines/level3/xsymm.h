@@ -9,8 +9,8 @@
 //
 // This file implements the Xsymm routine. It is based on the generalized matrix multiplication
 // routine (Xgemm). The Xsymm class inherits from the templated class Xgemm, allowing it to call the
-// "DoGemm" function directly. The "DoSymm" function first preprocesses the symmetric matrix by
-// transforming it into a general matrix, and then calls the regular GEMM code.
+// "DoGemm" function directly. The "DoSymm" function calls the regular GEMM code, which expands the
+// stored triangle of the symmetric matrix directly into the padded matrix used by the kernel.
 //
 // =================================================================================================
 
@@ -28,14 +28,14 @@ class Xsymm: public Xgemm<T> {
  public:
 
   // Uses several variables from the Routine class
-  using Routine::db_;
-  using Routine::context_;
+  using Routine::queue_;
 
   // Uses several helper functions from the Routine class
-  using Routine::RunKernel;
   using Routine::ErrorIn;
   using Routine::TestMatrixA;
-  using Routine::GetProgramFromCache;
+  using Routine::TestMatrixB;
+  using Routine::TestMatrixC;
+  using Routine::UseHostBackend;
 
   // Uses the regular Xgemm routine
   using Xgemm<T>::DoGemm;
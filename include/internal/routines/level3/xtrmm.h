@@ -7,39 +7,26 @@
 // Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// This file implements the Xtrmm routine. The implementation is based on first transforming the
-// upper/lower unit/non-unit triangular matrix into a regular matrix and then calling the GEMM
-// routine. Therefore, this class inherits from the Xgemm class.
+// This file implements the Xtrmm routine. The precision is implemented using a template argument.
+// The implementation is based on the regular Xgemm routine and kernel, but with two main changes:
+// 1) The upper/lower unit/non-unit triangular matrix is padded directly into the matrix used by the
+//    Xgemm kernel, setting the zero triangle to zero and the unit diagonal to one.
+// 2) The main Xgemm kernel limits the range of K of each tile to the non-zero part of the triangle.
 //
 // =================================================================================================
 
 #ifndef CLBLAST_ROUTINES_XTRMM_H_
 #define CLBLAST_ROUTINES_XTRMM_H_
 
-#include "internal/routines/level3/xgemm.h"
+#include "internal/routine.h"
 
 namespace clblast {
 // =================================================================================================
 
 // See comment at top of file for a description of the class
 template <typename T>
-class Xtrmm: public Xgemm<T> {
+class Xtrmm: public Routine {
  public:
-
-  // Uses several variables from the Routine class
-  using Routine::db_;
-  using Routine::context_;
-
-  // Uses several helper functions from the Routine class
-  using Routine::RunKernel;
-  using Routine::ErrorIn;
-  using Routine::TestMatrixA;
-  using Routine::GetProgramFromCache;
-
-  // Uses the regular Xgemm routine
-  using Xgemm<T>::DoGemm;
-
-  // Constructor
   Xtrmm(CommandQueue &queue, Event &event);
 
   // Templated-precision implementation of the routine
@@ -49,6 +36,10 @@ class Xtrmm: public Xgemm<T> {
                     const T alpha,
                     const Buffer &a_buffer, const size_t a_offset, const size_t a_ld,
                     const Buffer &b_buffer, const size_t b_offset, const size_t b_ld);
+
+ private:
+  // Static variable to get the precision
+  const static Precision precision_;
 };
 
 // =================================================================================================
@@ -0,0 +1,61 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xtrsm routine. The precision is implemented using a template argument.
+// The implementation is a blocked algorithm: first, the diagonal blocks of the triangular matrix
+// are inverted by a small dedicated kernel. Then, the matrix is traversed block by block, updating
+// the remaining right-hand sides and solving with the diagonal blocks through the Xgemm routine.
+// This way, almost all of the computation is done by the regular (tuned) Xgemm kernel.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XTRSM_H_
+#define CLBLAST_ROUTINES_XTRSM_H_
+
+#include "internal/routine.h"
+#include "internal/routines/level3/xgemm.h"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xtrsm: public Routine {
+ public:
+  Xtrsm(CommandQueue &queue, Event &event);
+
+  // Compiles the kernels of this routine as well as those of the Xgemm routine
+  StatusCode SetUp();
+
+  // Templated-precision implementation of the routine
+  StatusCode DoTrsm(const Layout layout, const Side side, const Triangle triangle,
+                    const Transpose a_transpose, const Diagonal diagonal,
+                    const size_t m, const size_t n,
+                    const T alpha,
+                    const Buffer &a_buffer, const size_t a_offset, const size_t a_ld,
+                    const Buffer &b_buffer, const size_t b_offset, const size_t b_ld);
+
+ private:
+  // The size of the diagonal blocks which are inverted and of the steps of the blocked algorithm
+  static constexpr size_t kBlockSize = 64;
+
+  // The number of threads per work-group of the kernel inverting the diagonal blocks
+  static constexpr size_t kInvertThreads = 16;
+
+  // The regular routine used for the bulk of the computation
+  Xgemm<T> gemm_;
+
+  // Static variable to get the precision
+  const static Precision precision_;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XTRSM_H_
+#endif
@@ -22,6 +22,7 @@
 #include <complex>
 
 #include "clblast.h"
+#include "clblast_half.h"
 #include "internal/clpp11.h"
 
 namespace clblast {
@@ -31,6 +32,9 @@ namespace clblast {
 using float2 = std::complex<float>;
 using double2 = std::complex<double>;
 
+// Shorthand for the half-precision data-type, stored on the host as its 16-bit representation
+using half = cl_half;
+
 // Khronos OpenCL extensions
 const std::string kKhronosHalfPrecision = "cl_khr_fp16";
 const std::string kKhronosDoublePrecision = "cl_khr_fp64";
@@ -41,6 +45,8 @@ const std::string kKhronosDoublePrecision = "cl_khr_fp64";
 constexpr auto kArgM = "m";
 constexpr auto kArgN = "n";
 constexpr auto kArgK = "k";
+constexpr auto kArgKL = "kl";
+constexpr auto kArgKU = "ku";
 constexpr auto kArgLayout = "layout";
 constexpr auto kArgATransp = "transA";
 constexpr auto kArgBTransp = "transB";
@@ -57,6 +63,10 @@ constexpr auto kArgCLeadDim = "ldc";
 constexpr auto kArgAOffset = "offa";
 constexpr auto kArgBOffset = "offb";
 constexpr auto kArgCOffset = "offc";
+constexpr auto kArgDotOffset = "offdot";
+constexpr auto kArgNrm2Offset = "offnrm2";
+constexpr auto kArgAsumOffset = "offasum";
+constexpr auto kArgImaxOffset = "offimax";
 constexpr auto kArgAlpha = "alpha";
 constexpr auto kArgBeta = "beta";
 
@@ -71,6 +81,7 @@ constexpr auto kArgNumRuns = "runs";
 
 // The client-specific arguments in string form
 constexpr auto kArgFullTest = "full_test";
+constexpr auto kArgHostBackend = "host_backend";
 
 // The common arguments in string form
 constexpr auto kArgPlatform = "platform";
@@ -82,6 +93,13 @@ constexpr auto kArgNoAbbreviations = "no_abbrv";
 
 // =================================================================================================
 
+// Converts a double into the given data-type. For half-precision this is a conversion into the
+// 16-bit representation rather than a cast.
+template <typename T>
+T FromDouble(const double value);
+
+// =================================================================================================
+
 // Structure containing all possible arguments for test clients, including their default values
 template <typename T>
 struct Arguments {
@@ -89,6 +107,8 @@ struct Arguments {
   size_t m = 0;
   size_t n = 0;
   size_t k = 0;
+  size_t kl = 0;
+  size_t ku = 0;
   Layout layout = Layout::kRowMajor;
   Transpose a_transpose = Transpose::kNo;
   Transpose b_transpose = Transpose::kNo;
@@ -105,13 +125,18 @@ struct Arguments {
   size_t a_offset = 0;
   size_t b_offset = 0;
   size_t c_offset = 0;
-  T alpha = T{1.0};
-  T beta = T{1.0};
+  size_t dot_offset = 0;
+  size_t nrm2_offset = 0;
+  size_t asum_offset = 0;
+  size_t imax_offset = 0;
+  T alpha = FromDouble<T>(1.0);
+  T beta = FromDouble<T>(1.0);
   size_t x_size = 1;
   size_t y_size = 1;
   size_t a_size = 1;
   size_t b_size = 1;
   size_t c_size = 1;
+  size_t scalar_size = 1;
   // Tuner-specific arguments
   double fraction = 1.0;
   // Client-specific arguments
@@ -137,6 +162,7 @@ struct Buffers {
   Buffer a_mat;
   Buffer b_mat;
   Buffer c_mat;
+  Buffer scalar;
 };
 
 // =================================================================================================
@@ -18,10 +18,48 @@
 #include "clblast.h"
 
 // BLAS level-1 includes
+#include "internal/routines/level1/xrotg.h"
+#include "internal/routines/level1/xrotmg.h"
+#include "internal/routines/level1/xrot.h"
+#include "internal/routines/level1/xrotm.h"
+#include "internal/routines/level1/xswap.h"
+#include "internal/routines/level1/xscal.h"
+#include "internal/routines/level1/xcopy.h"
 #include "internal/routines/level1/xaxpy.h"
+#include "internal/routines/level1/xdot.h"
+#include "internal/routines/level1/xdotu.h"
+#include "internal/routines/level1/xdotc.h"
+#include "internal/routines/level1/xsdsdot.h"
+#include "internal/routines/level1/xdsdot.h"
+#include "internal/routines/level1/xnrm2.h"
+#include "internal/routines/level1/xasum.h"
+#include "internal/routines/level1/xamax.h"
+#include "internal/routines/level1/xamin.h"
 
 // BLAS level-2 includes
 #include "internal/routines/level2/xgemv.h"
+#include "internal/routines/level2/xgbmv.h"
+#include "internal/routines/level2/xsymv.h"
+#include "internal/routines/level2/xhemv.h"
+#include "internal/routines/level2/xsbmv.h"
+#include "internal/routines/level2/xhbmv.h"
+#include "internal/routines/level2/xspmv.h"
+#include "internal/routines/level2/xhpmv.h"
+#include "internal/routines/level2/xtrmv.h"
+#include "internal/routines/level2/xtbmv.h"
+#include "internal/routines/level2/xtpmv.h"
+#include "internal/routines/level2/xtrsv.h"
+#include "internal/routines/level2/xtbsv.h"
+#include "internal/routines/level2/xtpsv.h"
+#include "internal/routines/level2/xger.h"
+#include "internal/routines/level2/xgeru.h"
+#include "internal/routines/level2/xgerc.h"
+#include "internal/routines/level2/xsyr.h"
+#include "internal/routines/level2/xher.h"
+#include "internal/routines/level2/xspr.h"
+#include "internal/routines/level2/xhpr.h"
+#include "internal/routines/level2/xsyr2.h"
+#include "internal/routines/level2/xher2.h"
 
 // BLAS level-3 includes
 #include "internal/routines/level3/xgemm.h"
@@ -32,95 +70,1550 @@
 #include "internal/routines/level3/xsyr2k.h"
 #include "internal/routines/level3/xher2k.h"
 #include "internal/routines/level3/xtrmm.h"
+#include "internal/routines/level3/xtrsm.h"
+
+// Multi-device and host-memory includes
+#include "internal/multidevice.h"
+#include "internal/hostmemory.h"
 
 namespace clblast {
 // =================================================================================================
 // BLAS level-1 (vector-vector) routines
 
-// AXPY
+// ROTG
+template <typename T>
+StatusCode Rotg(cl_mem a_buffer, const size_t a_offset,
+                cl_mem b_buffer, const size_t b_offset,
+                cl_mem c_buffer, const size_t c_offset,
+                cl_mem s_buffer, const size_t s_offset,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xrotg<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoRotg(Buffer(a_buffer), a_offset,
+                        Buffer(b_buffer), b_offset,
+                        Buffer(c_buffer), c_offset,
+                        Buffer(s_buffer), s_offset);
+}
+template StatusCode Rotg<float>(cl_mem, const size_t,
+                                cl_mem, const size_t,
+                                cl_mem, const size_t,
+                                cl_mem, const size_t,
+                                cl_command_queue*, cl_event*);
+template StatusCode Rotg<double>(cl_mem, const size_t,
+                                 cl_mem, const size_t,
+                                 cl_mem, const size_t,
+                                 cl_mem, const size_t,
+                                 cl_command_queue*, cl_event*);
+
+// ROTMG
+template <typename T>
+StatusCode Rotmg(cl_mem d1_buffer, const size_t d1_offset,
+                 cl_mem d2_buffer, const size_t d2_offset,
+                 cl_mem x1_buffer, const size_t x1_offset,
+                 const cl_mem y1_buffer, const size_t y1_offset,
+                 cl_mem param_buffer, const size_t param_offset,
+                 cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xrotmg<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoRotmg(Buffer(d1_buffer), d1_offset,
+                         Buffer(d2_buffer), d2_offset,
+                         Buffer(x1_buffer), x1_offset,
+                         Buffer(y1_buffer), y1_offset,
+                         Buffer(param_buffer), param_offset);
+}
+template StatusCode Rotmg<float>(cl_mem, const size_t,
+                                 cl_mem, const size_t,
+                                 cl_mem, const size_t,
+                                 const cl_mem, const size_t,
+                                 cl_mem, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Rotmg<double>(cl_mem, const size_t,
+                                  cl_mem, const size_t,
+                                  cl_mem, const size_t,
+                                  const cl_mem, const size_t,
+                                  cl_mem, const size_t,
+                                  cl_command_queue*, cl_event*);
+
+// ROT
+template <typename T>
+StatusCode Rot(const size_t n,
+               cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+               cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+               const cl_mem c_buffer, const size_t c_offset,
+               const cl_mem s_buffer, const size_t s_offset,
+               cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xrot<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoRot(n,
+                       Buffer(x_buffer), x_offset, x_inc,
+                       Buffer(y_buffer), y_offset, y_inc,
+                       Buffer(c_buffer), c_offset,
+                       Buffer(s_buffer), s_offset);
+}
+template StatusCode Rot<float>(const size_t,
+                               cl_mem, const size_t, const size_t,
+                               cl_mem, const size_t, const size_t,
+                               const cl_mem, const size_t,
+                               const cl_mem, const size_t,
+                               cl_command_queue*, cl_event*);
+template StatusCode Rot<double>(const size_t,
+                                cl_mem, const size_t, const size_t,
+                                cl_mem, const size_t, const size_t,
+                                const cl_mem, const size_t,
+                                const cl_mem, const size_t,
+                                cl_command_queue*, cl_event*);
+
+// ROTM
+template <typename T>
+StatusCode Rotm(const size_t n,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                const cl_mem param_buffer, const size_t param_offset,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xrotm<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoRotm(n,
+                        Buffer(x_buffer), x_offset, x_inc,
+                        Buffer(y_buffer), y_offset, y_inc,
+                        Buffer(param_buffer), param_offset);
+}
+template StatusCode Rotm<float>(const size_t,
+                                cl_mem, const size_t, const size_t,
+                                cl_mem, const size_t, const size_t,
+                                const cl_mem, const size_t,
+                                cl_command_queue*, cl_event*);
+template StatusCode Rotm<double>(const size_t,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_mem, const size_t, const size_t,
+                                 const cl_mem, const size_t,
+                                 cl_command_queue*, cl_event*);
+
+// SWAP
+template <typename T>
+StatusCode Swap(const size_t n,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xswap<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoSwap(n,
+                        Buffer(x_buffer), x_offset, x_inc,
+                        Buffer(y_buffer), y_offset, y_inc);
+}
+template StatusCode Swap<float>(const size_t,
+                                cl_mem, const size_t, const size_t,
+                                cl_mem, const size_t, const size_t,
+                                cl_command_queue*, cl_event*);
+template StatusCode Swap<double>(const size_t,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Swap<float2>(const size_t,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Swap<double2>(const size_t,
+                                  cl_mem, const size_t, const size_t,
+                                  cl_mem, const size_t, const size_t,
+                                  cl_command_queue*, cl_event*);
+
+// SCAL
+template <typename T>
+StatusCode Scal(const size_t n, const T alpha,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xscal<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoScal(n, alpha,
+                        Buffer(x_buffer), x_offset, x_inc);
+}
+template StatusCode Scal<float>(const size_t, const float,
+                                cl_mem, const size_t, const size_t,
+                                cl_command_queue*, cl_event*);
+template StatusCode Scal<double>(const size_t, const double,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Scal<float2>(const size_t, const float2,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Scal<double2>(const size_t, const double2,
+                                  cl_mem, const size_t, const size_t,
+                                  cl_command_queue*, cl_event*);
+
+// COPY
+template <typename T>
+StatusCode Copy(const size_t n,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xcopy<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoCopy(n,
+                        Buffer(x_buffer), x_offset, x_inc,
+                        Buffer(y_buffer), y_offset, y_inc);
+}
+template StatusCode Copy<float>(const size_t,
+                                const cl_mem, const size_t, const size_t,
+                                cl_mem, const size_t, const size_t,
+                                cl_command_queue*, cl_event*);
+template StatusCode Copy<double>(const size_t,
+                                 const cl_mem, const size_t, const size_t,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Copy<float2>(const size_t,
+                                 const cl_mem, const size_t, const size_t,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Copy<double2>(const size_t,
+                                  const cl_mem, const size_t, const size_t,
+                                  cl_mem, const size_t, const size_t,
+                                  cl_command_queue*, cl_event*);
+
+// AXPY
+template <typename T>
+StatusCode Axpy(const size_t n, const T alpha,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xaxpy<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoAxpy(n, alpha,
+                        Buffer(x_buffer), x_offset, x_inc,
+                        Buffer(y_buffer), y_offset, y_inc);
+}
+template StatusCode Axpy<float>(const size_t, const float,
+                                const cl_mem, const size_t, const size_t,
+                                cl_mem, const size_t, const size_t,
+                                cl_command_queue*, cl_event*);
+template StatusCode Axpy<double>(const size_t, const double,
+                                 const cl_mem, const size_t, const size_t,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Axpy<float2>(const size_t, const float2,
+                                 const cl_mem, const size_t, const size_t,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Axpy<double2>(const size_t, const double2,
+                                  const cl_mem, const size_t, const size_t,
+                                  cl_mem, const size_t, const size_t,
+                                  cl_command_queue*, cl_event*);
+template StatusCode Axpy<half>(const size_t, const half,
+                               const cl_mem, const size_t, const size_t,
+                               cl_mem, const size_t, const size_t,
+                               cl_command_queue*, cl_event*);
+
+// =================================================================================================
+
+// AXPY on multiple devices
+template <typename T>
+StatusCode AxpyMultiDevice(const size_t n, const T alpha,
+                           const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                           cl_command_queue* queues, const size_t num_queues, cl_event* event) {
+  auto queues_cpp = std::vector<CommandQueue>();
+  for (auto i=size_t{0}; i<num_queues; ++i) { queues_cpp.push_back(CommandQueue(queues[i])); }
+  auto event_cpp = Event(*event);
+  auto routine = XaxpyMultiDevice<T>(queues_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine and passes back the combined event
+  status = routine.DoAxpy(n, alpha,
+                          Buffer(x_buffer), x_offset, x_inc,
+                          Buffer(y_buffer), y_offset, y_inc);
+  if (status == StatusCode::kSuccess) { *event = event_cpp(); }
+  return status;
+}
+template StatusCode AxpyMultiDevice<float>(const size_t, const float,
+                                           const cl_mem, const size_t, const size_t,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_command_queue*, const size_t, cl_event*);
+template StatusCode AxpyMultiDevice<double>(const size_t, const double,
+                                            const cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, const size_t, cl_event*);
+template StatusCode AxpyMultiDevice<float2>(const size_t, const float2,
+                                            const cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, const size_t, cl_event*);
+template StatusCode AxpyMultiDevice<double2>(const size_t, const double2,
+                                             const cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, const size_t, cl_event*);
+
+// DOT
+template <typename T>
+StatusCode Dot(const size_t n,
+               cl_mem dot_buffer, const size_t dot_offset,
+               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+               const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+               cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xdot<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoDot(n,
+                       Buffer(dot_buffer), dot_offset,
+                       Buffer(x_buffer), x_offset, x_inc,
+                       Buffer(y_buffer), y_offset, y_inc);
+}
+template StatusCode Dot<float>(const size_t,
+                               cl_mem, const size_t,
+                               const cl_mem, const size_t, const size_t,
+                               const cl_mem, const size_t, const size_t,
+                               cl_command_queue*, cl_event*);
+template StatusCode Dot<double>(const size_t,
+                                cl_mem, const size_t,
+                                const cl_mem, const size_t, const size_t,
+                                const cl_mem, const size_t, const size_t,
+                                cl_command_queue*, cl_event*);
+
+// DOTU
+template <typename T>
+StatusCode Dotu(const size_t n,
+                cl_mem dot_buffer, const size_t dot_offset,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xdotu<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoDotu(n,
+                        Buffer(dot_buffer), dot_offset,
+                        Buffer(x_buffer), x_offset, x_inc,
+                        Buffer(y_buffer), y_offset, y_inc);
+}
+template StatusCode Dotu<float2>(const size_t,
+                                 cl_mem, const size_t,
+                                 const cl_mem, const size_t, const size_t,
+                                 const cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Dotu<double2>(const size_t,
+                                  cl_mem, const size_t,
+                                  const cl_mem, const size_t, const size_t,
+                                  const cl_mem, const size_t, const size_t,
+                                  cl_command_queue*, cl_event*);
+
+// DOTC
+template <typename T>
+StatusCode Dotc(const size_t n,
+                cl_mem dot_buffer, const size_t dot_offset,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xdotc<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoDotc(n,
+                        Buffer(dot_buffer), dot_offset,
+                        Buffer(x_buffer), x_offset, x_inc,
+                        Buffer(y_buffer), y_offset, y_inc);
+}
+template StatusCode Dotc<float2>(const size_t,
+                                 cl_mem, const size_t,
+                                 const cl_mem, const size_t, const size_t,
+                                 const cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Dotc<double2>(const size_t,
+                                  cl_mem, const size_t,
+                                  const cl_mem, const size_t, const size_t,
+                                  const cl_mem, const size_t, const size_t,
+                                  cl_command_queue*, cl_event*);
+
+// SDSDOT
+template <typename T>
+StatusCode Sdsdot(const size_t n, const T sb,
+                  cl_mem dot_buffer, const size_t dot_offset,
+                  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                  const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                  cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xsdsdot<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoSdsdot(n, sb,
+                          Buffer(dot_buffer), dot_offset,
+                          Buffer(x_buffer), x_offset, x_inc,
+                          Buffer(y_buffer), y_offset, y_inc);
+}
+template StatusCode Sdsdot<float>(const size_t, const float,
+                                  cl_mem, const size_t,
+                                  const cl_mem, const size_t, const size_t,
+                                  const cl_mem, const size_t, const size_t,
+                                  cl_command_queue*, cl_event*);
+
+// DSDOT
+template <typename T>
+StatusCode Dsdot(const size_t n,
+                 cl_mem dot_buffer, const size_t dot_offset,
+                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                 const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                 cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xdsdot<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoDsdot(n,
+                         Buffer(dot_buffer), dot_offset,
+                         Buffer(x_buffer), x_offset, x_inc,
+                         Buffer(y_buffer), y_offset, y_inc);
+}
+template StatusCode Dsdot<double>(const size_t,
+                                  cl_mem, const size_t,
+                                  const cl_mem, const size_t, const size_t,
+                                  const cl_mem, const size_t, const size_t,
+                                  cl_command_queue*, cl_event*);
+
+// NRM2
+template <typename T>
+StatusCode Nrm2(const size_t n,
+                cl_mem nrm2_buffer, const size_t nrm2_offset,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xnrm2<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoNrm2(n,
+                        Buffer(nrm2_buffer), nrm2_offset,
+                        Buffer(x_buffer), x_offset, x_inc);
+}
+template StatusCode Nrm2<float>(const size_t,
+                                cl_mem, const size_t,
+                                const cl_mem, const size_t, const size_t,
+                                cl_command_queue*, cl_event*);
+template StatusCode Nrm2<double>(const size_t,
+                                 cl_mem, const size_t,
+                                 const cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Nrm2<float2>(const size_t,
+                                 cl_mem, const size_t,
+                                 const cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Nrm2<double2>(const size_t,
+                                  cl_mem, const size_t,
+                                  const cl_mem, const size_t, const size_t,
+                                  cl_command_queue*, cl_event*);
+
+// ASUM
+template <typename T>
+StatusCode Asum(const size_t n,
+                cl_mem asum_buffer, const size_t asum_offset,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xasum<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoAsum(n,
+                        Buffer(asum_buffer), asum_offset,
+                        Buffer(x_buffer), x_offset, x_inc);
+}
+template StatusCode Asum<float>(const size_t,
+                                cl_mem, const size_t,
+                                const cl_mem, const size_t, const size_t,
+                                cl_command_queue*, cl_event*);
+template StatusCode Asum<double>(const size_t,
+                                 cl_mem, const size_t,
+                                 const cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Asum<float2>(const size_t,
+                                 cl_mem, const size_t,
+                                 const cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Asum<double2>(const size_t,
+                                  cl_mem, const size_t,
+                                  const cl_mem, const size_t, const size_t,
+                                  cl_command_queue*, cl_event*);
+
+// AMAX
+template <typename T>
+StatusCode Amax(const size_t n,
+                cl_mem imax_buffer, const size_t imax_offset,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xamax<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoAmax(n,
+                        Buffer(imax_buffer), imax_offset,
+                        Buffer(x_buffer), x_offset, x_inc);
+}
+template StatusCode Amax<float>(const size_t,
+                                cl_mem, const size_t,
+                                const cl_mem, const size_t, const size_t,
+                                cl_command_queue*, cl_event*);
+template StatusCode Amax<double>(const size_t,
+                                 cl_mem, const size_t,
+                                 const cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Amax<float2>(const size_t,
+                                 cl_mem, const size_t,
+                                 const cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Amax<double2>(const size_t,
+                                  cl_mem, const size_t,
+                                  const cl_mem, const size_t, const size_t,
+                                  cl_command_queue*, cl_event*);
+
+// AMIN
+template <typename T>
+StatusCode Amin(const size_t n,
+                cl_mem imin_buffer, const size_t imin_offset,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xamin<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoAmin(n,
+                        Buffer(imin_buffer), imin_offset,
+                        Buffer(x_buffer), x_offset, x_inc);
+}
+template StatusCode Amin<float>(const size_t,
+                                cl_mem, const size_t,
+                                const cl_mem, const size_t, const size_t,
+                                cl_command_queue*, cl_event*);
+template StatusCode Amin<double>(const size_t,
+                                 cl_mem, const size_t,
+                                 const cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Amin<float2>(const size_t,
+                                 cl_mem, const size_t,
+                                 const cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Amin<double2>(const size_t,
+                                  cl_mem, const size_t,
+                                  const cl_mem, const size_t, const size_t,
+                                  cl_command_queue*, cl_event*);
+
+// =================================================================================================
+// BLAS level-2 (matrix-vector) routines
+
+// GEMV
+template <typename T>
+StatusCode Gemv(const Layout layout, const Transpose a_transpose,
+                const size_t m, const size_t n, const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const T beta,
+                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_command_queue* queue, cl_event* event) {
+  
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xgemv<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoGemv(layout, a_transpose, m, n, alpha,
+                        Buffer(a_buffer), a_offset, a_ld,
+                        Buffer(x_buffer), x_offset, x_inc, beta,
+                        Buffer(y_buffer), y_offset, y_inc);
+}
+template StatusCode Gemv<float>(const Layout, const Transpose,
+                                const size_t, const size_t, const float,
+                                const cl_mem, const size_t, const size_t,
+                                const cl_mem, const size_t, const size_t, const float,
+                                cl_mem, const size_t, const size_t,
+                                cl_command_queue*, cl_event*);
+template StatusCode Gemv<double>(const Layout, const Transpose,
+                                 const size_t, const size_t, const double,
+                                 const cl_mem, const size_t, const size_t,
+                                 const cl_mem, const size_t, const size_t, const double,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Gemv<float2>(const Layout, const Transpose,
+                                 const size_t, const size_t, const float2,
+                                 const cl_mem, const size_t, const size_t,
+                                 const cl_mem, const size_t, const size_t, const float2,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Gemv<double2>(const Layout, const Transpose,
+                                  const size_t, const size_t, const double2,
+                                  const cl_mem, const size_t, const size_t,
+                                  const cl_mem, const size_t, const size_t, const double2,
+                                  cl_mem, const size_t, const size_t,
+                                  cl_command_queue*, cl_event*);
+template StatusCode Gemv<half>(const Layout, const Transpose,
+                               const size_t, const size_t, const half,
+                               const cl_mem, const size_t, const size_t,
+                               const cl_mem, const size_t, const size_t, const half,
+                               cl_mem, const size_t, const size_t,
+                               cl_command_queue*, cl_event*);
+
+// GBMV
+template <typename T>
+StatusCode Gbmv(const Layout layout, const Transpose a_transpose,
+                const size_t m, const size_t n, const size_t kl, const size_t ku, const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const T beta,
+                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xgbmv<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoGbmv(layout, a_transpose, m, n, kl, ku, alpha,
+                        Buffer(a_buffer), a_offset, a_ld,
+                        Buffer(x_buffer), x_offset, x_inc, beta,
+                        Buffer(y_buffer), y_offset, y_inc);
+}
+template StatusCode Gbmv<float>(const Layout, const Transpose,
+                                const size_t, const size_t, const size_t, const size_t,
+                                const float,
+                                const cl_mem, const size_t, const size_t,
+                                const cl_mem, const size_t, const size_t, const float,
+                                cl_mem, const size_t, const size_t,
+                                cl_command_queue*, cl_event*);
+template StatusCode Gbmv<double>(const Layout, const Transpose,
+                                 const size_t, const size_t, const size_t, const size_t,
+                                 const double,
+                                 const cl_mem, const size_t, const size_t,
+                                 const cl_mem, const size_t, const size_t, const double,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Gbmv<float2>(const Layout, const Transpose,
+                                 const size_t, const size_t, const size_t, const size_t,
+                                 const float2,
+                                 const cl_mem, const size_t, const size_t,
+                                 const cl_mem, const size_t, const size_t, const float2,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Gbmv<double2>(const Layout, const Transpose,
+                                  const size_t, const size_t, const size_t, const size_t,
+                                  const double2,
+                                  const cl_mem, const size_t, const size_t,
+                                  const cl_mem, const size_t, const size_t, const double2,
+                                  cl_mem, const size_t, const size_t,
+                                  cl_command_queue*, cl_event*);
+
+// SYMV
+template <typename T>
+StatusCode Symv(const Layout layout, const Triangle triangle,
+                const size_t n, const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const T beta,
+                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xsymv<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoSymv(layout, triangle, n, alpha,
+                        Buffer(a_buffer), a_offset, a_ld,
+                        Buffer(x_buffer), x_offset, x_inc, beta,
+                        Buffer(y_buffer), y_offset, y_inc);
+}
+template StatusCode Symv<float>(const Layout, const Triangle,
+                                const size_t, const float,
+                                const cl_mem, const size_t, const size_t,
+                                const cl_mem, const size_t, const size_t, const float,
+                                cl_mem, const size_t, const size_t,
+                                cl_command_queue*, cl_event*);
+template StatusCode Symv<double>(const Layout, const Triangle,
+                                 const size_t, const double,
+                                 const cl_mem, const size_t, const size_t,
+                                 const cl_mem, const size_t, const size_t, const double,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+
+// HEMV
+template <typename T>
+StatusCode Hemv(const Layout layout, const Triangle triangle,
+                const size_t n, const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const T beta,
+                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xhemv<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoHemv(layout, triangle, n, alpha,
+                        Buffer(a_buffer), a_offset, a_ld,
+                        Buffer(x_buffer), x_offset, x_inc, beta,
+                        Buffer(y_buffer), y_offset, y_inc);
+}
+template StatusCode Hemv<float2>(const Layout, const Triangle,
+                                 const size_t, const float2,
+                                 const cl_mem, const size_t, const size_t,
+                                 const cl_mem, const size_t, const size_t, const float2,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Hemv<double2>(const Layout, const Triangle,
+                                  const size_t, const double2,
+                                  const cl_mem, const size_t, const size_t,
+                                  const cl_mem, const size_t, const size_t, const double2,
+                                  cl_mem, const size_t, const size_t,
+                                  cl_command_queue*, cl_event*);
+
+// SBMV
+template <typename T>
+StatusCode Sbmv(const Layout layout, const Triangle triangle,
+                const size_t n, const size_t k, const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const T beta,
+                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xsbmv<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoSbmv(layout, triangle, n, k, alpha,
+                        Buffer(a_buffer), a_offset, a_ld,
+                        Buffer(x_buffer), x_offset, x_inc, beta,
+                        Buffer(y_buffer), y_offset, y_inc);
+}
+template StatusCode Sbmv<float>(const Layout, const Triangle,
+                                const size_t, const size_t, const float,
+                                const cl_mem, const size_t, const size_t,
+                                const cl_mem, const size_t, const size_t, const float,
+                                cl_mem, const size_t, const size_t,
+                                cl_command_queue*, cl_event*);
+template StatusCode Sbmv<double>(const Layout, const Triangle,
+                                 const size_t, const size_t, const double,
+                                 const cl_mem, const size_t, const size_t,
+                                 const cl_mem, const size_t, const size_t, const double,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+
+// HBMV
+template <typename T>
+StatusCode Hbmv(const Layout layout, const Triangle triangle,
+                const size_t n, const size_t k, const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const T beta,
+                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xhbmv<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoHbmv(layout, triangle, n, k, alpha,
+                        Buffer(a_buffer), a_offset, a_ld,
+                        Buffer(x_buffer), x_offset, x_inc, beta,
+                        Buffer(y_buffer), y_offset, y_inc);
+}
+template StatusCode Hbmv<float2>(const Layout, const Triangle,
+                                 const size_t, const size_t, const float2,
+                                 const cl_mem, const size_t, const size_t,
+                                 const cl_mem, const size_t, const size_t, const float2,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Hbmv<double2>(const Layout, const Triangle,
+                                  const size_t, const size_t, const double2,
+                                  const cl_mem, const size_t, const size_t,
+                                  const cl_mem, const size_t, const size_t, const double2,
+                                  cl_mem, const size_t, const size_t,
+                                  cl_command_queue*, cl_event*);
+
+// SPMV
+template <typename T>
+StatusCode Spmv(const Layout layout, const Triangle triangle,
+                const size_t n,
+                const T alpha,
+                const cl_mem ap_buffer, const size_t ap_offset,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                const T beta,
+                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xspmv<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoSpmv(layout, triangle, n, alpha,
+                        Buffer(ap_buffer), ap_offset,
+                        Buffer(x_buffer), x_offset, x_inc, beta,
+                        Buffer(y_buffer), y_offset, y_inc);
+}
+template StatusCode Spmv<float>(const Layout, const Triangle,
+                                const size_t, const float,
+                                const cl_mem, const size_t,
+                                const cl_mem, const size_t, const size_t, const float,
+                                cl_mem, const size_t, const size_t,
+                                cl_command_queue*, cl_event*);
+template StatusCode Spmv<double>(const Layout, const Triangle,
+                                 const size_t, const double,
+                                 const cl_mem, const size_t,
+                                 const cl_mem, const size_t, const size_t, const double,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+
+// HPMV
+template <typename T>
+StatusCode Hpmv(const Layout layout, const Triangle triangle,
+                const size_t n,
+                const T alpha,
+                const cl_mem ap_buffer, const size_t ap_offset,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                const T beta,
+                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xhpmv<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoHpmv(layout, triangle, n, alpha,
+                        Buffer(ap_buffer), ap_offset,
+                        Buffer(x_buffer), x_offset, x_inc, beta,
+                        Buffer(y_buffer), y_offset, y_inc);
+}
+template StatusCode Hpmv<float2>(const Layout, const Triangle,
+                                 const size_t, const float2,
+                                 const cl_mem, const size_t,
+                                 const cl_mem, const size_t, const size_t, const float2,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Hpmv<double2>(const Layout, const Triangle,
+                                  const size_t, const double2,
+                                  const cl_mem, const size_t,
+                                  const cl_mem, const size_t, const size_t, const double2,
+                                  cl_mem, const size_t, const size_t,
+                                  cl_command_queue*, cl_event*);
+
+// TRMV
+template <typename T>
+StatusCode Trmv(const Layout layout, const Triangle triangle,
+                const Transpose a_transpose, const Diagonal diagonal,
+                const size_t n,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xtrmv<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoTrmv(layout, triangle, a_transpose, diagonal, n,
+                        Buffer(a_buffer), a_offset, a_ld,
+                        Buffer(x_buffer), x_offset, x_inc);
+}
+template StatusCode Trmv<float>(const Layout, const Triangle,
+                                const Transpose, const Diagonal,
+                                const size_t,
+                                const cl_mem, const size_t, const size_t,
+                                cl_mem, const size_t, const size_t,
+                                cl_command_queue*, cl_event*);
+template StatusCode Trmv<double>(const Layout, const Triangle,
+                                 const Transpose, const Diagonal,
+                                 const size_t,
+                                 const cl_mem, const size_t, const size_t,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Trmv<float2>(const Layout, const Triangle,
+                                 const Transpose, const Diagonal,
+                                 const size_t,
+                                 const cl_mem, const size_t, const size_t,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Trmv<double2>(const Layout, const Triangle,
+                                  const Transpose, const Diagonal,
+                                  const size_t,
+                                  const cl_mem, const size_t, const size_t,
+                                  cl_mem, const size_t, const size_t,
+                                  cl_command_queue*, cl_event*);
+
+// TBMV
+template <typename T>
+StatusCode Tbmv(const Layout layout, const Triangle triangle,
+                const Transpose a_transpose, const Diagonal diagonal,
+                const size_t n, const size_t k,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xtbmv<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoTbmv(layout, triangle, a_transpose, diagonal, n, k,
+                        Buffer(a_buffer), a_offset, a_ld,
+                        Buffer(x_buffer), x_offset, x_inc);
+}
+template StatusCode Tbmv<float>(const Layout, const Triangle,
+                                const Transpose, const Diagonal,
+                                const size_t, const size_t,
+                                const cl_mem, const size_t, const size_t,
+                                cl_mem, const size_t, const size_t,
+                                cl_command_queue*, cl_event*);
+template StatusCode Tbmv<double>(const Layout, const Triangle,
+                                 const Transpose, const Diagonal,
+                                 const size_t, const size_t,
+                                 const cl_mem, const size_t, const size_t,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Tbmv<float2>(const Layout, const Triangle,
+                                 const Transpose, const Diagonal,
+                                 const size_t, const size_t,
+                                 const cl_mem, const size_t, const size_t,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Tbmv<double2>(const Layout, const Triangle,
+                                  const Transpose, const Diagonal,
+                                  const size_t, const size_t,
+                                  const cl_mem, const size_t, const size_t,
+                                  cl_mem, const size_t, const size_t,
+                                  cl_command_queue*, cl_event*);
+
+// TPMV
+template <typename T>
+StatusCode Tpmv(const Layout layout, const Triangle triangle,
+                const Transpose a_transpose, const Diagonal diagonal,
+                const size_t n,
+                const cl_mem ap_buffer, const size_t ap_offset,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xtpmv<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoTpmv(layout, triangle, a_transpose, diagonal, n,
+                        Buffer(ap_buffer), ap_offset,
+                        Buffer(x_buffer), x_offset, x_inc);
+}
+template StatusCode Tpmv<float>(const Layout, const Triangle,
+                                const Transpose, const Diagonal,
+                                const size_t,
+                                const cl_mem, const size_t,
+                                cl_mem, const size_t, const size_t,
+                                cl_command_queue*, cl_event*);
+template StatusCode Tpmv<double>(const Layout, const Triangle,
+                                 const Transpose, const Diagonal,
+                                 const size_t,
+                                 const cl_mem, const size_t,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Tpmv<float2>(const Layout, const Triangle,
+                                 const Transpose, const Diagonal,
+                                 const size_t,
+                                 const cl_mem, const size_t,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Tpmv<double2>(const Layout, const Triangle,
+                                  const Transpose, const Diagonal,
+                                  const size_t,
+                                  const cl_mem, const size_t,
+                                  cl_mem, const size_t, const size_t,
+                                  cl_command_queue*, cl_event*);
+
+// TRSV
+template <typename T>
+StatusCode Trsv(const Layout layout, const Triangle triangle,
+                const Transpose a_transpose, const Diagonal diagonal,
+                const size_t n,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xtrsv<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoTrsv(layout, triangle, a_transpose, diagonal, n,
+                        Buffer(a_buffer), a_offset, a_ld,
+                        Buffer(x_buffer), x_offset, x_inc);
+}
+template StatusCode Trsv<float>(const Layout, const Triangle,
+                                const Transpose, const Diagonal,
+                                const size_t,
+                                const cl_mem, const size_t, const size_t,
+                                cl_mem, const size_t, const size_t,
+                                cl_command_queue*, cl_event*);
+template StatusCode Trsv<double>(const Layout, const Triangle,
+                                 const Transpose, const Diagonal,
+                                 const size_t,
+                                 const cl_mem, const size_t, const size_t,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Trsv<float2>(const Layout, const Triangle,
+                                 const Transpose, const Diagonal,
+                                 const size_t,
+                                 const cl_mem, const size_t, const size_t,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Trsv<double2>(const Layout, const Triangle,
+                                  const Transpose, const Diagonal,
+                                  const size_t,
+                                  const cl_mem, const size_t, const size_t,
+                                  cl_mem, const size_t, const size_t,
+                                  cl_command_queue*, cl_event*);
+
+// TBSV
+template <typename T>
+StatusCode Tbsv(const Layout layout, const Triangle triangle,
+                const Transpose a_transpose, const Diagonal diagonal,
+                const size_t n, const size_t k,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xtbsv<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoTbsv(layout, triangle, a_transpose, diagonal, n, k,
+                        Buffer(a_buffer), a_offset, a_ld,
+                        Buffer(x_buffer), x_offset, x_inc);
+}
+template StatusCode Tbsv<float>(const Layout, const Triangle,
+                                const Transpose, const Diagonal,
+                                const size_t, const size_t,
+                                const cl_mem, const size_t, const size_t,
+                                cl_mem, const size_t, const size_t,
+                                cl_command_queue*, cl_event*);
+template StatusCode Tbsv<double>(const Layout, const Triangle,
+                                 const Transpose, const Diagonal,
+                                 const size_t, const size_t,
+                                 const cl_mem, const size_t, const size_t,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Tbsv<float2>(const Layout, const Triangle,
+                                 const Transpose, const Diagonal,
+                                 const size_t, const size_t,
+                                 const cl_mem, const size_t, const size_t,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Tbsv<double2>(const Layout, const Triangle,
+                                  const Transpose, const Diagonal,
+                                  const size_t, const size_t,
+                                  const cl_mem, const size_t, const size_t,
+                                  cl_mem, const size_t, const size_t,
+                                  cl_command_queue*, cl_event*);
+
+// TPSV
 template <typename T>
-StatusCode Axpy(const size_t n, const T alpha,
-                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
-                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+StatusCode Tpsv(const Layout layout, const Triangle triangle,
+                const Transpose a_transpose, const Diagonal diagonal,
+                const size_t n,
+                const cl_mem ap_buffer, const size_t ap_offset,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event) {
   auto queue_cpp = CommandQueue(*queue);
   auto event_cpp = Event(*event);
-  auto routine = Xaxpy<T>(queue_cpp, event_cpp);
+  auto routine = Xtpsv<T>(queue_cpp, event_cpp);
 
   // Compiles the routine's device kernels
   auto status = routine.SetUp();
   if (status != StatusCode::kSuccess) { return status; }
 
   // Runs the routine
-  return routine.DoAxpy(n, alpha,
-                        Buffer(x_buffer), x_offset, x_inc,
-                        Buffer(y_buffer), y_offset, y_inc);
+  return routine.DoTpsv(layout, triangle, a_transpose, diagonal, n,
+                        Buffer(ap_buffer), ap_offset,
+                        Buffer(x_buffer), x_offset, x_inc);
 }
-template StatusCode Axpy<float>(const size_t, const float,
+template StatusCode Tpsv<float>(const Layout, const Triangle,
+                                const Transpose, const Diagonal,
+                                const size_t,
+                                const cl_mem, const size_t,
+                                cl_mem, const size_t, const size_t,
+                                cl_command_queue*, cl_event*);
+template StatusCode Tpsv<double>(const Layout, const Triangle,
+                                 const Transpose, const Diagonal,
+                                 const size_t,
+                                 const cl_mem, const size_t,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Tpsv<float2>(const Layout, const Triangle,
+                                 const Transpose, const Diagonal,
+                                 const size_t,
+                                 const cl_mem, const size_t,
+                                 cl_mem, const size_t, const size_t,
+                                 cl_command_queue*, cl_event*);
+template StatusCode Tpsv<double2>(const Layout, const Triangle,
+                                  const Transpose, const Diagonal,
+                                  const size_t,
+                                  const cl_mem, const size_t,
+                                  cl_mem, const size_t, const size_t,
+                                  cl_command_queue*, cl_event*);
+
+// GER
+template <typename T>
+StatusCode Ger(const Layout layout,
+               const size_t m, const size_t n,
+               const T alpha,
+               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+               const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+               cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+               cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xger<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoGer(layout, m, n, alpha,
+                       Buffer(x_buffer), x_offset, x_inc,
+                       Buffer(y_buffer), y_offset, y_inc,
+                       Buffer(a_buffer), a_offset, a_ld);
+}
+template StatusCode Ger<float>(const Layout,
+                               const size_t, const size_t,
+                               const float,
+                               const cl_mem, const size_t, const size_t,
+                               const cl_mem, const size_t, const size_t,
+                               cl_mem, const size_t, const size_t,
+                               cl_command_queue*, cl_event*);
+template StatusCode Ger<double>(const Layout,
+                                const size_t, const size_t,
+                                const double,
+                                const cl_mem, const size_t, const size_t,
                                 const cl_mem, const size_t, const size_t,
                                 cl_mem, const size_t, const size_t,
                                 cl_command_queue*, cl_event*);
-template StatusCode Axpy<double>(const size_t, const double,
+
+// GERU
+template <typename T>
+StatusCode Geru(const Layout layout,
+                const size_t m, const size_t n,
+                const T alpha,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xgeru<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoGeru(layout, m, n, alpha,
+                        Buffer(x_buffer), x_offset, x_inc,
+                        Buffer(y_buffer), y_offset, y_inc,
+                        Buffer(a_buffer), a_offset, a_ld);
+}
+template StatusCode Geru<float2>(const Layout,
+                                 const size_t, const size_t,
+                                 const float2,
+                                 const cl_mem, const size_t, const size_t,
                                  const cl_mem, const size_t, const size_t,
                                  cl_mem, const size_t, const size_t,
                                  cl_command_queue*, cl_event*);
-template StatusCode Axpy<float2>(const size_t, const float2,
+template StatusCode Geru<double2>(const Layout,
+                                  const size_t, const size_t,
+                                  const double2,
+                                  const cl_mem, const size_t, const size_t,
+                                  const cl_mem, const size_t, const size_t,
+                                  cl_mem, const size_t, const size_t,
+                                  cl_command_queue*, cl_event*);
+
+// GERC
+template <typename T>
+StatusCode Gerc(const Layout layout,
+                const size_t m, const size_t n,
+                const T alpha,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xgerc<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoGerc(layout, m, n, alpha,
+                        Buffer(x_buffer), x_offset, x_inc,
+                        Buffer(y_buffer), y_offset, y_inc,
+                        Buffer(a_buffer), a_offset, a_ld);
+}
+template StatusCode Gerc<float2>(const Layout,
+                                 const size_t, const size_t,
+                                 const float2,
+                                 const cl_mem, const size_t, const size_t,
                                  const cl_mem, const size_t, const size_t,
                                  cl_mem, const size_t, const size_t,
                                  cl_command_queue*, cl_event*);
-template StatusCode Axpy<double2>(const size_t, const double2,
+template StatusCode Gerc<double2>(const Layout,
+                                  const size_t, const size_t,
+                                  const double2,
+                                  const cl_mem, const size_t, const size_t,
                                   const cl_mem, const size_t, const size_t,
                                   cl_mem, const size_t, const size_t,
                                   cl_command_queue*, cl_event*);
 
-// =================================================================================================
-// BLAS level-2 (matrix-vector) routines
+// SYR
+template <typename T>
+StatusCode Syr(const Layout layout, const Triangle triangle,
+               const size_t n,
+               const T alpha,
+               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+               cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+               cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xsyr<T>(queue_cpp, event_cpp);
 
-// GEMV
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoSyr(layout, triangle, n, alpha,
+                       Buffer(x_buffer), x_offset, x_inc,
+                       Buffer(a_buffer), a_offset, a_ld);
+}
+template StatusCode Syr<float>(const Layout, const Triangle,
+                               const size_t,
+                               const float,
+                               const cl_mem, const size_t, const size_t,
+                               cl_mem, const size_t, const size_t,
+                               cl_command_queue*, cl_event*);
+template StatusCode Syr<double>(const Layout, const Triangle,
+                                const size_t,
+                                const double,
+                                const cl_mem, const size_t, const size_t,
+                                cl_mem, const size_t, const size_t,
+                                cl_command_queue*, cl_event*);
+
+// HER
 template <typename T>
-StatusCode Gemv(const Layout layout, const Transpose a_transpose,
-                const size_t m, const size_t n, const T alpha,
-                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
-                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const T beta,
-                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+StatusCode Her(const Layout layout, const Triangle triangle,
+               const size_t n,
+               const T alpha,
+               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+               cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+               cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xher<std::complex<T>,T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoHer(layout, triangle, n, alpha,
+                       Buffer(x_buffer), x_offset, x_inc,
+                       Buffer(a_buffer), a_offset, a_ld);
+}
+template StatusCode Her<float>(const Layout, const Triangle,
+                               const size_t,
+                               const float,
+                               const cl_mem, const size_t, const size_t,
+                               cl_mem, const size_t, const size_t,
+                               cl_command_queue*, cl_event*);
+template StatusCode Her<double>(const Layout, const Triangle,
+                                const size_t,
+                                const double,
+                                const cl_mem, const size_t, const size_t,
+                                cl_mem, const size_t, const size_t,
+                                cl_command_queue*, cl_event*);
+
+// SPR
+template <typename T>
+StatusCode Spr(const Layout layout, const Triangle triangle,
+               const size_t n,
+               const T alpha,
+               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+               cl_mem ap_buffer, const size_t ap_offset,
+               cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xspr<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoSpr(layout, triangle, n, alpha,
+                       Buffer(x_buffer), x_offset, x_inc,
+                       Buffer(ap_buffer), ap_offset);
+}
+template StatusCode Spr<float>(const Layout, const Triangle,
+                               const size_t,
+                               const float,
+                               const cl_mem, const size_t, const size_t,
+                               cl_mem, const size_t,
+                               cl_command_queue*, cl_event*);
+template StatusCode Spr<double>(const Layout, const Triangle,
+                                const size_t,
+                                const double,
+                                const cl_mem, const size_t, const size_t,
+                                cl_mem, const size_t,
+                                cl_command_queue*, cl_event*);
+
+// HPR
+template <typename T>
+StatusCode Hpr(const Layout layout, const Triangle triangle,
+               const size_t n,
+               const T alpha,
+               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+               cl_mem ap_buffer, const size_t ap_offset,
+               cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xhpr<std::complex<T>,T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoHpr(layout, triangle, n, alpha,
+                       Buffer(x_buffer), x_offset, x_inc,
+                       Buffer(ap_buffer), ap_offset);
+}
+template StatusCode Hpr<float>(const Layout, const Triangle,
+                               const size_t,
+                               const float,
+                               const cl_mem, const size_t, const size_t,
+                               cl_mem, const size_t,
+                               cl_command_queue*, cl_event*);
+template StatusCode Hpr<double>(const Layout, const Triangle,
+                                const size_t,
+                                const double,
+                                const cl_mem, const size_t, const size_t,
+                                cl_mem, const size_t,
+                                cl_command_queue*, cl_event*);
+
+// SYR2
+template <typename T>
+StatusCode Syr2(const Layout layout, const Triangle triangle,
+                const size_t n,
+                const T alpha,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                 cl_command_queue* queue, cl_event* event) {
-  
   auto queue_cpp = CommandQueue(*queue);
   auto event_cpp = Event(*event);
-  auto routine = Xgemv<T>(queue_cpp, event_cpp);
+  auto routine = Xsyr2<T>(queue_cpp, event_cpp);
 
   // Compiles the routine's device kernels
   auto status = routine.SetUp();
   if (status != StatusCode::kSuccess) { return status; }
 
   // Runs the routine
-  return routine.DoGemv(layout, a_transpose, m, n, alpha,
-                        Buffer(a_buffer), a_offset, a_ld,
-                        Buffer(x_buffer), x_offset, x_inc, beta,
-                        Buffer(y_buffer), y_offset, y_inc);
+  return routine.DoSyr2(layout, triangle, n, alpha,
+                        Buffer(x_buffer), x_offset, x_inc,
+                        Buffer(y_buffer), y_offset, y_inc,
+                        Buffer(a_buffer), a_offset, a_ld);
 }
-template StatusCode Gemv<float>(const Layout, const Transpose,
-                                const size_t, const size_t, const float,
+template StatusCode Syr2<float>(const Layout, const Triangle,
+                                const size_t,
+                                const float,
+                                const cl_mem, const size_t, const size_t,
                                 const cl_mem, const size_t, const size_t,
-                                const cl_mem, const size_t, const size_t, const float,
                                 cl_mem, const size_t, const size_t,
                                 cl_command_queue*, cl_event*);
-template StatusCode Gemv<double>(const Layout, const Transpose,
-                                 const size_t, const size_t, const double,
+template StatusCode Syr2<double>(const Layout, const Triangle,
+                                 const size_t,
+                                 const double,
+                                 const cl_mem, const size_t, const size_t,
                                  const cl_mem, const size_t, const size_t,
-                                 const cl_mem, const size_t, const size_t, const double,
                                  cl_mem, const size_t, const size_t,
                                  cl_command_queue*, cl_event*);
-template StatusCode Gemv<float2>(const Layout, const Transpose,
-                                 const size_t, const size_t, const float2,
+
+// HER2
+template <typename T>
+StatusCode Her2(const Layout layout, const Triangle triangle,
+                const size_t n,
+                const T alpha,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xher2<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoHer2(layout, triangle, n, alpha,
+                        Buffer(x_buffer), x_offset, x_inc,
+                        Buffer(y_buffer), y_offset, y_inc,
+                        Buffer(a_buffer), a_offset, a_ld);
+}
+template StatusCode Her2<float2>(const Layout, const Triangle,
+                                 const size_t,
+                                 const float2,
+                                 const cl_mem, const size_t, const size_t,
                                  const cl_mem, const size_t, const size_t,
-                                 const cl_mem, const size_t, const size_t, const float2,
                                  cl_mem, const size_t, const size_t,
                                  cl_command_queue*, cl_event*);
-template StatusCode Gemv<double2>(const Layout, const Transpose,
-                                  const size_t, const size_t, const double2,
+template StatusCode Her2<double2>(const Layout, const Triangle,
+                                  const size_t,
+                                  const double2,
+                                  const cl_mem, const size_t, const size_t,
                                   const cl_mem, const size_t, const size_t,
-                                  const cl_mem, const size_t, const size_t, const double2,
                                   cl_mem, const size_t, const size_t,
                                   cl_command_queue*, cl_event*);
 
@@ -173,6 +1666,170 @@ template StatusCode Gemm<double2>(const Layout, const Transpose, const Transpose
                                   const cl_mem, const size_t, const size_t, const double2,
                                   cl_mem, const size_t, const size_t,
                                   cl_command_queue*, cl_event*);
+template StatusCode Gemm<half>(const Layout, const Transpose, const Transpose,
+                               const size_t, const size_t, const size_t, const half,
+                               const cl_mem, const size_t, const size_t,
+                               const cl_mem, const size_t, const size_t, const half,
+                               cl_mem, const size_t, const size_t,
+                               cl_command_queue*, cl_event*);
+
+// =================================================================================================
+
+// GEMM on multiple devices
+template <typename T>
+StatusCode GemmMultiDevice(const Layout layout, const Transpose a_transpose,
+                           const Transpose b_transpose,
+                           const size_t m, const size_t n, const size_t k, const T alpha,
+                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                           const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                           const T beta,
+                           cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                           cl_command_queue* queues, const size_t num_queues, cl_event* event) {
+  auto queues_cpp = std::vector<CommandQueue>();
+  for (auto i=size_t{0}; i<num_queues; ++i) { queues_cpp.push_back(CommandQueue(queues[i])); }
+  auto event_cpp = Event(*event);
+  auto routine = XgemmMultiDevice<T>(queues_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine and passes back the combined event
+  status = routine.DoGemm(layout, a_transpose, b_transpose, m, n, k, alpha,
+                          Buffer(a_buffer), a_offset, a_ld,
+                          Buffer(b_buffer), b_offset, b_ld, beta,
+                          Buffer(c_buffer), c_offset, c_ld);
+  if (status == StatusCode::kSuccess) { *event = event_cpp(); }
+  return status;
+}
+template StatusCode GemmMultiDevice<float>(const Layout, const Transpose, const Transpose,
+                                           const size_t, const size_t, const size_t, const float,
+                                           const cl_mem, const size_t, const size_t,
+                                           const cl_mem, const size_t, const size_t, const float,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_command_queue*, const size_t, cl_event*);
+template StatusCode GemmMultiDevice<double>(const Layout, const Transpose, const Transpose,
+                                            const size_t, const size_t, const size_t, const double,
+                                            const cl_mem, const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t, const double,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, const size_t, cl_event*);
+template StatusCode GemmMultiDevice<float2>(const Layout, const Transpose, const Transpose,
+                                            const size_t, const size_t, const size_t, const float2,
+                                            const cl_mem, const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t, const float2,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, const size_t, cl_event*);
+template StatusCode GemmMultiDevice<double2>(const Layout, const Transpose, const Transpose,
+                                             const size_t, const size_t, const size_t,
+                                             const double2,
+                                             const cl_mem, const size_t, const size_t,
+                                             const cl_mem, const size_t, const size_t,
+                                             const double2,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, const size_t, cl_event*);
+
+// =================================================================================================
+
+// GEMM with an epilogue
+template <typename T>
+StatusCode GemmEpilogue(const Layout layout, const Transpose a_transpose,
+                        const Transpose b_transpose,
+                        const size_t m, const size_t n, const size_t k, const T alpha,
+                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                        const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                        const T beta,
+                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                        const Epilogue &epilogue,
+                        cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = Xgemm<T>(queue_cpp, event_cpp, epilogue);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoGemm(layout, a_transpose, b_transpose, m, n, k, alpha,
+                        Buffer(a_buffer), a_offset, a_ld,
+                        Buffer(b_buffer), b_offset, b_ld, beta,
+                        Buffer(c_buffer), c_offset, c_ld);
+}
+template StatusCode GemmEpilogue<float>(const Layout, const Transpose, const Transpose,
+                                        const size_t, const size_t, const size_t, const float,
+                                        const cl_mem, const size_t, const size_t,
+                                        const cl_mem, const size_t, const size_t, const float,
+                                        cl_mem, const size_t, const size_t,
+                                        const Epilogue&,
+                                        cl_command_queue*, cl_event*);
+template StatusCode GemmEpilogue<double>(const Layout, const Transpose, const Transpose,
+                                         const size_t, const size_t, const size_t, const double,
+                                         const cl_mem, const size_t, const size_t,
+                                         const cl_mem, const size_t, const size_t, const double,
+                                         cl_mem, const size_t, const size_t,
+                                         const Epilogue&,
+                                         cl_command_queue*, cl_event*);
+template StatusCode GemmEpilogue<half>(const Layout, const Transpose, const Transpose,
+                                       const size_t, const size_t, const size_t, const half,
+                                       const cl_mem, const size_t, const size_t,
+                                       const cl_mem, const size_t, const size_t, const half,
+                                       cl_mem, const size_t, const size_t,
+                                       const Epilogue&,
+                                       cl_command_queue*, cl_event*);
+
+// =================================================================================================
+
+// GEMM on host memory
+template <typename T>
+StatusCode GemmHost(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                    const size_t m, const size_t n, const size_t k, const T alpha,
+                    const T* a, const size_t a_ld,
+                    const T* b, const size_t b_ld, const T beta,
+                    T* c, const size_t c_ld,
+                    cl_command_queue* queue, cl_event* event) {
+
+  // Without a command-queue, the computation is done by the host backend
+  if (queue == nullptr || *queue == nullptr) {
+    return GemmWithoutDevice(layout, a_transpose, b_transpose, m, n, k, alpha,
+                             a, a_ld, b, b_ld, beta, c, c_ld);
+  }
+  auto queue_cpp = CommandQueue(*queue);
+  auto event_cpp = Event(*event);
+  auto routine = XgemmHost<T>(queue_cpp, event_cpp);
+
+  // Compiles the routine's device kernels
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Runs the routine
+  return routine.DoGemm(layout, a_transpose, b_transpose, m, n, k, alpha,
+                        a, a_ld, b, b_ld, beta, c, c_ld);
+}
+template StatusCode GemmHost<float>(const Layout, const Transpose, const Transpose,
+                                   const size_t, const size_t, const size_t, const float,
+                                   const float*, const size_t,
+                                   const float*, const size_t, const float,
+                                   float*, const size_t,
+                                   cl_command_queue*, cl_event*);
+template StatusCode GemmHost<double>(const Layout, const Transpose, const Transpose,
+                                    const size_t, const size_t, const size_t, const double,
+                                    const double*, const size_t,
+                                    const double*, const size_t, const double,
+                                    double*, const size_t,
+                                    cl_command_queue*, cl_event*);
+template StatusCode GemmHost<float2>(const Layout, const Transpose, const Transpose,
+                                    const size_t, const size_t, const size_t, const float2,
+                                    const float2*, const size_t,
+                                    const float2*, const size_t, const float2,
+                                    float2*, const size_t,
+                                    cl_command_queue*, cl_event*);
+template StatusCode GemmHost<double2>(const Layout, const Transpose, const Transpose,
+                                     const size_t, const size_t, const size_t, const double2,
+                                     const double2*, const size_t,
+                                     const double2*, const size_t, const double2,
+                                     double2*, const size_t,
+                                     cl_command_queue*, cl_event*);
 
 // =================================================================================================
 
@@ -474,7 +2131,6 @@ template StatusCode Trmm<double2>(const Layout, const Side, const Triangle,
 // =================================================================================================
 
 // TRSM
-/*
 template <typename T>
 StatusCode Trsm(const Layout layout, const Side side, const Triangle triangle,
                 const Transpose a_transpose, const Diagonal diagonal,
@@ -520,6 +2176,29 @@ template StatusCode Trsm<double2>(const Layout, const Side, const Triangle,
                                   const cl_mem, const size_t, const size_t,
                                   cl_mem, const size_t, const size_t,
                                   cl_command_queue*, cl_event*);
-*/
+
+// =================================================================================================
+// Device partitioning
+
+// Partitions a device into sub-devices along NUMA nodes. The sub-devices are released again if they
+// are not returned to the caller.
+StatusCode PartitionDevice(const cl_device_id device,
+                           cl_device_id* sub_devices, size_t* num_sub_devices) {
+  if (num_sub_devices == nullptr) { return StatusCode::kInvalidValue; }
+  try {
+    auto sub_devices_cpp = CreateNumaSubDevices(Device(device));
+    auto capacity = *num_sub_devices;
+    *num_sub_devices = sub_devices_cpp.size();
+    if (sub_devices == nullptr || capacity < sub_devices_cpp.size()) {
+      for (auto &sub_device: sub_devices_cpp) { clReleaseDevice(sub_device()); }
+      return (sub_devices == nullptr) ? StatusCode::kSuccess : StatusCode::kInvalidValue;
+    }
+    for (auto i=size_t{0}; i<sub_devices_cpp.size(); ++i) {
+      sub_devices[i] = sub_devices_cpp[i]();
+    }
+    return StatusCode::kSuccess;
+  } catch (...) { return StatusCode::kDevicePartitionFailed; }
+}
+
 // =================================================================================================
 } // namespace clblast
@@ -25,7 +25,66 @@ extern "C" {
 // =================================================================================================
 // BLAS level-1 (vector-vector) routines
 
+// ROTG
+DECLARE_FUNCTION(Srotg, ROTG_SIGNATURE(float))    {ROTG_RETURN(float);}
+DECLARE_FUNCTION(Drotg, ROTG_SIGNATURE(double))   {ROTG_RETURN(double);}
+
+#undef ROTG_SIGNATURE
+#undef ROTG_RETURN
+
+// ROTMG
+DECLARE_FUNCTION(Srotmg, ROTMG_SIGNATURE(float))  {ROTMG_RETURN(float);}
+DECLARE_FUNCTION(Drotmg, ROTMG_SIGNATURE(double)) {ROTMG_RETURN(double);}
+
+#undef ROTMG_SIGNATURE
+#undef ROTMG_RETURN
+
+// ROT
+DECLARE_FUNCTION(Srot, ROT_SIGNATURE(float))      {ROT_RETURN(float);}
+DECLARE_FUNCTION(Drot, ROT_SIGNATURE(double))     {ROT_RETURN(double);}
+
+#undef ROT_SIGNATURE
+#undef ROT_RETURN
+
+// ROTM
+DECLARE_FUNCTION(Srotm, ROTM_SIGNATURE(float))    {ROTM_RETURN(float);}
+DECLARE_FUNCTION(Drotm, ROTM_SIGNATURE(double))   {ROTM_RETURN(double);}
+
+#undef ROTM_SIGNATURE
+#undef ROTM_RETURN
+
+// SWAP
+DECLARE_FUNCTION(Sswap, SWAP_SIGNATURE(float))    {SWAP_RETURN(float);}
+DECLARE_FUNCTION(Dswap, SWAP_SIGNATURE(double))   {SWAP_RETURN(double);}
+DECLARE_FUNCTION(Cswap, SWAP_SIGNATURE(float2))   {SWAP_RETURN(float2);}
+DECLARE_FUNCTION(Zswap, SWAP_SIGNATURE(double2))  {SWAP_RETURN(double2);}
+
+#undef SWAP_SIGNATURE
+#undef SWAP_RETURN
+
+// SCAL
+DECLARE_FUNCTION(Sscal, SCAL_SIGNATURE(float))    {SCAL_RETURN(float);}
+DECLARE_FUNCTION(Dscal, SCAL_SIGNATURE(double))   {SCAL_RETURN(double);}
+DECLARE_FUNCTION(Cscal, SCAL_SIGNATURE(float2))   {SCAL_RETURN(float2);}
+DECLARE_FUNCTION(Zscal, SCAL_SIGNATURE(double2))  {SCAL_RETURN(double2);}
+DECLARE_FUNCTION(Csscal, SCAL_SIGNATURE(float))   {SCAL_REAL_RETURN(float2);}
+DECLARE_FUNCTION(Zdscal, SCAL_SIGNATURE(double))  {SCAL_REAL_RETURN(double2);}
+
+#undef SCAL_SIGNATURE
+#undef SCAL_RETURN
+#undef SCAL_REAL_RETURN
+
+// COPY
+DECLARE_FUNCTION(Scopy, COPY_SIGNATURE(float))    {COPY_RETURN(float);}
+DECLARE_FUNCTION(Dcopy, COPY_SIGNATURE(double))   {COPY_RETURN(double);}
+DECLARE_FUNCTION(Ccopy, COPY_SIGNATURE(float2))   {COPY_RETURN(float2);}
+DECLARE_FUNCTION(Zcopy, COPY_SIGNATURE(double2))  {COPY_RETURN(double2);}
+
+#undef COPY_SIGNATURE
+#undef COPY_RETURN
+
 // AXPY
+DECLARE_FUNCTION(Haxpy, AXPY_SIGNATURE(cl_half))  {AXPY_RETURN(cl_half);}
 DECLARE_FUNCTION(Saxpy, AXPY_SIGNATURE(float))    {AXPY_RETURN(float);}
 DECLARE_FUNCTION(Daxpy, AXPY_SIGNATURE(double))   {AXPY_RETURN(double);}
 DECLARE_FUNCTION(Caxpy, AXPY_SIGNATURE(float2))   {AXPY_RETURN(float2);}
@@ -34,10 +93,80 @@ DECLARE_FUNCTION(Zaxpy, AXPY_SIGNATURE(double2))  {AXPY_RETURN(double2);}
 #undef AXPY_SIGNATURE
 #undef AXPY_RETURN
 
+// DOT
+DECLARE_FUNCTION(Sdot, DOT_SIGNATURE(float))      {DOT_RETURN(float);}
+DECLARE_FUNCTION(Ddot, DOT_SIGNATURE(double))     {DOT_RETURN(double);}
+
+#undef DOT_SIGNATURE
+#undef DOT_RETURN
+
+// DOTU
+DECLARE_FUNCTION(Cdotu, DOTU_SIGNATURE(float2))   {DOTU_RETURN(float2);}
+DECLARE_FUNCTION(Zdotu, DOTU_SIGNATURE(double2))  {DOTU_RETURN(double2);}
+
+#undef DOTU_SIGNATURE
+#undef DOTU_RETURN
+
+// DOTC
+DECLARE_FUNCTION(Cdotc, DOTC_SIGNATURE(float2))   {DOTC_RETURN(float2);}
+DECLARE_FUNCTION(Zdotc, DOTC_SIGNATURE(double2))  {DOTC_RETURN(double2);}
+
+#undef DOTC_SIGNATURE
+#undef DOTC_RETURN
+
+// SDSDOT
+DECLARE_FUNCTION(Sdsdot, SDSDOT_SIGNATURE(float)) {SDSDOT_RETURN(float);}
+
+#undef SDSDOT_SIGNATURE
+#undef SDSDOT_RETURN
+
+// DSDOT
+DECLARE_FUNCTION(Dsdot, DSDOT_SIGNATURE(double))  {DSDOT_RETURN(double);}
+
+#undef DSDOT_SIGNATURE
+#undef DSDOT_RETURN
+
+// NRM2
+DECLARE_FUNCTION(Snrm2, NRM2_SIGNATURE(float))    {NRM2_RETURN(float);}
+DECLARE_FUNCTION(Dnrm2, NRM2_SIGNATURE(double))   {NRM2_RETURN(double);}
+DECLARE_FUNCTION(Scnrm2, NRM2_SIGNATURE(float2))  {NRM2_RETURN(float2);}
+DECLARE_FUNCTION(Dznrm2, NRM2_SIGNATURE(double2)) {NRM2_RETURN(double2);}
+
+#undef NRM2_SIGNATURE
+#undef NRM2_RETURN
+
+// ASUM
+DECLARE_FUNCTION(Sasum, ASUM_SIGNATURE(float))    {ASUM_RETURN(float);}
+DECLARE_FUNCTION(Dasum, ASUM_SIGNATURE(double))   {ASUM_RETURN(double);}
+DECLARE_FUNCTION(Scasum, ASUM_SIGNATURE(float2))  {ASUM_RETURN(float2);}
+DECLARE_FUNCTION(Dzasum, ASUM_SIGNATURE(double2)) {ASUM_RETURN(double2);}
+
+#undef ASUM_SIGNATURE
+#undef ASUM_RETURN
+
+// AMAX
+DECLARE_FUNCTION(iSamax, AMAX_SIGNATURE(float))   {AMAX_RETURN(float);}
+DECLARE_FUNCTION(iDamax, AMAX_SIGNATURE(double))  {AMAX_RETURN(double);}
+DECLARE_FUNCTION(iCamax, AMAX_SIGNATURE(float2))  {AMAX_RETURN(float2);}
+DECLARE_FUNCTION(iZamax, AMAX_SIGNATURE(double2)) {AMAX_RETURN(double2);}
+
+#undef AMAX_SIGNATURE
+#undef AMAX_RETURN
+
+// AMIN
+DECLARE_FUNCTION(iSamin, AMIN_SIGNATURE(float))   {AMIN_RETURN(float);}
+DECLARE_FUNCTION(iDamin, AMIN_SIGNATURE(double))  {AMIN_RETURN(double);}
+DECLARE_FUNCTION(iCamin, AMIN_SIGNATURE(float2))  {AMIN_RETURN(float2);}
+DECLARE_FUNCTION(iZamin, AMIN_SIGNATURE(double2)) {AMIN_RETURN(double2);}
+
+#undef AMIN_SIGNATURE
+#undef AMIN_RETURN
+
 // =================================================================================================
 // BLAS level-2 (matrix-vector) routines
 
 // GEMV
+DECLARE_FUNCTION(Hgemv, GEMV_SIGNATURE(cl_half))  {GEMV_RETURN(cl_half);}
 DECLARE_FUNCTION(Sgemv, GEMV_SIGNATURE(float))    {GEMV_RETURN(float);}
 DECLARE_FUNCTION(Dgemv, GEMV_SIGNATURE(double))   {GEMV_RETURN(double);}
 DECLARE_FUNCTION(Cgemv, GEMV_SIGNATURE(float2))   {GEMV_RETURN(float2);}
@@ -46,10 +175,179 @@ DECLARE_FUNCTION(Zgemv, GEMV_SIGNATURE(double2))  {GEMV_RETURN(double2);}
 #undef GEMV_SIGNATURE
 #undef GEMV_RETURN
 
+// GBMV
+DECLARE_FUNCTION(Sgbmv, GBMV_SIGNATURE(float))    {GBMV_RETURN(float);}
+DECLARE_FUNCTION(Dgbmv, GBMV_SIGNATURE(double))   {GBMV_RETURN(double);}
+DECLARE_FUNCTION(Cgbmv, GBMV_SIGNATURE(float2))   {GBMV_RETURN(float2);}
+DECLARE_FUNCTION(Zgbmv, GBMV_SIGNATURE(double2))  {GBMV_RETURN(double2);}
+
+#undef GBMV_SIGNATURE
+#undef GBMV_RETURN
+
+// SYMV
+DECLARE_FUNCTION(Ssymv, SYMV_SIGNATURE(float))    {SYMV_RETURN(float);}
+DECLARE_FUNCTION(Dsymv, SYMV_SIGNATURE(double))   {SYMV_RETURN(double);}
+
+#undef SYMV_SIGNATURE
+#undef SYMV_RETURN
+
+// HEMV
+DECLARE_FUNCTION(Chemv, HEMV_SIGNATURE(float2))   {HEMV_RETURN(float2);}
+DECLARE_FUNCTION(Zhemv, HEMV_SIGNATURE(double2))  {HEMV_RETURN(double2);}
+
+#undef HEMV_SIGNATURE
+#undef HEMV_RETURN
+
+// SBMV
+DECLARE_FUNCTION(Ssbmv, SBMV_SIGNATURE(float))    {SBMV_RETURN(float);}
+DECLARE_FUNCTION(Dsbmv, SBMV_SIGNATURE(double))   {SBMV_RETURN(double);}
+
+#undef SBMV_SIGNATURE
+#undef SBMV_RETURN
+
+// HBMV
+DECLARE_FUNCTION(Chbmv, HBMV_SIGNATURE(float2))   {HBMV_RETURN(float2);}
+DECLARE_FUNCTION(Zhbmv, HBMV_SIGNATURE(double2))  {HBMV_RETURN(double2);}
+
+#undef HBMV_SIGNATURE
+#undef HBMV_RETURN
+
+// SPMV
+DECLARE_FUNCTION(Sspmv, SPMV_SIGNATURE(float))    {SPMV_RETURN(float);}
+DECLARE_FUNCTION(Dspmv, SPMV_SIGNATURE(double))   {SPMV_RETURN(double);}
+
+#undef SPMV_SIGNATURE
+#undef SPMV_RETURN
+
+// HPMV
+DECLARE_FUNCTION(Chpmv, HPMV_SIGNATURE(float2))   {HPMV_RETURN(float2);}
+DECLARE_FUNCTION(Zhpmv, HPMV_SIGNATURE(double2))  {HPMV_RETURN(double2);}
+
+#undef HPMV_SIGNATURE
+#undef HPMV_RETURN
+
+// TRMV
+DECLARE_FUNCTION(Strmv, TRMV_SIGNATURE(float))    {TRMV_RETURN(float);}
+DECLARE_FUNCTION(Dtrmv, TRMV_SIGNATURE(double))   {TRMV_RETURN(double);}
+DECLARE_FUNCTION(Ctrmv, TRMV_SIGNATURE(float2))   {TRMV_RETURN(float2);}
+DECLARE_FUNCTION(Ztrmv, TRMV_SIGNATURE(double2))  {TRMV_RETURN(double2);}
+
+#undef TRMV_SIGNATURE
+#undef TRMV_RETURN
+
+// TBMV
+DECLARE_FUNCTION(Stbmv, TBMV_SIGNATURE(float))    {TBMV_RETURN(float);}
+DECLARE_FUNCTION(Dtbmv, TBMV_SIGNATURE(double))   {TBMV_RETURN(double);}
+DECLARE_FUNCTION(Ctbmv, TBMV_SIGNATURE(float2))   {TBMV_RETURN(float2);}
+DECLARE_FUNCTION(Ztbmv, TBMV_SIGNATURE(double2))  {TBMV_RETURN(double2);}
+
+#undef TBMV_SIGNATURE
+#undef TBMV_RETURN
+
+// TPMV
+DECLARE_FUNCTION(Stpmv, TPMV_SIGNATURE(float))    {TPMV_RETURN(float);}
+DECLARE_FUNCTION(Dtpmv, TPMV_SIGNATURE(double))   {TPMV_RETURN(double);}
+DECLARE_FUNCTION(Ctpmv, TPMV_SIGNATURE(float2))   {TPMV_RETURN(float2);}
+DECLARE_FUNCTION(Ztpmv, TPMV_SIGNATURE(double2))  {TPMV_RETURN(double2);}
+
+#undef TPMV_SIGNATURE
+#undef TPMV_RETURN
+
+// TRSV
+DECLARE_FUNCTION(Strsv, TRSV_SIGNATURE(float))    {TRSV_RETURN(float);}
+DECLARE_FUNCTION(Dtrsv, TRSV_SIGNATURE(double))   {TRSV_RETURN(double);}
+DECLARE_FUNCTION(Ctrsv, TRSV_SIGNATURE(float2))   {TRSV_RETURN(float2);}
+DECLARE_FUNCTION(Ztrsv, TRSV_SIGNATURE(double2))  {TRSV_RETURN(double2);}
+
+#undef TRSV_SIGNATURE
+#undef TRSV_RETURN
+
+// TBSV
+DECLARE_FUNCTION(Stbsv, TBSV_SIGNATURE(float))    {TBSV_RETURN(float);}
+DECLARE_FUNCTION(Dtbsv, TBSV_SIGNATURE(double))   {TBSV_RETURN(double);}
+DECLARE_FUNCTION(Ctbsv, TBSV_SIGNATURE(float2))   {TBSV_RETURN(float2);}
+DECLARE_FUNCTION(Ztbsv, TBSV_SIGNATURE(double2))  {TBSV_RETURN(double2);}
+
+#undef TBSV_SIGNATURE
+#undef TBSV_RETURN
+
+// TPSV
+DECLARE_FUNCTION(Stpsv, TPSV_SIGNATURE(float))    {TPSV_RETURN(float);}
+DECLARE_FUNCTION(Dtpsv, TPSV_SIGNATURE(double))   {TPSV_RETURN(double);}
+DECLARE_FUNCTION(Ctpsv, TPSV_SIGNATURE(float2))   {TPSV_RETURN(float2);}
+DECLARE_FUNCTION(Ztpsv, TPSV_SIGNATURE(double2))  {TPSV_RETURN(double2);}
+
+#undef TPSV_SIGNATURE
+#undef TPSV_RETURN
+
+// GER
+DECLARE_FUNCTION(Sger, GER_SIGNATURE(float))      {GER_RETURN(float);}
+DECLARE_FUNCTION(Dger, GER_SIGNATURE(double))     {GER_RETURN(double);}
+
+#undef GER_SIGNATURE
+#undef GER_RETURN
+
+// GERU
+DECLARE_FUNCTION(Cgeru, GERU_SIGNATURE(float2))   {GERU_RETURN(float2);}
+DECLARE_FUNCTION(Zgeru, GERU_SIGNATURE(double2))  {GERU_RETURN(double2);}
+
+#undef GERU_SIGNATURE
+#undef GERU_RETURN
+
+// GERC
+DECLARE_FUNCTION(Cgerc, GERC_SIGNATURE(float2))   {GERC_RETURN(float2);}
+DECLARE_FUNCTION(Zgerc, GERC_SIGNATURE(double2))  {GERC_RETURN(double2);}
+
+#undef GERC_SIGNATURE
+#undef GERC_RETURN
+
+// SYR
+DECLARE_FUNCTION(Ssyr, SYR_SIGNATURE(float))      {SYR_RETURN(float);}
+DECLARE_FUNCTION(Dsyr, SYR_SIGNATURE(double))     {SYR_RETURN(double);}
+
+#undef SYR_SIGNATURE
+#undef SYR_RETURN
+
+// HER
+DECLARE_FUNCTION(Cher, HER_SIGNATURE(float))      {HER_RETURN(float);}
+DECLARE_FUNCTION(Zher, HER_SIGNATURE(double))     {HER_RETURN(double);}
+
+#undef HER_SIGNATURE
+#undef HER_RETURN
+
+// SPR
+DECLARE_FUNCTION(Sspr, SPR_SIGNATURE(float))      {SPR_RETURN(float);}
+DECLARE_FUNCTION(Dspr, SPR_SIGNATURE(double))     {SPR_RETURN(double);}
+
+#undef SPR_SIGNATURE
+#undef SPR_RETURN
+
+// HPR
+DECLARE_FUNCTION(Chpr, HPR_SIGNATURE(float))      {HPR_RETURN(float);}
+DECLARE_FUNCTION(Zhpr, HPR_SIGNATURE(double))     {HPR_RETURN(double);}
+
+#undef HPR_SIGNATURE
+#undef HPR_RETURN
+
+// SYR2
+DECLARE_FUNCTION(Ssyr2, SYR2_SIGNATURE(float))    {SYR2_RETURN(float);}
+DECLARE_FUNCTION(Dsyr2, SYR2_SIGNATURE(double))   {SYR2_RETURN(double);}
+
+#undef SYR2_SIGNATURE
+#undef SYR2_RETURN
+
+// HER2
+DECLARE_FUNCTION(Cher2, HER2_SIGNATURE(float2))   {HER2_RETURN(float2);}
+DECLARE_FUNCTION(Zher2, HER2_SIGNATURE(double2))  {HER2_RETURN(double2);}
+
+#undef HER2_SIGNATURE
+#undef HER2_RETURN
+
 // =================================================================================================
 // BLAS level-3 (matrix-matrix) routines
 
 // GEMM
+DECLARE_FUNCTION(Hgemm, GEMM_SIGNATURE(cl_half))  {GEMM_RETURN(cl_half);}
 DECLARE_FUNCTION(Sgemm, GEMM_SIGNATURE(float))    {GEMM_RETURN(float);}
 DECLARE_FUNCTION(Dgemm, GEMM_SIGNATURE(double))   {GEMM_RETURN(double);}
 DECLARE_FUNCTION(Cgemm, GEMM_SIGNATURE(float2))   {GEMM_RETURN(float2);}
@@ -132,7 +430,6 @@ DECLARE_FUNCTION(Ztrmm, TRMM_SIGNATURE(double2))  {TRMM_RETURN(double2);}
 // =================================================================================================
 
 // TRSM
-/*
 DECLARE_FUNCTION(Strsm, TRSM_SIGNATURE(float))    {TRSM_RETURN(float);}
 DECLARE_FUNCTION(Dtrsm, TRSM_SIGNATURE(double))   {TRSM_RETURN(double);}
 DECLARE_FUNCTION(Ctrsm, TRSM_SIGNATURE(float2))   {TRSM_RETURN(float2);}
@@ -140,7 +437,7 @@ DECLARE_FUNCTION(Ztrsm, TRSM_SIGNATURE(double2))  {TRSM_RETURN(double2);}
 
 #undef TRSM_SIGNATURE
 #undef TRSM_RETURN
-*/
+
 // =================================================================================================
 
 // Add more here ...
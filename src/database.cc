@@ -13,7 +13,17 @@
 
 #include "internal/database.h"
 #include "internal/database/xaxpy.h"
+#include "internal/database/xscal.h"
+#include "internal/database/xcopy.h"
+#include "internal/database/xswap.h"
+#include "internal/database/xrot.h"
+#include "internal/database/xdot.h"
+#include "internal/database/xamax.h"
 #include "internal/database/xgemv.h"
+#include "internal/database/xger.h"
+#include "internal/database/xsymv.h"
+#include "internal/database/xgbmv.h"
+#include "internal/database/xspmv.h"
 #include "internal/database/xgemm.h"
 #include "internal/database/copy.h"
 #include "internal/database/pad.h"
@@ -27,13 +37,23 @@ namespace clblast {
 
 // Initializes the database
 const std::vector<Database::DatabaseEntry> Database::database = {
-  XaxpySingle, XaxpyDouble, XaxpyComplexSingle, XaxpyComplexDouble,
-  XgemvSingle, XgemvDouble, XgemvComplexSingle, XgemvComplexDouble,
-  XgemmSingle, XgemmDouble, XgemmComplexSingle, XgemmComplexDouble,
-  CopySingle, CopyDouble, CopyComplexSingle, CopyComplexDouble,
-  PadSingle, PadDouble, PadComplexSingle, PadComplexDouble,
-  TraSingle, TraDouble, TraComplexSingle, TraComplexDouble,
-  PadTraSingle, PadTraDouble, PadTraComplexSingle, PadTraComplexDouble
+  XaxpyHalf, XaxpySingle, XaxpyDouble, XaxpyComplexSingle, XaxpyComplexDouble,
+  XscalSingle, XscalDouble, XscalComplexSingle, XscalComplexDouble,
+  XcopySingle, XcopyDouble, XcopyComplexSingle, XcopyComplexDouble,
+  XswapSingle, XswapDouble, XswapComplexSingle, XswapComplexDouble,
+  XrotSingle, XrotDouble,
+  XdotSingle, XdotDouble, XdotComplexSingle, XdotComplexDouble,
+  XamaxSingle, XamaxDouble, XamaxComplexSingle, XamaxComplexDouble,
+  XgemvHalf, XgemvSingle, XgemvDouble, XgemvComplexSingle, XgemvComplexDouble,
+  XgerSingle, XgerDouble, XgerComplexSingle, XgerComplexDouble,
+  XsymvSingle, XsymvDouble, XsymvComplexSingle, XsymvComplexDouble,
+  XgbmvSingle, XgbmvDouble, XgbmvComplexSingle, XgbmvComplexDouble,
+  XspmvSingle, XspmvDouble, XspmvComplexSingle, XspmvComplexDouble,
+  XgemmHalf, XgemmSingle, XgemmDouble, XgemmComplexSingle, XgemmComplexDouble,
+  CopyHalf, CopySingle, CopyDouble, CopyComplexSingle, CopyComplexDouble,
+  PadHalf, PadSingle, PadDouble, PadComplexSingle, PadComplexDouble,
+  TraHalf, TraSingle, TraDouble, TraComplexSingle, TraComplexDouble,
+  PadTraHalf, PadTraSingle, PadTraDouble, PadTraComplexSingle, PadTraComplexDouble
 };
 
 // =================================================================================================
@@ -0,0 +1,1814 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the native host backend (see the header for information about it).
+//
+// =================================================================================================
+
+#include "internal/hostblas.h"
+
+#include <cstdlib>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <algorithm>
+
+namespace clblast {
+// =================================================================================================
+
+// The minimum amount of work (in multiply-add operations) for which an extra thread is started
+constexpr size_t kMinWorkPerThread = 32*1024;
+
+// The cache-block sizes of the level-3 routines: a block of kBlockM by kBlockK elements of the
+// packed matrix A is re-used for all columns of C computed by a thread
+constexpr size_t kBlockM = 256;
+constexpr size_t kBlockK = 128;
+
+// Retrieves the threshold once, taking the environmental variable into account
+size_t HostBackendThreshold() {
+  static const auto threshold = []() -> size_t {
+    auto value = std::getenv("CLBLAST_HOST_THRESHOLD");
+    if (value == nullptr) { return kHostBackendThreshold; }
+    return static_cast<size_t>(std::strtoull(value, nullptr, 10));
+  }();
+  return threshold;
+}
+
+// =================================================================================================
+
+// Maps all buffers, re-using the mapping of a buffer which was passed before
+HostMapping::HostMapping(const CommandQueue &queue, const std::vector<Buffer> &buffers):
+    queue_(queue),
+    buffers_(buffers) {
+  try {
+    for (auto i=size_t{0}; i<buffers_.size(); ++i) {
+      auto previous = std::find_if(buffers_.begin(), buffers_.begin() + i,
+                                   [&](const Buffer &buffer) { return buffer() == buffers_[i](); });
+      if (previous != buffers_.begin() + i) {
+        pointers_.push_back(pointers_[previous - buffers_.begin()]);
+        owners_.push_back(false);
+      }
+      else {
+        auto map_flags = CL_MAP_READ | CL_MAP_WRITE;
+        pointers_.push_back(buffers_[i].MapBuffer(queue_, map_flags, buffers_[i].GetSize()));
+        owners_.push_back(true);
+      }
+    }
+  } catch (...) {
+    Unmap();
+    throw;
+  }
+}
+
+// Unmaps all buffers and waits for this to complete, such that the device sees the results
+HostMapping::~HostMapping() {
+  Unmap();
+}
+void HostMapping::Unmap() {
+  for (auto i=size_t{0}; i<pointers_.size(); ++i) {
+    if (owners_[i]) { buffers_[i].UnmapBuffer(queue_, pointers_[i]); }
+  }
+  pointers_.clear();
+  owners_.clear();
+  queue_.Finish();
+}
+
+// =================================================================================================
+
+// A pool of worker threads, started once and shared by all host routines: starting new threads for
+// each call would take longer than many of the small problems handled by the host backend.
+class ThreadPool {
+ public:
+
+  // Retrieves the single instance. The calling thread counts as one of the hardware threads.
+  static ThreadPool& Instance() {
+    static ThreadPool pool(std::max(std::thread::hardware_concurrency(), 1U) - 1);
+    return pool;
+  }
+
+  // Runs all tasks, both in the workers and in the calling thread, and waits for their completion
+  void Run(const std::vector<std::function<void()>> &tasks) {
+    Batch batch;
+    batch.remaining = tasks.size();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (auto &task: tasks) { queue_.push_back({&task, &batch}); }
+    }
+    wake_.notify_all();
+    while (RunNext()) { }
+    std::unique_lock<std::mutex> lock(batch.mutex);
+    batch.done.wait(lock, [&]() { return batch.remaining == 0; });
+  }
+
+ private:
+
+  // A set of tasks issued by a single call to 'Run', counting the tasks which are not yet finished
+  struct Batch {
+    size_t remaining;
+    std::mutex mutex;
+    std::condition_variable done;
+  };
+  struct Job {
+    const std::function<void()>* task;
+    Batch* batch;
+  };
+
+  explicit ThreadPool(const size_t num_workers) {
+    for (auto i=size_t{0}; i<num_workers; ++i) {
+      workers_.push_back(std::thread([this]() {
+        while (true) {
+          {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+            if (stop_) { return; }
+          }
+          RunNext();
+        }
+      }));
+    }
+  }
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto &worker: workers_) { worker.join(); }
+  }
+
+  // Takes a single job from the queue and runs it. Returns false if the queue was empty.
+  bool RunNext() {
+    auto job = Job{};
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (queue_.empty()) { return false; }
+      job = queue_.front();
+      queue_.pop_front();
+    }
+    (*job.task)();
+    std::lock_guard<std::mutex> lock(job.batch->mutex);
+    if (--job.batch->remaining == 0) { job.batch->done.notify_all(); }
+    return true;
+  }
+
+  std::vector<std::thread> workers_;
+  std::deque<Job> queue_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  bool stop_ = false;
+};
+
+// Runs 'function(start, end)' on contiguous parts of the range [0, size) in parallel. The amount of
+// threads is limited by the hardware and by the amount of work (given per item of the range).
+void ParallelFor(const size_t size, const size_t work_per_item,
+                 const std::function<void(const size_t, const size_t)> &function) {
+  auto hardware_threads = static_cast<size_t>(std::thread::hardware_concurrency());
+  auto num_threads = std::min(std::max(hardware_threads, size_t{1}), size);
+  auto work_threads = std::max((size*work_per_item) / kMinWorkPerThread, size_t{1});
+  num_threads = std::min(num_threads, work_threads);
+  if (num_threads <= 1) {
+    function(0, size);
+    return;
+  }
+
+  // Processes the parts in the shared pool of threads, including the calling thread
+  auto part_size = CeilDiv(size, num_threads);
+  auto tasks = std::vector<std::function<void()>>();
+  for (auto start=size_t{0}; start<size; start+=part_size) {
+    auto end = std::min(start + part_size, size);
+    tasks.push_back([&function, start, end]() { function(start, end); });
+  }
+  ThreadPool::Instance().Run(tasks);
+}
+
+// =================================================================================================
+
+// Complex conjugate, which does nothing for real data-types
+template <typename T> T Conjugate(const T value) { return value; }
+template <> float2 Conjugate(const float2 value) { return std::conj(value); }
+template <> double2 Conjugate(const double2 value) { return std::conj(value); }
+
+// The real data-type of a (possibly complex) data-type
+template <typename T> using RealType = decltype(std::real(T{}));
+
+// Sets the real part of a value, leaving the imaginary part (if any) untouched
+template <typename R> void SetRealPart(R &value, const R real) { value = real; }
+template <typename R> void SetRealPart(std::complex<R> &value, const R real) { value.real(real); }
+
+// Adds the square of 'value' to the sum-of-squares 'ssq', which is scaled by 'scale'. This is done
+// in the same way as the reference BLAS and the device kernel, avoiding overflow and underflow.
+template <typename R>
+void Nrm2Update(R &scale, R &ssq, const R value) {
+  auto absolute = std::abs(value);
+  if (absolute == R{0}) { return; }
+  if (scale < absolute) {
+    ssq = R{1} + ssq * (scale / absolute) * (scale / absolute);
+    scale = absolute;
+  }
+  else {
+    ssq += (absolute / scale) * (absolute / scale);
+  }
+}
+
+// Flips the side or the triangle, used to convert a row-major problem into a column-major problem
+Side FlipSide(const Side side) {
+  return (side == Side::kLeft) ? Side::kRight : Side::kLeft;
+}
+Triangle FlipTriangle(const Triangle triangle) {
+  return (triangle == Triangle::kUpper) ? Triangle::kLower : Triangle::kUpper;
+}
+
+// Retrieves element (i,j) of op(A), in which A is a column-major matrix
+template <typename T>
+T OpElement(const T* a, const size_t a_ld, const Transpose transpose,
+            const size_t i, const size_t j) {
+  if (transpose == Transpose::kNo) { return a[i + j*a_ld]; }
+  if (transpose == Transpose::kYes) { return a[j + i*a_ld]; }
+  return Conjugate(a[j + i*a_ld]);
+}
+
+// Copies a matrix of size 'one' by 'two' of which element (i,j) is given by 'element(i,j)' into a
+// contiguous column-major matrix
+template <typename T, typename F>
+std::vector<T> PackElements(const size_t one, const size_t two, F element) {
+  auto packed = std::vector<T>(one*two);
+  for (auto j=size_t{0}; j<two; ++j) {
+    for (auto i=size_t{0}; i<one; ++i) {
+      packed[i + j*one] = element(i, j);
+    }
+  }
+  return packed;
+}
+
+// Copies op(A) of size 'one' by 'two' into a contiguous column-major matrix
+template <typename T>
+std::vector<T> PackOp(const T* a, const size_t a_ld, const Transpose transpose,
+                      const size_t one, const size_t two) {
+  return PackElements<T>(one, two, [&](const size_t i, const size_t j) {
+    return OpElement(a, a_ld, transpose, i, j);
+  });
+}
+
+// Returns the element-wise complex conjugate of a packed matrix
+template <typename T>
+std::vector<T> Conjugated(const std::vector<T> &packed) {
+  auto result = std::vector<T>(packed.size());
+  std::transform(packed.begin(), packed.end(), result.begin(), Conjugate<T>);
+  return result;
+}
+
+// Scales a column (or part of it) by beta. As in the reference BLAS and the device kernels, the
+// column is not read for a beta of zero, such that any NaN or infinite values are overwritten.
+template <typename T, typename S>
+void ScaleColumn(T* c, const size_t length, const S beta) {
+  if (beta == S{0}) { std::fill(c, c + length, T{0}); return; }
+  for (auto i=size_t{0}; i<length; ++i) { c[i] *= beta; }
+}
+
+// The types of matrices of which only one triangle is stored
+enum class MatrixType { kSymmetric, kHermitian, kTriangular, kUnitTriangular };
+
+// Retrieves element (i,j) of a column-major matrix of which only the given triangle is stored,
+// reading the stored triangle in place. This is the host equivalent of the '*ToSquared' kernels of
+// the device routines, without creating the full matrix.
+template <typename T>
+T TriangleElement(const T* a, const size_t a_ld, const Triangle triangle, const MatrixType type,
+                  const size_t i, const size_t j) {
+  if (i == j) {
+    if (type == MatrixType::kUnitTriangular) { return T{1}; }
+    auto value = a[i + j*a_ld];
+    return (type == MatrixType::kHermitian) ? (value + Conjugate(value)) / T{2} : value;
+  }
+  auto stored = (triangle == Triangle::kUpper) ? (i < j) : (i > j);
+  if (stored) { return a[i + j*a_ld]; }
+  if (type == MatrixType::kTriangular || type == MatrixType::kUnitTriangular) { return T{0}; }
+  return (type == MatrixType::kHermitian) ? Conjugate(a[j + i*a_ld]) : a[j + i*a_ld];
+}
+
+// Computes "C := alpha1 * X1 * Y1^T + alpha2 * X2 * Y2^T + beta * C" for only the given triangle of
+// the column-major n-by-n matrix C. The X and Y matrices are packed n-by-k matrices; the second
+// term is omitted if X2 is empty. This serves all rank-k and rank-2k updates.
+template <typename T, typename S>
+void TriangularUpdate(const Triangle triangle, const size_t n, const size_t k, const S beta,
+                      T* c, const size_t c_ld,
+                      const T alpha1, const std::vector<T> &x1, const std::vector<T> &y1,
+                      const T alpha2, const std::vector<T> &x2, const std::vector<T> &y2) {
+  ParallelFor(n, (n*k)/2 + 1, [&](const size_t start, const size_t end) {
+    for (auto j=start; j<end; ++j) {
+      auto i_start = (triangle == Triangle::kUpper) ? 0 : j;
+      auto i_end = (triangle == Triangle::kUpper) ? j + 1 : n;
+      auto c_column = c + j*c_ld;
+      ScaleColumn(c_column + i_start, i_end - i_start, beta);
+      for (auto l=size_t{0}; l<k; ++l) {
+        auto value1 = alpha1 * y1[j + l*n];
+        auto x1_column = x1.data() + l*n;
+        for (auto i=i_start; i<i_end; ++i) { c_column[i] += value1 * x1_column[i]; }
+        if (!x2.empty()) {
+          auto value2 = alpha2 * y2[j + l*n];
+          auto x2_column = x2.data() + l*n;
+          for (auto i=i_start; i<i_end; ++i) { c_column[i] += value2 * x2_column[i]; }
+        }
+      }
+    }
+  });
+}
+
+// Sets the imaginary part of the diagonal of a column-major n-by-n matrix to zero
+template <typename T>
+void ZeroDiagonalImag(const size_t n, T* c, const size_t c_ld) {
+  for (auto i=size_t{0}; i<n; ++i) {
+    c[i + i*c_ld] = (c[i + i*c_ld] + Conjugate(c[i + i*c_ld])) / T{2};
+  }
+}
+
+// =================================================================================================
+
+// AXPY: each thread processes a contiguous part of the vectors
+template <typename T>
+void HostAxpy(const size_t n, const T alpha,
+              const T* x, const size_t x_inc,
+              T* y, const size_t y_inc) {
+  ParallelFor(n, 1, [&](const size_t start, const size_t end) {
+    for (auto i=start; i<end; ++i) { y[i*y_inc] += alpha * x[i*x_inc]; }
+  });
+}
+
+// SCAL/COPY/SWAP: each thread processes a contiguous part of the vectors
+template <typename T>
+void HostScal(const size_t n, const T alpha,
+              T* x, const size_t x_inc) {
+  ParallelFor(n, 1, [&](const size_t start, const size_t end) {
+    for (auto i=start; i<end; ++i) { x[i*x_inc] *= alpha; }
+  });
+}
+template <typename T>
+void HostCopy(const size_t n,
+              const T* x, const size_t x_inc,
+              T* y, const size_t y_inc) {
+  ParallelFor(n, 1, [&](const size_t start, const size_t end) {
+    for (auto i=start; i<end; ++i) { y[i*y_inc] = x[i*x_inc]; }
+  });
+}
+template <typename T>
+void HostSwap(const size_t n,
+              T* x, const size_t x_inc,
+              T* y, const size_t y_inc) {
+  ParallelFor(n, 1, [&](const size_t start, const size_t end) {
+    for (auto i=start; i<end; ++i) { std::swap(x[i*x_inc], y[i*y_inc]); }
+  });
+}
+
+// ROT/ROTM: each thread processes a contiguous part of the vectors. For ROTM, the flag in the first
+// element of the parameter array determines which elements of H are implicit (see xrot.opencl).
+template <typename T>
+void HostRot(const size_t n,
+             T* x, const size_t x_inc,
+             T* y, const size_t y_inc,
+             const T c, const T s) {
+  ParallelFor(n, 1, [&](const size_t start, const size_t end) {
+    for (auto i=start; i<end; ++i) {
+      const auto x_value = x[i*x_inc];
+      const auto y_value = y[i*y_inc];
+      x[i*x_inc] = c*x_value + s*y_value;
+      y[i*y_inc] = c*y_value - s*x_value;
+    }
+  });
+}
+template <typename T>
+void HostRotm(const size_t n,
+              T* x, const size_t x_inc,
+              T* y, const size_t y_inc,
+              const T* param) {
+  const auto flag = param[0];
+  if (flag == T{-2}) { return; }
+  const auto h11 = (flag == T{0}) ? T{1} : param[1];
+  const auto h21 = (flag > T{0}) ? T{-1} : param[2];
+  const auto h12 = (flag > T{0}) ? T{1} : param[3];
+  const auto h22 = (flag == T{0}) ? T{1} : param[4];
+  ParallelFor(n, 1, [&](const size_t start, const size_t end) {
+    for (auto i=start; i<end; ++i) {
+      const auto x_value = x[i*x_inc];
+      const auto y_value = y[i*y_inc];
+      x[i*x_inc] = h11*x_value + h12*y_value;
+      y[i*y_inc] = h21*x_value + h22*y_value;
+    }
+  });
+}
+
+// DOT: the vectors are split in chunks of a fixed size, such that the partial sums (and thus the
+// rounding of the result) do not depend on the number of threads. The optional conjugate is on X.
+template <typename T>
+void HostDot(const size_t n, T* dot,
+             const T* x, const size_t x_inc,
+             const T* y, const size_t y_inc,
+             const bool do_conjugate) {
+  const auto chunk = size_t{1024};
+  auto partials = std::vector<T>(CeilDiv(n, chunk));
+  ParallelFor(partials.size(), chunk, [&](const size_t start, const size_t end) {
+    for (auto c=start; c<end; ++c) {
+      auto sum = T{0};
+      for (auto i=c*chunk; i<std::min((c + 1)*chunk, n); ++i) {
+        auto value = (do_conjugate) ? Conjugate(x[i*x_inc]) : x[i*x_inc];
+        sum += value * y[i*y_inc];
+      }
+      partials[c] = sum;
+    }
+  });
+  *dot = T{0};
+  for (const auto &partial: partials) { *dot += partial; }
+}
+
+// DSDOT/SDSDOT: as DOT, but the single-precision inputs are accumulated in double precision. The
+// scalar 'sb' is added before the final rounding to the type of the result.
+template <typename T>
+void HostDsdot(const size_t n, T* dot,
+               const float* x, const size_t x_inc,
+               const float* y, const size_t y_inc,
+               const float sb) {
+  const auto chunk = size_t{1024};
+  auto partials = std::vector<double>(CeilDiv(n, chunk));
+  ParallelFor(partials.size(), chunk, [&](const size_t start, const size_t end) {
+    for (auto c=start; c<end; ++c) {
+      auto sum = double{0};
+      for (auto i=c*chunk; i<std::min((c + 1)*chunk, n); ++i) {
+        sum += static_cast<double>(x[i*x_inc]) * static_cast<double>(y[i*y_inc]);
+      }
+      partials[c] = sum;
+    }
+  });
+  auto result = static_cast<double>(sb);
+  for (const auto &partial: partials) { result += partial; }
+  *dot = static_cast<T>(result);
+}
+
+// NRM2: computes scaled sums-of-squares per chunk of the vector, which are then combined. The real
+// and imaginary parts of complex values are treated as separate elements, as in the reference BLAS.
+template <typename T>
+void HostNrm2(const size_t n, T* nrm2,
+              const T* x, const size_t x_inc) {
+  using R = RealType<T>;
+  const auto chunk = size_t{1024};
+  auto scales = std::vector<R>(CeilDiv(n, chunk), R{0});
+  auto ssqs = std::vector<R>(scales.size(), R{1});
+  ParallelFor(scales.size(), chunk, [&](const size_t start, const size_t end) {
+    for (auto c=start; c<end; ++c) {
+      for (auto i=c*chunk; i<std::min((c + 1)*chunk, n); ++i) {
+        Nrm2Update(scales[c], ssqs[c], std::real(x[i*x_inc]));
+        Nrm2Update(scales[c], ssqs[c], std::imag(x[i*x_inc]));
+      }
+    }
+  });
+  auto scale = R{0};
+  auto ssq = R{1};
+  for (auto c=size_t{0}; c<scales.size(); ++c) {
+    if (scales[c] == R{0}) { continue; }
+    if (scale < scales[c]) {
+      ssq = ssqs[c] + ssq * (scale / scales[c]) * (scale / scales[c]);
+      scale = scales[c];
+    }
+    else {
+      ssq += ssqs[c] * (scales[c] / scale) * (scales[c] / scale);
+    }
+  }
+  SetRealPart(*nrm2, scale * std::sqrt(ssq));
+}
+
+// ASUM: sums the absolute values of the real and imaginary parts, with partial sums per chunk
+template <typename T>
+void HostAsum(const size_t n, T* asum,
+              const T* x, const size_t x_inc) {
+  using R = RealType<T>;
+  const auto chunk = size_t{1024};
+  auto partials = std::vector<R>(CeilDiv(n, chunk));
+  ParallelFor(partials.size(), chunk, [&](const size_t start, const size_t end) {
+    for (auto c=start; c<end; ++c) {
+      auto sum = R{0};
+      for (auto i=c*chunk; i<std::min((c + 1)*chunk, n); ++i) {
+        sum += std::abs(std::real(x[i*x_inc])) + std::abs(std::imag(x[i*x_inc]));
+      }
+      partials[c] = sum;
+    }
+  });
+  auto sum = R{0};
+  for (const auto &partial: partials) { sum += partial; }
+  SetRealPart(*asum, sum);
+}
+
+// AMAX/AMIN: each chunk finds its own (value, index) pair, after which the pairs are combined in
+// order. Ties are broken by taking the lowest index and NaN values are never selected.
+template <typename T>
+void HostAmax(const size_t n, unsigned int* imax,
+              const T* x, const size_t x_inc,
+              const bool do_min) {
+  using R = RealType<T>;
+  const auto chunk = size_t{1024};
+  auto is_better = [&](const R value, const R best) {
+    return (do_min) ? (value < best) : (value > best);
+  };
+  auto values = std::vector<R>(CeilDiv(n, chunk));
+  auto indices = std::vector<size_t>(CeilDiv(n, chunk), n);
+  ParallelFor(values.size(), chunk, [&](const size_t start, const size_t end) {
+    for (auto c=start; c<end; ++c) {
+      for (auto i=c*chunk; i<std::min((c + 1)*chunk, n); ++i) {
+        auto value = std::abs(std::real(x[i*x_inc])) + std::abs(std::imag(x[i*x_inc]));
+        if (std::isnan(value)) { continue; }
+        if (indices[c] == n || is_better(value, values[c])) { values[c] = value; indices[c] = i; }
+      }
+    }
+  });
+  auto best = values.size();
+  for (auto c=size_t{0}; c<values.size(); ++c) {
+    if (indices[c] == n) { continue; }
+    if (best == values.size() || is_better(values[c], values[best])) { best = c; }
+  }
+  *imax = static_cast<unsigned int>((best == values.size()) ? 0 : indices[best]);
+}
+
+// GEMV: uses the same definitions of the rotated and conjugated matrix as the device routine. Each
+// thread computes a part of Y. Matrix A is traversed along its first dimension in both cases.
+template <typename T>
+void HostGemv(const Layout layout, const Transpose a_transpose,
+              const size_t m, const size_t n, const T alpha,
+              const T* a, const size_t a_ld,
+              const T* x, const size_t x_inc, const T beta,
+              T* y, const size_t y_inc) {
+  auto a_transposed = (a_transpose != Transpose::kNo);
+  auto m_real = (a_transposed) ? n : m;
+  auto n_real = (a_transposed) ? m : n;
+  auto a_rotated = a_transposed ^ (layout == Layout::kRowMajor);
+  auto a_conjugate = (a_transpose == Transpose::kConjugate);
+  auto element = [&](const size_t index) {
+    return (a_conjugate) ? Conjugate(a[index]) : a[index];
+  };
+  ParallelFor(m_real, n_real, [&](const size_t start, const size_t end) {
+
+    // Rotated: computes a dot-product per element of Y
+    if (a_rotated) {
+      for (auto i=start; i<end; ++i) {
+        auto sum = T{0};
+        for (auto j=size_t{0}; j<n_real; ++j) { sum += element(j + i*a_ld) * x[j*x_inc]; }
+        y[i*y_inc] = alpha*sum + beta*y[i*y_inc];
+      }
+    }
+
+    // Non-rotated: adds a scaled column of A to Y for each element of X
+    else {
+      for (auto i=start; i<end; ++i) {
+        y[i*y_inc] = beta*y[i*y_inc];
+      }
+      for (auto j=size_t{0}; j<n_real; ++j) {
+        auto value = alpha * x[j*x_inc];
+        for (auto i=start; i<end; ++i) { y[i*y_inc] += element(i + j*a_ld) * value; }
+      }
+    }
+  });
+}
+
+// GER: A row-major matrix is treated as its column-major transpose, with the roles of X and Y
+// swapped. Each thread updates a range of columns, each of which is a unit-stride update of A.
+template <typename T>
+void HostGer(const Layout layout,
+             const size_t m, const size_t n, const T alpha,
+             const T* x, const size_t x_inc,
+             const T* y, const size_t y_inc,
+             T* a, const size_t a_ld,
+             const bool do_conjugate) {
+  auto row_major = (layout == Layout::kRowMajor);
+  auto one = (row_major) ? n : m;
+  auto two = (row_major) ? m : n;
+  auto u = (row_major) ? y : x;
+  auto v = (row_major) ? x : y;
+  auto u_inc = (row_major) ? y_inc : x_inc;
+  auto v_inc = (row_major) ? x_inc : y_inc;
+  ParallelFor(two, one, [&](const size_t start, const size_t end) {
+    for (auto j=start; j<end; ++j) {
+      auto value = (do_conjugate && !row_major) ? alpha*Conjugate(v[j*v_inc]) : alpha*v[j*v_inc];
+      auto a_column = a + j*a_ld;
+      for (auto i=size_t{0}; i<one; ++i) {
+        auto u_value = (do_conjugate && row_major) ? Conjugate(u[i*u_inc]) : u[i*u_inc];
+        a_column[i] += u_value * value;
+      }
+    }
+  });
+}
+
+// SYMV/HEMV: the elements of the full matrix are read from the stored triangle. A row-major matrix
+// is seen as its column-major transpose, of which the other triangle is stored: for a Hermitian
+// matrix this is its conjugate. Each thread computes a part of Y, traversing the full matrix along
+// its columns.
+template <typename T>
+void HostSymv(const Layout layout, const Triangle triangle,
+              const size_t n, const T alpha,
+              const T* a, const size_t a_ld,
+              const T* x, const size_t x_inc, const T beta,
+              T* y, const size_t y_inc,
+              const bool is_hermitian) {
+  auto row_major = (layout == Layout::kRowMajor);
+  auto type = (is_hermitian) ? MatrixType::kHermitian : MatrixType::kSymmetric;
+  auto stored_triangle = (row_major) ? FlipTriangle(triangle) : triangle;
+  ParallelFor(n, n, [&](const size_t start, const size_t end) {
+    for (auto i=start; i<end; ++i) {
+      auto sum = T{0};
+      for (auto j=size_t{0}; j<n; ++j) {
+        auto value = TriangleElement(a, a_ld, stored_triangle, type, j, i);
+        if (is_hermitian && !row_major) { value = Conjugate(value); }
+        sum += value * x[j*x_inc];
+      }
+      y[i*y_inc] = alpha*sum + beta*y[i*y_inc];
+    }
+  });
+}
+
+// Retrieves element (i,j) of op(A) of a triangular matrix, using the same definitions of the
+// rotated and conjugated matrix as the device routines. The diagonal is one in case of a unit
+// diagonal.
+template <typename T>
+T TriangularElement(const Layout layout, const Transpose a_transpose, const Diagonal diagonal,
+                    const T* a, const size_t a_ld, const size_t i, const size_t j) {
+  if (i == j && diagonal == Diagonal::kUnit) { return T{1}; }
+  auto a_rotated = (a_transpose != Transpose::kNo) ^ (layout == Layout::kRowMajor);
+  auto value = (a_rotated) ? a[j + i*a_ld] : a[i + j*a_ld];
+  return (a_transpose == Transpose::kConjugate) ? Conjugate(value) : value;
+}
+
+// TRMV: each thread computes a part of X from a copy of the original X, only traversing the
+// triangle of op(A)
+template <typename T>
+void HostTrmv(const Layout layout, const Triangle triangle,
+              const Transpose a_transpose, const Diagonal diagonal,
+              const size_t n,
+              const T* a, const size_t a_ld,
+              T* x, const size_t x_inc) {
+  auto is_lower = ((triangle == Triangle::kLower) == (a_transpose == Transpose::kNo));
+  auto x_copy = std::vector<T>(n);
+  for (auto i=size_t{0}; i<n; ++i) { x_copy[i] = x[i*x_inc]; }
+  ParallelFor(n, n/2 + 1, [&](const size_t start, const size_t end) {
+    for (auto i=start; i<end; ++i) {
+      auto j_start = (is_lower) ? size_t{0} : i;
+      auto j_end = (is_lower) ? i + 1 : n;
+      auto sum = T{0};
+      for (auto j=j_start; j<j_end; ++j) {
+        sum += TriangularElement(layout, a_transpose, diagonal, a, a_ld, i, j) * x_copy[j];
+      }
+      x[i*x_inc] = sum;
+    }
+  });
+}
+
+// TRSV: forward (lower) or backward (upper) substitution. This is inherently sequential, but only
+// used for small problems.
+template <typename T>
+void HostTrsv(const Layout layout, const Triangle triangle,
+              const Transpose a_transpose, const Diagonal diagonal,
+              const size_t n,
+              const T* a, const size_t a_ld,
+              T* x, const size_t x_inc) {
+  auto is_lower = ((triangle == Triangle::kLower) == (a_transpose == Transpose::kNo));
+  for (auto step=size_t{0}; step<n; ++step) {
+    auto i = (is_lower) ? step : n - 1 - step;
+    auto j_start = (is_lower) ? size_t{0} : i + 1;
+    auto j_end = (is_lower) ? i : n;
+    auto sum = x[i*x_inc];
+    for (auto j=j_start; j<j_end; ++j) {
+      sum -= TriangularElement(layout, a_transpose, diagonal, a, a_ld, i, j) * x[j*x_inc];
+    }
+    x[i*x_inc] = sum / TriangularElement(layout, a_transpose, diagonal, a, a_ld, i, i);
+  }
+}
+
+// Retrieves element (i,j) of op(A) from the band format, using the same definitions of the rotated
+// and conjugated matrix as the Xgbmv kernel: 'kl' and 'ku' are the stored sub- and super-diagonals
+// of op(A). The element has to lie within the stored band.
+template <typename T>
+T BandElement(const T* a, const size_t a_ld, const size_t kl, const size_t ku,
+              const bool a_rotated, const bool a_conjugate, const size_t i, const size_t j) {
+  auto value = (a_rotated) ? a[(kl + j - i) + i*a_ld] : a[(ku + i - j) + j*a_ld];
+  return (a_conjugate) ? Conjugate(value) : value;
+}
+
+// Computes "y := alpha * A * x + beta * y" for an m-by-n matrix A of which the elements within the
+// band of 'kl' sub- and 'ku' super-diagonals are given by 'element(i,j)'. Each thread computes a
+// part of Y, traversing only the band. Vector X may not overlap with Y.
+template <typename T, typename F>
+void BandMatrixVector(const size_t m, const size_t n, const size_t kl, const size_t ku,
+                      const T alpha, const F &element,
+                      const T* x, const size_t x_inc, const T beta,
+                      T* y, const size_t y_inc) {
+  ParallelFor(m, kl + ku + 1, [&](const size_t start, const size_t end) {
+    for (auto i=start; i<end; ++i) {
+      auto j_start = (i > kl) ? i - kl : size_t{0};
+      auto j_end = std::min(n, i + ku + 1);
+      auto sum = T{0};
+      for (auto j=j_start; j<j_end; ++j) { sum += element(i, j) * x[j*x_inc]; }
+      y[i*y_inc] = alpha*sum + beta*y[i*y_inc];
+    }
+  });
+}
+
+// GBMV: transposing swaps the sub- and super-diagonals of the band
+template <typename T>
+void HostGbmv(const Layout layout, const Transpose a_transpose,
+              const size_t m, const size_t n, const size_t kl, const size_t ku, const T alpha,
+              const T* a, const size_t a_ld,
+              const T* x, const size_t x_inc, const T beta,
+              T* y, const size_t y_inc) {
+  auto a_transposed = (a_transpose != Transpose::kNo);
+  auto a_rotated = a_transposed ^ (layout == Layout::kRowMajor);
+  auto a_conjugate = (a_transpose == Transpose::kConjugate);
+  auto kl_real = (a_transposed) ? ku : kl;
+  auto ku_real = (a_transposed) ? kl : ku;
+  auto element = [&](const size_t i, const size_t j) {
+    return BandElement(a, a_ld, kl_real, ku_real, a_rotated, a_conjugate, i, j);
+  };
+  BandMatrixVector((a_transposed) ? n : m, (a_transposed) ? m : n, kl_real, ku_real,
+                   alpha, element, x, x_inc, beta, y, y_inc);
+}
+
+// SBMV/HBMV: the elements outside of the stored triangle are mirrored from the stored band (and
+// conjugated for a Hermitian matrix)
+template <typename T>
+void HostSbmv(const Layout layout, const Triangle triangle,
+              const size_t n, const size_t k, const T alpha,
+              const T* a, const size_t a_ld,
+              const T* x, const size_t x_inc, const T beta,
+              T* y, const size_t y_inc,
+              const bool is_hermitian) {
+  auto a_rotated = (layout == Layout::kRowMajor);
+  auto kl = (triangle == Triangle::kLower) ? k : size_t{0};
+  auto ku = (triangle == Triangle::kUpper) ? k : size_t{0};
+  auto element = [&](const size_t i, const size_t j) {
+    auto stored = (triangle == Triangle::kUpper) ? (i <= j) : (i >= j);
+    if (!stored) { return BandElement(a, a_ld, kl, ku, a_rotated, is_hermitian, j, i); }
+    auto value = BandElement(a, a_ld, kl, ku, a_rotated, false, i, j);
+    return (i == j && is_hermitian) ? (value + Conjugate(value)) / T{2} : value;
+  };
+  BandMatrixVector(n, n, k, k, alpha, element, x, x_inc, beta, y, y_inc);
+}
+
+// TBMV: each thread computes a part of X from a copy of the original X
+template <typename T>
+void HostTbmv(const Layout layout, const Triangle triangle,
+              const Transpose a_transpose, const Diagonal diagonal,
+              const size_t n, const size_t k,
+              const T* a, const size_t a_ld,
+              T* x, const size_t x_inc) {
+  auto a_rotated = (a_transpose != Transpose::kNo) ^ (layout == Layout::kRowMajor);
+  auto a_conjugate = (a_transpose == Transpose::kConjugate);
+  auto is_lower = ((triangle == Triangle::kLower) == (a_transpose == Transpose::kNo));
+  auto kl = (is_lower) ? k : size_t{0};
+  auto ku = (is_lower) ? size_t{0} : k;
+  auto element = [&](const size_t i, const size_t j) {
+    if (i == j && diagonal == Diagonal::kUnit) { return T{1}; }
+    return BandElement(a, a_ld, kl, ku, a_rotated, a_conjugate, i, j);
+  };
+  auto x_copy = std::vector<T>(n);
+  for (auto i=size_t{0}; i<n; ++i) { x_copy[i] = x[i*x_inc]; }
+  BandMatrixVector(n, n, kl, ku, T{1}, element, x_copy.data(), size_t{1}, T{0}, x, x_inc);
+}
+
+// TBSV: forward (lower) or backward (upper) substitution, only traversing the band
+template <typename T>
+void HostTbsv(const Layout layout, const Triangle triangle,
+              const Transpose a_transpose, const Diagonal diagonal,
+              const size_t n, const size_t k,
+              const T* a, const size_t a_ld,
+              T* x, const size_t x_inc) {
+  auto a_rotated = (a_transpose != Transpose::kNo) ^ (layout == Layout::kRowMajor);
+  auto a_conjugate = (a_transpose == Transpose::kConjugate);
+  auto is_lower = ((triangle == Triangle::kLower) == (a_transpose == Transpose::kNo));
+  auto kl = (is_lower) ? k : size_t{0};
+  auto ku = (is_lower) ? size_t{0} : k;
+  for (auto step=size_t{0}; step<n; ++step) {
+    auto i = (is_lower) ? step : n - 1 - step;
+    auto j_start = (is_lower) ? ((i > k) ? i - k : size_t{0}) : i + 1;
+    auto j_end = (is_lower) ? i : std::min(n, i + k + 1);
+    auto sum = x[i*x_inc];
+    for (auto j=j_start; j<j_end; ++j) {
+      sum -= BandElement(a, a_ld, kl, ku, a_rotated, a_conjugate, i, j) * x[j*x_inc];
+    }
+    x[i*x_inc] = (diagonal == Diagonal::kUnit) ? sum :
+                 sum / BandElement(a, a_ld, kl, ku, a_rotated, a_conjugate, i, i);
+  }
+}
+
+// Retrieves element (i,j) of op(A) from the packed format, using the same definitions of the
+// rotated and conjugated matrix as the Xspmv kernel. The element has to lie within the stored
+// triangle.
+template <typename T>
+T PackedElement(const T* ap, const size_t n, const bool a_rotated, const bool a_conjugate,
+                const bool is_lower, const size_t i, const size_t j) {
+  auto p = (a_rotated) ? j : i;
+  auto q = (a_rotated) ? i : j;
+  auto value = (is_lower != a_rotated) ? ap[(q*(2*n - q - 1))/2 + p] : ap[(q*(q + 1))/2 + p];
+  return (a_conjugate) ? Conjugate(value) : value;
+}
+
+// SPMV/HPMV: the elements outside of the stored triangle are mirrored from the packed triangle (and
+// conjugated for a Hermitian matrix). The full matrix is seen as a band with n-1 diagonals.
+template <typename T>
+void HostSpmv(const Layout layout, const Triangle triangle,
+              const size_t n, const T alpha,
+              const T* ap,
+              const T* x, const size_t x_inc, const T beta,
+              T* y, const size_t y_inc,
+              const bool is_hermitian) {
+  auto a_rotated = (layout == Layout::kRowMajor);
+  auto is_lower = (triangle == Triangle::kLower);
+  auto element = [&](const size_t i, const size_t j) {
+    auto stored = (is_lower) ? (i >= j) : (i <= j);
+    if (!stored) { return PackedElement(ap, n, a_rotated, is_hermitian, is_lower, j, i); }
+    auto value = PackedElement(ap, n, a_rotated, false, is_lower, i, j);
+    return (i == j && is_hermitian) ? (value + Conjugate(value)) / T{2} : value;
+  };
+  BandMatrixVector(n, n, n - 1, n - 1, alpha, element, x, x_inc, beta, y, y_inc);
+}
+
+// TPMV: each thread computes a part of X from a copy of the original X, only traversing the
+// triangle of op(A)
+template <typename T>
+void HostTpmv(const Layout layout, const Triangle triangle,
+              const Transpose a_transpose, const Diagonal diagonal,
+              const size_t n,
+              const T* ap,
+              T* x, const size_t x_inc) {
+  auto a_rotated = (a_transpose != Transpose::kNo) ^ (layout == Layout::kRowMajor);
+  auto a_conjugate = (a_transpose == Transpose::kConjugate);
+  auto is_lower = ((triangle == Triangle::kLower) == (a_transpose == Transpose::kNo));
+  auto element = [&](const size_t i, const size_t j) {
+    if (i == j && diagonal == Diagonal::kUnit) { return T{1}; }
+    return PackedElement(ap, n, a_rotated, a_conjugate, is_lower, i, j);
+  };
+  auto x_copy = std::vector<T>(n);
+  for (auto i=size_t{0}; i<n; ++i) { x_copy[i] = x[i*x_inc]; }
+  BandMatrixVector(n, n, (is_lower) ? n - 1 : size_t{0}, (is_lower) ? size_t{0} : n - 1,
+                   T{1}, element, x_copy.data(), size_t{1}, T{0}, x, x_inc);
+}
+
+// TPSV: forward (lower) or backward (upper) substitution
+template <typename T>
+void HostTpsv(const Layout layout, const Triangle triangle,
+              const Transpose a_transpose, const Diagonal diagonal,
+              const size_t n,
+              const T* ap,
+              T* x, const size_t x_inc) {
+  auto a_rotated = (a_transpose != Transpose::kNo) ^ (layout == Layout::kRowMajor);
+  auto a_conjugate = (a_transpose == Transpose::kConjugate);
+  auto is_lower = ((triangle == Triangle::kLower) == (a_transpose == Transpose::kNo));
+  for (auto step=size_t{0}; step<n; ++step) {
+    auto i = (is_lower) ? step : n - 1 - step;
+    auto j_start = (is_lower) ? size_t{0} : i + 1;
+    auto j_end = (is_lower) ? i : n;
+    auto sum = x[i*x_inc];
+    for (auto j=j_start; j<j_end; ++j) {
+      sum -= PackedElement(ap, n, a_rotated, a_conjugate, is_lower, i, j) * x[j*x_inc];
+    }
+    x[i*x_inc] = (diagonal == Diagonal::kUnit) ? sum :
+                 sum / PackedElement(ap, n, a_rotated, a_conjugate, is_lower, i, i);
+  }
+}
+
+// SPR/HPR: each thread updates a range of packed columns (or rows for a row-major layout), each of
+// which is a unit-stride update of AP. The imaginary part of the diagonal of a Hermitian matrix is
+// set to zero.
+template <typename T>
+void HostSpr(const Layout layout, const Triangle triangle,
+             const size_t n, const T alpha,
+             const T* x, const size_t x_inc,
+             T* ap,
+             const bool is_hermitian) {
+  auto a_rotated = (layout == Layout::kRowMajor);
+  auto is_lower = (triangle == Triangle::kLower);
+  auto from_diagonal = (is_lower != a_rotated);
+  ParallelFor(n, n/2 + 1, [&](const size_t start, const size_t end) {
+    for (auto q=start; q<end; ++q) {
+      auto a_vector = ap + ((from_diagonal) ? (q*(2*n - q - 1))/2 : (q*(q + 1))/2);
+      auto p_start = (from_diagonal) ? q : size_t{0};
+      auto p_end = (from_diagonal) ? n : q + 1;
+      for (auto p=p_start; p<p_end; ++p) {
+        auto i = (a_rotated) ? q : p;
+        auto j = (a_rotated) ? p : q;
+        auto x_j = (is_hermitian) ? Conjugate(x[j*x_inc]) : x[j*x_inc];
+        auto value = a_vector[p] + alpha * x[i*x_inc] * x_j;
+        a_vector[p] = (i == j && is_hermitian) ? (value + Conjugate(value)) / T{2} : value;
+      }
+    }
+  });
+}
+
+// SYR/HER/SYR2/HER2: as SPR/HPR, each thread updates a range of columns (or rows for a row-major
+// layout) of the stored triangle of A, each of which is a unit-stride update. For a rank-1 update Y
+// is X, and the second product of a Hermitian rank-2 update uses the conjugated alpha.
+template <typename T>
+void HostSyr2(const Layout layout, const Triangle triangle,
+              const size_t n, const T alpha,
+              const T* x, const size_t x_inc,
+              const T* y, const size_t y_inc,
+              T* a, const size_t a_ld,
+              const bool is_rank_two, const bool is_hermitian) {
+  auto a_rotated = (layout == Layout::kRowMajor);
+  auto from_diagonal = ((triangle == Triangle::kLower) != a_rotated);
+  auto alpha2 = (is_hermitian) ? Conjugate(alpha) : alpha;
+  ParallelFor(n, n/2 + 1, [&](const size_t start, const size_t end) {
+    for (auto q=start; q<end; ++q) {
+      auto a_vector = a + q*a_ld;
+      auto p_start = (from_diagonal) ? q : size_t{0};
+      auto p_end = (from_diagonal) ? n : q + 1;
+      for (auto p=p_start; p<p_end; ++p) {
+        auto i = (a_rotated) ? q : p;
+        auto j = (a_rotated) ? p : q;
+        auto y_j = (is_hermitian) ? Conjugate(y[j*y_inc]) : y[j*y_inc];
+        auto value = a_vector[p] + alpha * x[i*x_inc] * y_j;
+        if (is_rank_two) {
+          auto x_j = (is_hermitian) ? Conjugate(x[j*x_inc]) : x[j*x_inc];
+          value += alpha2 * y[i*y_inc] * x_j;
+        }
+        a_vector[p] = (i == j && is_hermitian) ? (value + Conjugate(value)) / T{2} : value;
+      }
+    }
+  });
+}
+
+// =================================================================================================
+
+// The core of the level-3 routines: computes "C := alpha * A * B + beta * C" for a column-major
+// m-by-n matrix C, in which A is a packed column-major m-by-k matrix and element (l,j) of B is
+// given by 'b_element(l,j)'. Each thread computes a range of columns of C in cache-blocks of A:
+// panels of kBlockK columns of kBlockM elements. Within a panel, four columns of C are updated at a
+// time, such that each loaded element of A is used four times. The inner loops are unit-stride.
+template <typename T, typename F>
+void GemmPacked(const size_t m, const size_t n, const size_t k, const T alpha,
+                const std::vector<T> &a_packed, F b_element, const T beta,
+                T* c, const size_t c_ld) {
+  ParallelFor(n, m*k, [&](const size_t start, const size_t end) {
+    for (auto j=start; j<end; ++j) { ScaleColumn(c + j*c_ld, m, beta); }
+    for (auto i_block=size_t{0}; i_block<m; i_block+=kBlockM) {
+      auto i_end = std::min(i_block + kBlockM, m);
+      for (auto l_block=size_t{0}; l_block<k; l_block+=kBlockK) {
+        auto l_end = std::min(l_block + kBlockK, k);
+        auto j = start;
+        for (; j + 4 <= end; j += 4) {
+          auto c0 = c + j*c_ld;
+          auto c1 = c0 + c_ld;
+          auto c2 = c1 + c_ld;
+          auto c3 = c2 + c_ld;
+          for (auto l=l_block; l<l_end; ++l) {
+            auto b0 = alpha * b_element(l, j);
+            auto b1 = alpha * b_element(l, j + 1);
+            auto b2 = alpha * b_element(l, j + 2);
+            auto b3 = alpha * b_element(l, j + 3);
+            auto a_column = a_packed.data() + l*m;
+            for (auto i=i_block; i<i_end; ++i) {
+              auto a_value = a_column[i];
+              c0[i] += b0 * a_value;
+              c1[i] += b1 * a_value;
+              c2[i] += b2 * a_value;
+              c3[i] += b3 * a_value;
+            }
+          }
+        }
+        for (; j<end; ++j) {
+          auto c_column = c + j*c_ld;
+          for (auto l=l_block; l<l_end; ++l) {
+            auto value = alpha * b_element(l, j);
+            auto a_column = a_packed.data() + l*m;
+            for (auto i=i_block; i<i_end; ++i) { c_column[i] += value * a_column[i]; }
+          }
+        }
+      }
+    }
+  });
+}
+
+// GEMM: op(A) is first packed into a contiguous matrix, after which the core above computes C
+template <typename T>
+void HostGemm(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+              const size_t m, const size_t n, const size_t k, const T alpha,
+              const T* a, const size_t a_ld,
+              const T* b, const size_t b_ld, const T beta,
+              T* c, const size_t c_ld) {
+
+  // A row-major problem is equal to the column-major problem "C^T := op(B)^T * op(A)^T"
+  if (layout == Layout::kRowMajor) {
+    HostGemm(Layout::kColMajor, b_transpose, a_transpose, n, m, k, alpha,
+             b, b_ld, a, a_ld, beta, c, c_ld);
+    return;
+  }
+
+  auto a_packed = PackOp(a, a_ld, a_transpose, m, k);
+  GemmPacked(m, n, k, alpha, a_packed, [&](const size_t l, const size_t j) {
+    return OpElement(b, b_ld, b_transpose, l, j);
+  }, beta, c, c_ld);
+}
+
+// SYMM/HEMM: runs the GEMM core on the elements of the symmetric/hermitian matrix, which are read
+// from the stored triangle. On the left side it is packed as op(A) is in GEMM, on the right side
+// its elements are read in place as those of B.
+template <typename T>
+void SymmetricMultiply(const Layout layout, const Side side, const Triangle triangle,
+                       const MatrixType type, const size_t m, const size_t n, const T alpha,
+                       const T* a, const size_t a_ld,
+                       const T* b, const size_t b_ld, const T beta,
+                       T* c, const size_t c_ld) {
+
+  // A row-major problem is equal to the column-major problem with the other side and triangle
+  if (layout == Layout::kRowMajor) {
+    SymmetricMultiply(Layout::kColMajor, FlipSide(side), FlipTriangle(triangle), type, n, m, alpha,
+                      a, a_ld, b, b_ld, beta, c, c_ld);
+    return;
+  }
+  auto a_element = [&](const size_t i, const size_t j) {
+    return TriangleElement(a, a_ld, triangle, type, i, j);
+  };
+  if (side == Side::kLeft) {
+    auto a_packed = PackElements<T>(m, m, a_element);
+    GemmPacked(m, n, m, alpha, a_packed, [&](const size_t l, const size_t j) {
+      return b[l + j*b_ld];
+    }, beta, c, c_ld);
+  }
+  else {
+    auto b_packed = PackOp(b, b_ld, Transpose::kNo, m, n);
+    GemmPacked(m, n, n, alpha, b_packed, a_element, beta, c, c_ld);
+  }
+}
+template <typename T>
+void HostSymm(const Layout layout, const Side side, const Triangle triangle,
+              const size_t m, const size_t n, const T alpha,
+              const T* a, const size_t a_ld,
+              const T* b, const size_t b_ld, const T beta,
+              T* c, const size_t c_ld) {
+  SymmetricMultiply(layout, side, triangle, MatrixType::kSymmetric, m, n, alpha,
+                    a, a_ld, b, b_ld, beta, c, c_ld);
+}
+template <typename T>
+void HostHemm(const Layout layout, const Side side, const Triangle triangle,
+              const size_t m, const size_t n, const T alpha,
+              const T* a, const size_t a_ld,
+              const T* b, const size_t b_ld, const T beta,
+              T* c, const size_t c_ld) {
+  SymmetricMultiply(layout, side, triangle, MatrixType::kHermitian, m, n, alpha,
+                    a, a_ld, b, b_ld, beta, c, c_ld);
+}
+
+// SYRK: computes only the requested triangle of C. The symmetric rank-k update never conjugates.
+template <typename T>
+void HostSyrk(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+              const size_t n, const size_t k, const T alpha,
+              const T* a, const size_t a_ld, const T beta,
+              T* c, const size_t c_ld) {
+  auto transpose = (a_transpose == Transpose::kNo) ? Transpose::kNo : Transpose::kYes;
+  if (layout == Layout::kRowMajor) {
+    auto other = (transpose == Transpose::kNo) ? Transpose::kYes : Transpose::kNo;
+    HostSyrk(Layout::kColMajor, FlipTriangle(triangle), other, n, k, alpha,
+             a, a_ld, beta, c, c_ld);
+    return;
+  }
+  auto a_packed = PackOp(a, a_ld, transpose, n, k);
+  TriangularUpdate(triangle, n, k, beta, c, c_ld,
+                   alpha, a_packed, a_packed, T{0}, std::vector<T>(), std::vector<T>());
+}
+
+// HERK: as SYRK, but any transpose is a conjugate transpose
+template <typename T, typename U>
+void HostHerk(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+              const size_t n, const size_t k, const U alpha,
+              const T* a, const size_t a_ld, const U beta,
+              T* c, const size_t c_ld) {
+  auto transpose = (a_transpose == Transpose::kNo) ? Transpose::kNo : Transpose::kConjugate;
+  if (layout == Layout::kRowMajor) {
+    auto other = (transpose == Transpose::kNo) ? Transpose::kConjugate : Transpose::kNo;
+    HostHerk(Layout::kColMajor, FlipTriangle(triangle), other, n, k, alpha,
+             a, a_ld, beta, c, c_ld);
+    return;
+  }
+  auto a_packed = PackOp(a, a_ld, transpose, n, k);
+  TriangularUpdate(triangle, n, k, beta, c, c_ld,
+                   T{alpha}, a_packed, Conjugated(a_packed),
+                   T{0}, std::vector<T>(), std::vector<T>());
+  ZeroDiagonalImag(n, c, c_ld);
+}
+
+// SYR2K: computes both products in a single pass over the requested triangle of C
+template <typename T>
+void HostSyr2k(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+               const size_t n, const size_t k, const T alpha,
+               const T* a, const size_t a_ld,
+               const T* b, const size_t b_ld, const T beta,
+               T* c, const size_t c_ld) {
+  auto transpose = (ab_transpose == Transpose::kNo) ? Transpose::kNo : Transpose::kYes;
+  if (layout == Layout::kRowMajor) {
+    auto other = (transpose == Transpose::kNo) ? Transpose::kYes : Transpose::kNo;
+    HostSyr2k(Layout::kColMajor, FlipTriangle(triangle), other, n, k, alpha,
+              a, a_ld, b, b_ld, beta, c, c_ld);
+    return;
+  }
+  auto a_packed = PackOp(a, a_ld, transpose, n, k);
+  auto b_packed = PackOp(b, b_ld, transpose, n, k);
+  TriangularUpdate(triangle, n, k, beta, c, c_ld,
+                   alpha, a_packed, b_packed, alpha, b_packed, a_packed);
+}
+
+// HER2K: as SYR2K, but with conjugate transposes and a conjugated alpha for the second product. In
+// row-major layout, matrices A and B swap roles.
+template <typename T, typename U>
+void HostHer2k(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+               const size_t n, const size_t k, const T alpha,
+               const T* a, const size_t a_ld,
+               const T* b, const size_t b_ld, const U beta,
+               T* c, const size_t c_ld) {
+  auto transpose = (ab_transpose == Transpose::kNo) ? Transpose::kNo : Transpose::kConjugate;
+  if (layout == Layout::kRowMajor) {
+    auto other = (transpose == Transpose::kNo) ? Transpose::kConjugate : Transpose::kNo;
+    HostHer2k(Layout::kColMajor, FlipTriangle(triangle), other, n, k, alpha,
+              b, b_ld, a, a_ld, beta, c, c_ld);
+    return;
+  }
+  auto a_packed = PackOp(a, a_ld, transpose, n, k);
+  auto b_packed = PackOp(b, b_ld, transpose, n, k);
+  TriangularUpdate(triangle, n, k, beta, c, c_ld,
+                   alpha, a_packed, Conjugated(b_packed),
+                   Conjugate(alpha), b_packed, Conjugated(a_packed));
+  ZeroDiagonalImag(n, c, c_ld);
+}
+
+// TRMM: runs the GEMM core on a copy of B and on the elements of op(A), which are read from the
+// stored triangle. As for SYMM, op(A) is packed on the left side and read in place on the right.
+template <typename T>
+void HostTrmm(const Layout layout, const Side side, const Triangle triangle,
+              const Transpose a_transpose, const Diagonal diagonal,
+              const size_t m, const size_t n, const T alpha,
+              const T* a, const size_t a_ld,
+              T* b, const size_t b_ld) {
+
+  // A row-major problem is equal to the column-major problem with the other side and triangle
+  if (layout == Layout::kRowMajor) {
+    HostTrmm(Layout::kColMajor, FlipSide(side), FlipTriangle(triangle), a_transpose, diagonal,
+             n, m, alpha, a, a_ld, b, b_ld);
+    return;
+  }
+  auto type = (diagonal == Diagonal::kUnit) ? MatrixType::kUnitTriangular : MatrixType::kTriangular;
+  auto op_a_element = [&](const size_t i, const size_t j) -> T {
+    if (a_transpose == Transpose::kNo) { return TriangleElement(a, a_ld, triangle, type, i, j); }
+    auto value = TriangleElement(a, a_ld, triangle, type, j, i);
+    return (a_transpose == Transpose::kConjugate) ? Conjugate(value) : value;
+  };
+  auto b_copy = PackOp(static_cast<const T*>(b), b_ld, Transpose::kNo, m, n);
+  if (side == Side::kLeft) {
+    auto a_packed = PackElements<T>(m, m, op_a_element);
+    GemmPacked(m, n, m, alpha, a_packed, [&](const size_t l, const size_t j) {
+      return b_copy[l + j*m];
+    }, T{0}, b, b_ld);
+  }
+  else {
+    GemmPacked(m, n, n, alpha, b_copy, op_a_element, T{0}, b, b_ld);
+  }
+}
+
+// =================================================================================================
+
+// Converts half-precision data into single-precision and back. The spans of the vectors and
+// matrices are converted as a whole: the conversions are exact, such that elements which are not
+// part of the problem (e.g. in between strided elements) are written back unchanged.
+std::vector<float> HalfToFloatVector(const half* data, const size_t size) {
+  auto result = std::vector<float>(size);
+  std::transform(data, data + size, result.begin(), HalfToFloat);
+  return result;
+}
+void FloatToHalfVector(const std::vector<float> &data, half* result) {
+  std::transform(data.begin(), data.end(), result, FloatToHalf);
+}
+
+// The amount of elements spanned by a vector of 'n' elements, or by a matrix of 'two' columns of
+// 'one' elements each
+size_t VectorSpan(const size_t n, const size_t inc) {
+  return (n == 0) ? 0 : (n - 1)*inc + 1;
+}
+size_t MatrixSpan(const size_t one, const size_t two, const size_t ld) {
+  return (one == 0 || two == 0) ? 0 : (two - 1)*ld + one;
+}
+
+// AXPY in half-precision: computed by the single-precision version
+template <>
+void HostAxpy(const size_t n, const half alpha,
+              const half* x, const size_t x_inc,
+              half* y, const size_t y_inc) {
+  auto x_float = HalfToFloatVector(x, VectorSpan(n, x_inc));
+  auto y_float = HalfToFloatVector(y, VectorSpan(n, y_inc));
+  HostAxpy(n, HalfToFloat(alpha), x_float.data(), x_inc, y_float.data(), y_inc);
+  FloatToHalfVector(y_float, y);
+}
+
+// GEMV in half-precision: computed by the single-precision version
+template <>
+void HostGemv(const Layout layout, const Transpose a_transpose,
+              const size_t m, const size_t n, const half alpha,
+              const half* a, const size_t a_ld,
+              const half* x, const size_t x_inc, const half beta,
+              half* y, const size_t y_inc) {
+  auto a_transposed = (a_transpose != Transpose::kNo);
+  auto a_one = (layout == Layout::kColMajor) ? m : n;
+  auto a_two = (layout == Layout::kColMajor) ? n : m;
+  auto a_float = HalfToFloatVector(a, MatrixSpan(a_one, a_two, a_ld));
+  auto x_float = HalfToFloatVector(x, VectorSpan((a_transposed) ? m : n, x_inc));
+  auto y_float = HalfToFloatVector(y, VectorSpan((a_transposed) ? n : m, y_inc));
+  HostGemv(layout, a_transpose, m, n, HalfToFloat(alpha), a_float.data(), a_ld,
+           x_float.data(), x_inc, HalfToFloat(beta), y_float.data(), y_inc);
+  FloatToHalfVector(y_float, y);
+}
+
+// GEMM in half-precision: computed by the single-precision version. The dimensions of the stored
+// matrices follow the definitions of the device routine.
+template <>
+void HostGemm(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+              const size_t m, const size_t n, const size_t k, const half alpha,
+              const half* a, const size_t a_ld,
+              const half* b, const size_t b_ld, const half beta,
+              half* c, const size_t c_ld) {
+  auto a_rotated = (layout == Layout::kColMajor) == (a_transpose != Transpose::kNo);
+  auto b_rotated = (layout == Layout::kColMajor) == (b_transpose != Transpose::kNo);
+  auto c_rotated = (layout == Layout::kRowMajor);
+  auto a_float = HalfToFloatVector(a, MatrixSpan((a_rotated) ? k : m, (a_rotated) ? m : k, a_ld));
+  auto b_float = HalfToFloatVector(b, MatrixSpan((b_rotated) ? n : k, (b_rotated) ? k : n, b_ld));
+  auto c_float = HalfToFloatVector(c, MatrixSpan((c_rotated) ? n : m, (c_rotated) ? m : n, c_ld));
+  HostGemm(layout, a_transpose, b_transpose, m, n, k, HalfToFloat(alpha),
+           a_float.data(), a_ld, b_float.data(), b_ld, HalfToFloat(beta), c_float.data(), c_ld);
+  FloatToHalfVector(c_float, c);
+}
+
+// =================================================================================================
+
+// Compiles the templated functions
+template void HostAxpy<float>(const size_t, const float,
+                              const float*, const size_t,
+                              float*, const size_t);
+template void HostAxpy<double>(const size_t, const double,
+                               const double*, const size_t,
+                               double*, const size_t);
+template void HostAxpy<float2>(const size_t, const float2,
+                               const float2*, const size_t,
+                               float2*, const size_t);
+template void HostAxpy<double2>(const size_t, const double2,
+                                const double2*, const size_t,
+                                double2*, const size_t);
+
+template void HostScal<float>(const size_t, const float,
+                              float*, const size_t);
+template void HostScal<double>(const size_t, const double,
+                               double*, const size_t);
+template void HostScal<float2>(const size_t, const float2,
+                               float2*, const size_t);
+template void HostScal<double2>(const size_t, const double2,
+                                double2*, const size_t);
+
+template void HostCopy<float>(const size_t,
+                              const float*, const size_t,
+                              float*, const size_t);
+template void HostCopy<double>(const size_t,
+                               const double*, const size_t,
+                               double*, const size_t);
+template void HostCopy<float2>(const size_t,
+                               const float2*, const size_t,
+                               float2*, const size_t);
+template void HostCopy<double2>(const size_t,
+                                const double2*, const size_t,
+                                double2*, const size_t);
+
+template void HostSwap<float>(const size_t,
+                              float*, const size_t,
+                              float*, const size_t);
+template void HostSwap<double>(const size_t,
+                               double*, const size_t,
+                               double*, const size_t);
+template void HostSwap<float2>(const size_t,
+                               float2*, const size_t,
+                               float2*, const size_t);
+template void HostSwap<double2>(const size_t,
+                                double2*, const size_t,
+                                double2*, const size_t);
+
+template void HostRot<float>(const size_t,
+                             float*, const size_t,
+                             float*, const size_t,
+                             const float, const float);
+template void HostRot<double>(const size_t,
+                              double*, const size_t,
+                              double*, const size_t,
+                              const double, const double);
+template void HostRotm<float>(const size_t,
+                              float*, const size_t,
+                              float*, const size_t,
+                              const float*);
+template void HostRotm<double>(const size_t,
+                               double*, const size_t,
+                               double*, const size_t,
+                               const double*);
+
+template void HostDot<float>(const size_t, float*,
+                             const float*, const size_t,
+                             const float*, const size_t,
+                             const bool);
+template void HostDot<double>(const size_t, double*,
+                              const double*, const size_t,
+                              const double*, const size_t,
+                              const bool);
+template void HostDot<float2>(const size_t, float2*,
+                              const float2*, const size_t,
+                              const float2*, const size_t,
+                              const bool);
+template void HostDot<double2>(const size_t, double2*,
+                               const double2*, const size_t,
+                               const double2*, const size_t,
+                               const bool);
+
+template void HostDsdot<float>(const size_t, float*,
+                               const float*, const size_t,
+                               const float*, const size_t,
+                               const float);
+template void HostDsdot<double>(const size_t, double*,
+                                const float*, const size_t,
+                                const float*, const size_t,
+                                const float);
+
+template void HostNrm2<float>(const size_t, float*,
+                              const float*, const size_t);
+template void HostNrm2<double>(const size_t, double*,
+                               const double*, const size_t);
+template void HostNrm2<float2>(const size_t, float2*,
+                               const float2*, const size_t);
+template void HostNrm2<double2>(const size_t, double2*,
+                                const double2*, const size_t);
+
+template void HostAsum<float>(const size_t, float*,
+                              const float*, const size_t);
+template void HostAsum<double>(const size_t, double*,
+                               const double*, const size_t);
+template void HostAsum<float2>(const size_t, float2*,
+                               const float2*, const size_t);
+template void HostAsum<double2>(const size_t, double2*,
+                                const double2*, const size_t);
+
+template void HostAmax<float>(const size_t, unsigned int*,
+                              const float*, const size_t, const bool);
+template void HostAmax<double>(const size_t, unsigned int*,
+                               const double*, const size_t, const bool);
+template void HostAmax<float2>(const size_t, unsigned int*,
+                               const float2*, const size_t, const bool);
+template void HostAmax<double2>(const size_t, unsigned int*,
+                                const double2*, const size_t, const bool);
+
+template void HostGemv<float>(const Layout, const Transpose,
+                              const size_t, const size_t, const float,
+                              const float*, const size_t,
+                              const float*, const size_t, const float,
+                              float*, const size_t);
+template void HostGemv<double>(const Layout, const Transpose,
+                               const size_t, const size_t, const double,
+                               const double*, const size_t,
+                               const double*, const size_t, const double,
+                               double*, const size_t);
+template void HostGemv<float2>(const Layout, const Transpose,
+                               const size_t, const size_t, const float2,
+                               const float2*, const size_t,
+                               const float2*, const size_t, const float2,
+                               float2*, const size_t);
+template void HostGemv<double2>(const Layout, const Transpose,
+                                const size_t, const size_t, const double2,
+                                const double2*, const size_t,
+                                const double2*, const size_t, const double2,
+                                double2*, const size_t);
+
+template void HostGer<float>(const Layout,
+                             const size_t, const size_t, const float,
+                             const float*, const size_t,
+                             const float*, const size_t,
+                             float*, const size_t,
+                             const bool);
+template void HostGer<double>(const Layout,
+                              const size_t, const size_t, const double,
+                              const double*, const size_t,
+                              const double*, const size_t,
+                              double*, const size_t,
+                              const bool);
+template void HostGer<float2>(const Layout,
+                              const size_t, const size_t, const float2,
+                              const float2*, const size_t,
+                              const float2*, const size_t,
+                              float2*, const size_t,
+                              const bool);
+template void HostGer<double2>(const Layout,
+                               const size_t, const size_t, const double2,
+                               const double2*, const size_t,
+                               const double2*, const size_t,
+                               double2*, const size_t,
+                               const bool);
+
+template void HostSymv<float>(const Layout, const Triangle,
+                              const size_t, const float,
+                              const float*, const size_t,
+                              const float*, const size_t, const float,
+                              float*, const size_t,
+                              const bool);
+template void HostSymv<double>(const Layout, const Triangle,
+                               const size_t, const double,
+                               const double*, const size_t,
+                               const double*, const size_t, const double,
+                               double*, const size_t,
+                               const bool);
+template void HostSymv<float2>(const Layout, const Triangle,
+                               const size_t, const float2,
+                               const float2*, const size_t,
+                               const float2*, const size_t, const float2,
+                               float2*, const size_t,
+                               const bool);
+template void HostSymv<double2>(const Layout, const Triangle,
+                                const size_t, const double2,
+                                const double2*, const size_t,
+                                const double2*, const size_t, const double2,
+                                double2*, const size_t,
+                                const bool);
+template void HostTrmv<float>(const Layout, const Triangle,
+                              const Transpose, const Diagonal,
+                              const size_t,
+                              const float*, const size_t,
+                              float*, const size_t);
+template void HostTrmv<double>(const Layout, const Triangle,
+                               const Transpose, const Diagonal,
+                               const size_t,
+                               const double*, const size_t,
+                               double*, const size_t);
+template void HostTrmv<float2>(const Layout, const Triangle,
+                               const Transpose, const Diagonal,
+                               const size_t,
+                               const float2*, const size_t,
+                               float2*, const size_t);
+template void HostTrmv<double2>(const Layout, const Triangle,
+                                const Transpose, const Diagonal,
+                                const size_t,
+                                const double2*, const size_t,
+                                double2*, const size_t);
+template void HostTrsv<float>(const Layout, const Triangle,
+                              const Transpose, const Diagonal,
+                              const size_t,
+                              const float*, const size_t,
+                              float*, const size_t);
+template void HostTrsv<double>(const Layout, const Triangle,
+                               const Transpose, const Diagonal,
+                               const size_t,
+                               const double*, const size_t,
+                               double*, const size_t);
+template void HostTrsv<float2>(const Layout, const Triangle,
+                               const Transpose, const Diagonal,
+                               const size_t,
+                               const float2*, const size_t,
+                               float2*, const size_t);
+template void HostTrsv<double2>(const Layout, const Triangle,
+                                const Transpose, const Diagonal,
+                                const size_t,
+                                const double2*, const size_t,
+                                double2*, const size_t);
+template void HostGbmv<float>(const Layout, const Transpose,
+                              const size_t, const size_t, const size_t, const size_t,
+                              const float,
+                              const float*, const size_t,
+                              const float*, const size_t, const float,
+                              float*, const size_t);
+template void HostGbmv<double>(const Layout, const Transpose,
+                               const size_t, const size_t, const size_t, const size_t,
+                               const double,
+                               const double*, const size_t,
+                               const double*, const size_t, const double,
+                               double*, const size_t);
+template void HostGbmv<float2>(const Layout, const Transpose,
+                               const size_t, const size_t, const size_t, const size_t,
+                               const float2,
+                               const float2*, const size_t,
+                               const float2*, const size_t, const float2,
+                               float2*, const size_t);
+template void HostGbmv<double2>(const Layout, const Transpose,
+                                const size_t, const size_t, const size_t, const size_t,
+                                const double2,
+                                const double2*, const size_t,
+                                const double2*, const size_t, const double2,
+                                double2*, const size_t);
+template void HostSbmv<float>(const Layout, const Triangle,
+                              const size_t, const size_t, const float,
+                              const float*, const size_t,
+                              const float*, const size_t, const float,
+                              float*, const size_t,
+                              const bool);
+template void HostSbmv<double>(const Layout, const Triangle,
+                               const size_t, const size_t, const double,
+                               const double*, const size_t,
+                               const double*, const size_t, const double,
+                               double*, const size_t,
+                               const bool);
+template void HostSbmv<float2>(const Layout, const Triangle,
+                               const size_t, const size_t, const float2,
+                               const float2*, const size_t,
+                               const float2*, const size_t, const float2,
+                               float2*, const size_t,
+                               const bool);
+template void HostSbmv<double2>(const Layout, const Triangle,
+                                const size_t, const size_t, const double2,
+                                const double2*, const size_t,
+                                const double2*, const size_t, const double2,
+                                double2*, const size_t,
+                                const bool);
+template void HostTbmv<float>(const Layout, const Triangle,
+                              const Transpose, const Diagonal,
+                              const size_t, const size_t,
+                              const float*, const size_t,
+                              float*, const size_t);
+template void HostTbmv<double>(const Layout, const Triangle,
+                               const Transpose, const Diagonal,
+                               const size_t, const size_t,
+                               const double*, const size_t,
+                               double*, const size_t);
+template void HostTbmv<float2>(const Layout, const Triangle,
+                               const Transpose, const Diagonal,
+                               const size_t, const size_t,
+                               const float2*, const size_t,
+                               float2*, const size_t);
+template void HostTbmv<double2>(const Layout, const Triangle,
+                                const Transpose, const Diagonal,
+                                const size_t, const size_t,
+                                const double2*, const size_t,
+                                double2*, const size_t);
+template void HostTbsv<float>(const Layout, const Triangle,
+                              const Transpose, const Diagonal,
+                              const size_t, const size_t,
+                              const float*, const size_t,
+                              float*, const size_t);
+template void HostTbsv<double>(const Layout, const Triangle,
+                               const Transpose, const Diagonal,
+                               const size_t, const size_t,
+                               const double*, const size_t,
+                               double*, const size_t);
+template void HostTbsv<float2>(const Layout, const Triangle,
+                               const Transpose, const Diagonal,
+                               const size_t, const size_t,
+                               const float2*, const size_t,
+                               float2*, const size_t);
+template void HostTbsv<double2>(const Layout, const Triangle,
+                                const Transpose, const Diagonal,
+                                const size_t, const size_t,
+                                const double2*, const size_t,
+                                double2*, const size_t);
+
+template void HostSpmv<float>(const Layout, const Triangle,
+                              const size_t, const float,
+                              const float*,
+                              const float*, const size_t, const float,
+                              float*, const size_t,
+                              const bool);
+template void HostSpmv<double>(const Layout, const Triangle,
+                               const size_t, const double,
+                               const double*,
+                               const double*, const size_t, const double,
+                               double*, const size_t,
+                               const bool);
+template void HostSpmv<float2>(const Layout, const Triangle,
+                               const size_t, const float2,
+                               const float2*,
+                               const float2*, const size_t, const float2,
+                               float2*, const size_t,
+                               const bool);
+template void HostSpmv<double2>(const Layout, const Triangle,
+                                const size_t, const double2,
+                                const double2*,
+                                const double2*, const size_t, const double2,
+                                double2*, const size_t,
+                                const bool);
+
+template void HostTpmv<float>(const Layout, const Triangle,
+                              const Transpose, const Diagonal,
+                              const size_t,
+                              const float*,
+                              float*, const size_t);
+template void HostTpmv<double>(const Layout, const Triangle,
+                               const Transpose, const Diagonal,
+                               const size_t,
+                               const double*,
+                               double*, const size_t);
+template void HostTpmv<float2>(const Layout, const Triangle,
+                               const Transpose, const Diagonal,
+                               const size_t,
+                               const float2*,
+                               float2*, const size_t);
+template void HostTpmv<double2>(const Layout, const Triangle,
+                                const Transpose, const Diagonal,
+                                const size_t,
+                                const double2*,
+                                double2*, const size_t);
+
+template void HostTpsv<float>(const Layout, const Triangle,
+                              const Transpose, const Diagonal,
+                              const size_t,
+                              const float*,
+                              float*, const size_t);
+template void HostTpsv<double>(const Layout, const Triangle,
+                               const Transpose, const Diagonal,
+                               const size_t,
+                               const double*,
+                               double*, const size_t);
+template void HostTpsv<float2>(const Layout, const Triangle,
+                               const Transpose, const Diagonal,
+                               const size_t,
+                               const float2*,
+                               float2*, const size_t);
+template void HostTpsv<double2>(const Layout, const Triangle,
+                                const Transpose, const Diagonal,
+                                const size_t,
+                                const double2*,
+                                double2*, const size_t);
+
+template void HostSpr<float>(const Layout, const Triangle,
+                             const size_t, const float,
+                             const float*, const size_t,
+                             float*,
+                             const bool);
+template void HostSpr<double>(const Layout, const Triangle,
+                              const size_t, const double,
+                              const double*, const size_t,
+                              double*,
+                              const bool);
+template void HostSpr<float2>(const Layout, const Triangle,
+                              const size_t, const float2,
+                              const float2*, const size_t,
+                              float2*,
+                              const bool);
+template void HostSpr<double2>(const Layout, const Triangle,
+                               const size_t, const double2,
+                               const double2*, const size_t,
+                               double2*,
+                               const bool);
+
+template void HostSyr2<float>(const Layout, const Triangle,
+                              const size_t, const float,
+                              const float*, const size_t,
+                              const float*, const size_t,
+                              float*, const size_t,
+                              const bool, const bool);
+template void HostSyr2<double>(const Layout, const Triangle,
+                               const size_t, const double,
+                               const double*, const size_t,
+                               const double*, const size_t,
+                               double*, const size_t,
+                               const bool, const bool);
+template void HostSyr2<float2>(const Layout, const Triangle,
+                               const size_t, const float2,
+                               const float2*, const size_t,
+                               const float2*, const size_t,
+                               float2*, const size_t,
+                               const bool, const bool);
+template void HostSyr2<double2>(const Layout, const Triangle,
+                                const size_t, const double2,
+                                const double2*, const size_t,
+                                const double2*, const size_t,
+                                double2*, const size_t,
+                                const bool, const bool);
+
+template void HostGemm<float>(const Layout, const Transpose, const Transpose,
+                              const size_t, const size_t, const size_t, const float,
+                              const float*, const size_t,
+                              const float*, const size_t, const float,
+                              float*, const size_t);
+template void HostGemm<double>(const Layout, const Transpose, const Transpose,
+                               const size_t, const size_t, const size_t, const double,
+                               const double*, const size_t,
+                               const double*, const size_t, const double,
+                               double*, const size_t);
+template void HostGemm<float2>(const Layout, const Transpose, const Transpose,
+                               const size_t, const size_t, const size_t, const float2,
+                               const float2*, const size_t,
+                               const float2*, const size_t, const float2,
+                               float2*, const size_t);
+template void HostGemm<double2>(const Layout, const Transpose, const Transpose,
+                                const size_t, const size_t, const size_t, const double2,
+                                const double2*, const size_t,
+                                const double2*, const size_t, const double2,
+                                double2*, const size_t);
+
+template void HostSymm<float>(const Layout, const Side, const Triangle,
+                              const size_t, const size_t, const float,
+                              const float*, const size_t,
+                              const float*, const size_t, const float,
+                              float*, const size_t);
+template void HostSymm<double>(const Layout, const Side, const Triangle,
+                               const size_t, const size_t, const double,
+                               const double*, const size_t,
+                               const double*, const size_t, const double,
+                               double*, const size_t);
+template void HostSymm<float2>(const Layout, const Side, const Triangle,
+                               const size_t, const size_t, const float2,
+                               const float2*, const size_t,
+                               const float2*, const size_t, const float2,
+                               float2*, const size_t);
+template void HostSymm<double2>(const Layout, const Side, const Triangle,
+                                const size_t, const size_t, const double2,
+                                const double2*, const size_t,
+                                const double2*, const size_t, const double2,
+                                double2*, const size_t);
+
+template void HostHemm<float2>(const Layout, const Side, const Triangle,
+                               const size_t, const size_t, const float2,
+                               const float2*, const size_t,
+                               const float2*, const size_t, const float2,
+                               float2*, const size_t);
+template void HostHemm<double2>(const Layout, const Side, const Triangle,
+                                const size_t, const size_t, const double2,
+                                const double2*, const size_t,
+                                const double2*, const size_t, const double2,
+                                double2*, const size_t);
+
+template void HostSyrk<float>(const Layout, const Triangle, const Transpose,
+                              const size_t, const size_t, const float,
+                              const float*, const size_t, const float,
+                              float*, const size_t);
+template void HostSyrk<double>(const Layout, const Triangle, const Transpose,
+                               const size_t, const size_t, const double,
+                               const double*, const size_t, const double,
+                               double*, const size_t);
+template void HostSyrk<float2>(const Layout, const Triangle, const Transpose,
+                               const size_t, const size_t, const float2,
+                               const float2*, const size_t, const float2,
+                               float2*, const size_t);
+template void HostSyrk<double2>(const Layout, const Triangle, const Transpose,
+                                const size_t, const size_t, const double2,
+                                const double2*, const size_t, const double2,
+                                double2*, const size_t);
+
+template void HostHerk<float2,float>(const Layout, const Triangle, const Transpose,
+                                     const size_t, const size_t, const float,
+                                     const float2*, const size_t, const float,
+                                     float2*, const size_t);
+template void HostHerk<double2,double>(const Layout, const Triangle, const Transpose,
+                                       const size_t, const size_t, const double,
+                                       const double2*, const size_t, const double,
+                                       double2*, const size_t);
+
+template void HostSyr2k<float>(const Layout, const Triangle, const Transpose,
+                               const size_t, const size_t, const float,
+                               const float*, const size_t,
+                               const float*, const size_t, const float,
+                               float*, const size_t);
+template void HostSyr2k<double>(const Layout, const Triangle, const Transpose,
+                                const size_t, const size_t, const double,
+                                const double*, const size_t,
+                                const double*, const size_t, const double,
+                                double*, const size_t);
+template void HostSyr2k<float2>(const Layout, const Triangle, const Transpose,
+                                const size_t, const size_t, const float2,
+                                const float2*, const size_t,
+                                const float2*, const size_t, const float2,
+                                float2*, const size_t);
+template void HostSyr2k<double2>(const Layout, const Triangle, const Transpose,
+                                 const size_t, const size_t, const double2,
+                                 const double2*, const size_t,
+                                 const double2*, const size_t, const double2,
+                                 double2*, const size_t);
+
+template void HostHer2k<float2,float>(const Layout, const Triangle, const Transpose,
+                                      const size_t, const size_t, const float2,
+                                      const float2*, const size_t,
+                                      const float2*, const size_t, const float,
+                                      float2*, const size_t);
+template void HostHer2k<double2,double>(const Layout, const Triangle, const Transpose,
+                                        const size_t, const size_t, const double2,
+                                        const double2*, const size_t,
+                                        const double2*, const size_t, const double,
+                                        double2*, const size_t);
+
+template void HostTrmm<float>(const Layout, const Side, const Triangle,
+                              const Transpose, const Diagonal,
+                              const size_t, const size_t, const float,
+                              const float*, const size_t,
+                              float*, const size_t);
+template void HostTrmm<double>(const Layout, const Side, const Triangle,
+                               const Transpose, const Diagonal,
+                               const size_t, const size_t, const double,
+                               const double*, const size_t,
+                               double*, const size_t);
+template void HostTrmm<float2>(const Layout, const Side, const Triangle,
+                               const Transpose, const Diagonal,
+                               const size_t, const size_t, const float2,
+                               const float2*, const size_t,
+                               float2*, const size_t);
+template void HostTrmm<double2>(const Layout, const Side, const Triangle,
+                                const Transpose, const Diagonal,
+                                const size_t, const size_t, const double2,
+                                const double2*, const size_t,
+                                double2*, const size_t);
+
+// =================================================================================================
+} // namespace clblast
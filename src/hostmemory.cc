@@ -0,0 +1,420 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the host-memory support (see the header for information about it).
+//
+// =================================================================================================
+
+#include "internal/hostmemory.h"
+#include "internal/hostblas.h"
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+namespace clblast {
+// =================================================================================================
+
+// Copies a part of a host matrix into a packed buffer. The part consists of 'length' rows/columns
+// starting at 'start' along the split dimension, which is either the first dimension of the matrix
+// ('first' is true) or the second. The other dimension has size 'other'.
+template <typename T>
+void PackPart(const T* host, const size_t ld, const bool first,
+              const size_t start, const size_t length, const size_t other, T* packed) {
+  auto one = (first) ? length : other;
+  auto two = (first) ? other : length;
+  auto offset = (first) ? start : start*ld;
+  for (auto j=size_t{0}; j<two; ++j) {
+    std::copy(host + offset + j*ld, host + offset + j*ld + one, packed + j*one);
+  }
+}
+
+// As above, but copies a packed buffer back into a part of a host matrix
+template <typename T>
+void UnpackPart(const T* packed, const size_t ld, const bool first,
+                const size_t start, const size_t length, const size_t other, T* host) {
+  auto one = (first) ? length : other;
+  auto two = (first) ? other : length;
+  auto offset = (first) ? start : start*ld;
+  for (auto j=size_t{0}; j<two; ++j) {
+    std::copy(packed + j*one, packed + (j+1)*one, host + offset + j*ld);
+  }
+}
+
+// Tests the dimensions and the host matrices for validity. Since there are no OpenCL buffers, only
+// the pointers and the leading dimensions can be checked.
+template <typename T>
+StatusCode TestHostMatrices(const Layout layout,
+                            const Transpose a_transpose, const Transpose b_transpose,
+                            const size_t m, const size_t n, const size_t k,
+                            const T* a, const size_t a_ld,
+                            const T* b, const size_t b_ld,
+                            const T* c, const size_t c_ld) {
+
+  // Makes sure all dimensions are larger than zero and the host pointers are valid
+  if ((m == 0) || (n == 0) || (k == 0)) { return StatusCode::kInvalidDimension; }
+  if (a == nullptr) { return StatusCode::kInvalidMatrixA; }
+  if (b == nullptr) { return StatusCode::kInvalidMatrixB; }
+  if (c == nullptr) { return StatusCode::kInvalidMatrixC; }
+
+  // Computes the first dimensions of the 3 matrices (see the regular Xgemm routine)
+  auto a_rotated = (layout == Layout::kColMajor && a_transpose != Transpose::kNo) ||
+                   (layout == Layout::kRowMajor && a_transpose == Transpose::kNo);
+  auto b_rotated = (layout == Layout::kColMajor && b_transpose != Transpose::kNo) ||
+                   (layout == Layout::kRowMajor && b_transpose == Transpose::kNo);
+  auto c_rotated = (layout == Layout::kRowMajor);
+  auto a_one = (a_rotated) ? k : m;
+  auto b_one = (b_rotated) ? n : k;
+  auto c_one = (c_rotated) ? n : m;
+
+  // Tests the leading dimensions
+  if (a_ld < a_one) { return StatusCode::kInvalidLeadDimA; }
+  if (b_ld < b_one) { return StatusCode::kInvalidLeadDimB; }
+  if (c_ld < c_one) { return StatusCode::kInvalidLeadDimC; }
+  return StatusCode::kSuccess;
+}
+
+// =================================================================================================
+
+// Constructor: creates the regular routine
+template <typename T>
+XgemmHost<T>::XgemmHost(CommandQueue &queue, Event &event):
+    queue_(queue),
+    context_(queue_.GetContext()),
+    device_(queue_.GetDevice()),
+    routine_(queue, event) {
+}
+
+// Compiles the kernels
+template <typename T>
+StatusCode XgemmHost<T>::SetUp() {
+  return routine_.SetUp();
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+StatusCode XgemmHost<T>::DoGemm(const Layout layout,
+                                const Transpose a_transpose, const Transpose b_transpose,
+                                const size_t m, const size_t n, const size_t k,
+                                const T alpha,
+                                const T* a, const size_t a_ld,
+                                const T* b, const size_t b_ld,
+                                const T beta,
+                                T* c, const size_t c_ld) {
+
+  // Tests the dimensions, the host pointers, and the leading dimensions
+  auto status = TestHostMatrices(layout, a_transpose, b_transpose, m, n, k,
+                                 a, a_ld, b, b_ld, c, c_ld);
+  if (status != StatusCode::kSuccess) { return status; }
+
+  // Small problems are computed directly on the host, avoiding any transfers or kernel launches
+  if (m*n*k <= HostBackendThreshold()) {
+    try {
+      HostGemm(layout, a_transpose, b_transpose, m, n, k, alpha, a, a_ld, b, b_ld, beta, c, c_ld);
+    } catch (...) { return StatusCode::kKernelRunError; }
+    return StatusCode::kSuccess;
+  }
+
+  // Devices sharing memory with the host use the host memory directly (zero-copy)
+  if (device_.HostUnifiedMemory() || device_.Type() == CL_DEVICE_TYPE_CPU) {
+    return DoGemmZeroCopy(layout, a_transpose, b_transpose, m, n, k, alpha,
+                          a, a_ld, b, b_ld, beta, c, c_ld);
+  }
+  return DoGemmPipelined(layout, a_transpose, b_transpose, m, n, k, alpha,
+                         a, a_ld, b, b_ld, beta, c, c_ld);
+}
+
+// =================================================================================================
+
+// The version for devices sharing their memory with the host: the host memory is wrapped in OpenCL
+// buffers, such that the regular routine operates on it directly
+template <typename T>
+StatusCode XgemmHost<T>::DoGemmZeroCopy(const Layout layout,
+                                        const Transpose a_transpose, const Transpose b_transpose,
+                                        const size_t m, const size_t n, const size_t k,
+                                        const T alpha,
+                                        const T* a, const size_t a_ld,
+                                        const T* b, const size_t b_ld,
+                                        const T beta,
+                                        T* c, const size_t c_ld) {
+
+  // Computes the sizes of the host memory regions (see the regular Xgemm routine)
+  auto a_rotated = (layout == Layout::kColMajor && a_transpose != Transpose::kNo) ||
+                   (layout == Layout::kRowMajor && a_transpose == Transpose::kNo);
+  auto b_rotated = (layout == Layout::kColMajor && b_transpose != Transpose::kNo) ||
+                   (layout == Layout::kRowMajor && b_transpose == Transpose::kNo);
+  auto c_rotated = (layout == Layout::kRowMajor);
+  auto a_one = (a_rotated) ? k : m;
+  auto a_two = (a_rotated) ? m : k;
+  auto b_one = (b_rotated) ? n : k;
+  auto b_two = (b_rotated) ? k : n;
+  auto c_one = (c_rotated) ? n : m;
+  auto c_two = (c_rotated) ? m : n;
+  auto a_bytes = (a_ld*(a_two-1) + a_one)*sizeof(T);
+  auto b_bytes = (b_ld*(b_two-1) + b_one)*sizeof(T);
+  auto c_bytes = (c_ld*(c_two-1) + c_one)*sizeof(T);
+
+  try {
+    auto a_buffer = Buffer(context_, CL_MEM_READ_ONLY, a_bytes, const_cast<T*>(a));
+    auto b_buffer = Buffer(context_, CL_MEM_READ_ONLY, b_bytes, const_cast<T*>(b));
+    auto c_buffer = Buffer(context_, CL_MEM_READ_WRITE, c_bytes, c);
+    auto status = routine_.DoGemm(layout, a_transpose, b_transpose, m, n, k, alpha,
+                                  a_buffer, 0, a_ld, b_buffer, 0, b_ld, beta, c_buffer, 0, c_ld);
+    if (status != StatusCode::kSuccess) { return status; }
+
+    // Mapping and unmapping matrix C guarantees that the results are visible in host memory
+    auto c_host = c_buffer.MapBuffer(queue_, CL_MAP_READ, c_bytes);
+    auto unmap_status = c_buffer.UnmapBuffer(queue_, c_host);
+    if (unmap_status != CL_SUCCESS) { return StatusCode::kKernelRunError; }
+    queue_.Finish();
+  } catch (...) { return StatusCode::kTempBufferAllocFailure; }
+
+  // Successfully finished the computation
+  return StatusCode::kSuccess;
+}
+
+// =================================================================================================
+
+// The version for discrete devices. The computation is split into chunks along the largest of M and
+// N, i.e. into parts of matrix C and of one of the input matrices (the 'split' matrix). The other
+// input matrix is uploaded once in full. Each chunk is processed in three steps: packing and
+// uploading its inputs, computing, and downloading and unpacking its results. The uploads and
+// downloads are done on a separate transfer queue, such that they can overlap with the computation
+// of the current chunk. This uses 'kNumStages' sets of device buffers and pinned staging buffers.
+template <typename T>
+StatusCode XgemmHost<T>::DoGemmPipelined(const Layout layout,
+                                         const Transpose a_transpose, const Transpose b_transpose,
+                                         const size_t m, const size_t n, const size_t k,
+                                         const T alpha,
+                                         const T* a, const size_t a_ld,
+                                         const T* b, const size_t b_ld,
+                                         const T beta,
+                                         T* c, const size_t c_ld) {
+
+  // Computes whether or not the matrices are transposed in memory (see the regular Xgemm routine)
+  auto a_rotated = (layout == Layout::kColMajor && a_transpose != Transpose::kNo) ||
+                   (layout == Layout::kRowMajor && a_transpose == Transpose::kNo);
+  auto b_rotated = (layout == Layout::kColMajor && b_transpose != Transpose::kNo) ||
+                   (layout == Layout::kRowMajor && b_transpose == Transpose::kNo);
+  auto c_rotated = (layout == Layout::kRowMajor);
+
+  // Determines the chunk sizes
+  auto split_m = (m >= n);
+  auto split_size = (split_m) ? m : n;
+  auto chunk_size = Ceil(CeilDiv(split_size, kMaxNumChunks), kMinChunkSize);
+  auto num_chunks = CeilDiv(split_size, chunk_size);
+
+  // Properties of the split input matrix and of C: whether the split dimension is their first
+  // dimension, and the size of their other dimension
+  auto s_host = (split_m) ? a : b;
+  auto s_ld = (split_m) ? a_ld : b_ld;
+  auto s_first = (split_m) ? !a_rotated : b_rotated;
+  auto s_other = k;
+  auto c_first = (split_m) ? !c_rotated : c_rotated;
+  auto c_other = (split_m) ? n : m;
+
+  // Properties of the full input matrix
+  auto f_host = (split_m) ? b : a;
+  auto f_ld = (split_m) ? b_ld : a_ld;
+  auto f_one = (split_m) ? ((b_rotated) ? n : k) : ((a_rotated) ? k : m);
+  auto f_two = (split_m) ? ((b_rotated) ? k : n) : ((a_rotated) ? m : k);
+  auto f_bytes = (f_ld*(f_two-1) + f_one)*sizeof(T);
+
+  // Helper functions to compute the start and length of a chunk
+  auto chunk_start = [&](const size_t chunk) { return chunk*chunk_size; };
+  auto chunk_length = [&](const size_t chunk) {
+    return (chunk_start(chunk) + chunk_size <= split_size) ? chunk_size
+                                                           : split_size - chunk_start(chunk);
+  };
+
+  try {
+    auto transfer_queue = CommandQueue(context_, device_);
+
+    // Uploads the full input matrix
+    auto f_buffer = Buffer(context_, CL_MEM_READ_ONLY, f_bytes);
+    if (f_buffer.WriteBuffer(transfer_queue, f_bytes, f_host) != CL_SUCCESS) {
+      return StatusCode::kKernelRunError;
+    }
+
+    // Creates the device buffers and the (mapped) pinned staging buffers for each stage
+    auto s_bytes = chunk_size*s_other*sizeof(T);
+    auto c_bytes = chunk_size*c_other*sizeof(T);
+    auto s_buffers = std::vector<Buffer>();
+    auto c_buffers = std::vector<Buffer>();
+    auto pinned_buffers = std::vector<Buffer>();
+    auto s_staging = std::vector<T*>();
+    auto c_in_staging = std::vector<T*>();
+    auto c_out_staging = std::vector<T*>();
+    auto create_staging = [&](const size_t bytes) {
+      pinned_buffers.push_back(Buffer(context_, CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR, bytes));
+      auto map_flags = CL_MAP_READ | CL_MAP_WRITE;
+      return static_cast<T*>(pinned_buffers.back().MapBuffer(transfer_queue, map_flags, bytes));
+    };
+    for (auto stage=size_t{0}; stage<kNumStages; ++stage) {
+      s_buffers.push_back(Buffer(context_, CL_MEM_READ_ONLY, s_bytes));
+      c_buffers.push_back(Buffer(context_, CL_MEM_READ_WRITE, c_bytes));
+      s_staging.push_back(create_staging(s_bytes));
+      c_in_staging.push_back(create_staging(c_bytes));
+      c_out_staging.push_back(create_staging(c_bytes));
+    }
+    auto s_uploads = std::vector<Event>(num_chunks);
+    auto c_uploads = std::vector<Event>(num_chunks);
+    auto downloads = std::vector<Event>(num_chunks);
+
+    // Packs the inputs of a chunk into the staging buffers and starts uploading them
+    auto upload = [&](const size_t chunk) -> cl_int {
+      auto stage = chunk % kNumStages;
+      auto length = chunk_length(chunk);
+      PackPart(s_host, s_ld, s_first, chunk_start(chunk), length, s_other, s_staging[stage]);
+      auto status = s_buffers[stage].WriteBufferAsync(transfer_queue, length*s_other*sizeof(T),
+                                                      s_staging[stage], s_uploads[chunk]);
+      if (status != CL_SUCCESS) { return status; }
+      if (beta != static_cast<T>(0)) {
+        PackPart(static_cast<const T*>(c), c_ld, c_first, chunk_start(chunk), length, c_other,
+                 c_in_staging[stage]);
+        status = c_buffers[stage].WriteBufferAsync(transfer_queue, length*c_other*sizeof(T),
+                                                   c_in_staging[stage], c_uploads[chunk]);
+        if (status != CL_SUCCESS) { return status; }
+      }
+      return transfer_queue.Flush();
+    };
+
+    // Waits for the inputs of a chunk to be uploaded. The events are released once completed.
+    auto wait_upload = [&](const size_t chunk) {
+      auto status = s_uploads[chunk].Wait();
+      clReleaseEvent(s_uploads[chunk]());
+      if (beta != static_cast<T>(0)) {
+        auto c_status = c_uploads[chunk].Wait();
+        clReleaseEvent(c_uploads[chunk]());
+        if (status == CL_SUCCESS) { status = c_status; }
+      }
+      return status;
+    };
+
+    // Waits for the results of a chunk to be downloaded and unpacks them into C
+    auto unpack = [&](const size_t chunk) {
+      auto stage = chunk % kNumStages;
+      auto status = downloads[chunk].Wait();
+      clReleaseEvent(downloads[chunk]());
+      UnpackPart(c_out_staging[stage], c_ld, c_first, chunk_start(chunk), chunk_length(chunk),
+                 c_other, c);
+      return status;
+    };
+
+    // Processes all chunks: the upload of the next chunk and the download of the previous chunk
+    // are overlapped with the computation of the current chunk
+    if (upload(0) != CL_SUCCESS) { return StatusCode::kTempBufferAllocFailure; }
+    for (auto chunk=size_t{0}; chunk<num_chunks; ++chunk) {
+      auto stage = chunk % kNumStages;
+      auto length = chunk_length(chunk);
+      if (wait_upload(chunk) != CL_SUCCESS) { return StatusCode::kTempBufferAllocFailure; }
+      if (chunk + 1 < num_chunks) {
+        if (upload(chunk + 1) != CL_SUCCESS) { return StatusCode::kTempBufferAllocFailure; }
+      }
+
+      // Computes this chunk with the regular routine
+      auto s_ld_packed = (s_first) ? length : s_other;
+      auto c_ld_packed = (c_first) ? length : c_other;
+      auto status = (split_m) ?
+        routine_.DoGemm(layout, a_transpose, b_transpose, length, n, k, alpha,
+                        s_buffers[stage], 0, s_ld_packed, f_buffer, 0, f_ld, beta,
+                        c_buffers[stage], 0, c_ld_packed) :
+        routine_.DoGemm(layout, a_transpose, b_transpose, m, length, k, alpha,
+                        f_buffer, 0, f_ld, s_buffers[stage], 0, s_ld_packed, beta,
+                        c_buffers[stage], 0, c_ld_packed);
+      if (status != StatusCode::kSuccess) { return status; }
+      queue_.Finish();
+
+      // Finishes the previous chunk and starts downloading the results of this chunk
+      if (chunk > 0) {
+        if (unpack(chunk - 1) != CL_SUCCESS) { return StatusCode::kKernelRunError; }
+      }
+      auto read_status = c_buffers[stage].ReadBufferAsync(transfer_queue, length*c_other*sizeof(T),
+                                                          c_out_staging[stage], downloads[chunk]);
+      if (read_status != CL_SUCCESS) { return StatusCode::kKernelRunError; }
+      transfer_queue.Flush();
+    }
+    if (unpack(num_chunks - 1) != CL_SUCCESS) { return StatusCode::kKernelRunError; }
+
+    // Releases the mapped staging buffers
+    auto staging = std::vector<T*>();
+    for (auto stage=size_t{0}; stage<kNumStages; ++stage) {
+      staging.push_back(s_staging[stage]);
+      staging.push_back(c_in_staging[stage]);
+      staging.push_back(c_out_staging[stage]);
+    }
+    auto unmap_status = cl_int{CL_SUCCESS};
+    for (auto i=size_t{0}; i<pinned_buffers.size(); ++i) {
+      auto status = pinned_buffers[i].UnmapBuffer(transfer_queue, staging[i]);
+      if (status != CL_SUCCESS) { unmap_status = status; }
+    }
+    transfer_queue.Finish();
+    if (unmap_status != CL_SUCCESS) { return StatusCode::kKernelRunError; }
+  } catch (...) { return StatusCode::kTempBufferAllocFailure; }
+
+  // Successfully finished the computation
+  return StatusCode::kSuccess;
+}
+
+// =================================================================================================
+
+// Computes GEMM on host memory without any OpenCL device, using only the host backend
+template <typename T>
+StatusCode GemmWithoutDevice(const Layout layout,
+                             const Transpose a_transpose, const Transpose b_transpose,
+                             const size_t m, const size_t n, const size_t k,
+                             const T alpha,
+                             const T* a, const size_t a_ld,
+                             const T* b, const size_t b_ld,
+                             const T beta,
+                             T* c, const size_t c_ld) {
+  auto status = TestHostMatrices(layout, a_transpose, b_transpose, m, n, k,
+                                 a, a_ld, b, b_ld, c, c_ld);
+  if (status != StatusCode::kSuccess) { return status; }
+  try {
+    HostGemm(layout, a_transpose, b_transpose, m, n, k, alpha, a, a_ld, b, b_ld, beta, c, c_ld);
+  } catch (...) { return StatusCode::kKernelRunError; }
+  return StatusCode::kSuccess;
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XgemmHost<float>;
+template class XgemmHost<double>;
+template class XgemmHost<float2>;
+template class XgemmHost<double2>;
+template StatusCode GemmWithoutDevice<float>(const Layout, const Transpose, const Transpose,
+                                             const size_t, const size_t, const size_t, const float,
+                                             const float*, const size_t,
+                                             const float*, const size_t, const float,
+                                             float*, const size_t);
+template StatusCode GemmWithoutDevice<double>(const Layout, const Transpose, const Transpose,
+                                              const size_t, const size_t, const size_t,
+                                              const double,
+                                              const double*, const size_t,
+                                              const double*, const size_t, const double,
+                                              double*, const size_t);
+template StatusCode GemmWithoutDevice<float2>(const Layout, const Transpose, const Transpose,
+                                              const size_t, const size_t, const size_t,
+                                              const float2,
+                                              const float2*, const size_t,
+                                              const float2*, const size_t, const float2,
+                                              float2*, const size_t);
+template StatusCode GemmWithoutDevice<double2>(const Layout, const Transpose, const Transpose,
+                                               const size_t, const size_t, const size_t,
+                                               const double2,
+                                               const double2*, const size_t,
+                                               const double2*, const size_t, const double2,
+                                               double2*, const size_t);
+
+// =================================================================================================
+} // namespace clblast
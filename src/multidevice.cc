@@ -0,0 +1,364 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the multi-device support (see the header for information about it).
+//
+// =================================================================================================
+
+#include "internal/multidevice.h"
+
+#include <string>
+#include <vector>
+#include <map>
+#include <utility>
+#include <mutex>
+#include <thread>
+#include <chrono>
+
+namespace clblast {
+// =================================================================================================
+
+// The measured throughputs (in flops per second) of the devices seen so far, keyed by routine and
+// device. The device is identified by its handle rather than by its name, since identical devices
+// (or the sub-devices of a single device) share a name. These are shared among all threads and
+// routines, and therefore protected by a mutex.
+static std::map<std::pair<std::string,cl_device_id>,double> measured_throughputs;
+static std::mutex measured_throughputs_mutex;
+
+// Partitions the work: the weights are the measured throughputs if these are available for all
+// devices. Otherwise, they are estimated from the amount of compute units and the clock frequency.
+std::vector<size_t> PartitionWork(const size_t size, const std::vector<Device> &devices,
+                                  const size_t granularity, const std::string &routine_name) {
+  auto weights = std::vector<double>();
+  {
+    std::lock_guard<std::mutex> lock(measured_throughputs_mutex);
+    for (auto &device: devices) {
+      auto measurement = measured_throughputs.find({routine_name, device()});
+      if (measurement == measured_throughputs.end()) { weights.clear(); break; }
+      weights.push_back(measurement->second);
+    }
+  }
+  if (weights.size() != devices.size()) {
+    for (auto &device: devices) {
+      weights.push_back(static_cast<double>(device.ComputeUnits()) * device.ClockFrequency());
+    }
+  }
+  auto total_weight = 0.0;
+  for (auto &weight: weights) { total_weight += weight; }
+  if (total_weight <= 0.0) {
+    for (auto &weight: weights) { weight = 1.0; }
+    total_weight = static_cast<double>(weights.size());
+  }
+
+  // Splits the work according to the weights, with the last device taking the remainder
+  auto parts = std::vector<size_t>(devices.size(), 0);
+  auto remaining = size;
+  for (auto i=size_t{0}; i<devices.size(); ++i) {
+    if (i == devices.size() - 1) { parts[i] = remaining; break; }
+    auto share = static_cast<size_t>((size * weights[i]) / total_weight + 0.5);
+    share = ((share + granularity/2) / granularity) * granularity;
+    parts[i] = (share < remaining) ? share : remaining;
+    remaining -= parts[i];
+  }
+  return parts;
+}
+
+// Stores the measured throughput of a device
+void RecordThroughput(const Device &device, const std::string &routine_name,
+                      const double throughput) {
+  std::lock_guard<std::mutex> lock(measured_throughputs_mutex);
+  measured_throughputs[{routine_name, device()}] = throughput;
+}
+
+// Tests whether all queues share a single context
+static bool SharesContext(const std::vector<CommandQueue> &queues) {
+  for (auto &queue: queues) {
+    if (queue.GetContext()() != queues[0].GetContext()()) { return false; }
+  }
+  return true;
+}
+
+// Partitions a device by NUMA node, or else by the next partitionable affinity domain
+std::vector<Device> CreateNumaSubDevices(const Device &device) {
+  try {
+    return device.CreateSubDevices(CL_DEVICE_AFFINITY_DOMAIN_NUMA);
+  } catch (...) {
+    return device.CreateSubDevices(CL_DEVICE_AFFINITY_DOMAIN_NEXT_PARTITIONABLE);
+  }
+}
+
+// =================================================================================================
+
+// Constructor: creates a regular single-device routine per queue
+template <typename T>
+XgemmMultiDevice<T>::XgemmMultiDevice(std::vector<CommandQueue> &queues, Event &event):
+    queues_(queues),
+    event_(event) {
+  routines_.reserve(queues_.size());
+  for (auto &queue: queues_) {
+    devices_.push_back(queue.GetDevice());
+    auto routine_event = Event();
+    routines_.emplace_back(queue, routine_event);
+  }
+}
+
+// Compiles the kernels for all devices. This is done sequentially, because the routines share a
+// common program cache.
+template <typename T>
+StatusCode XgemmMultiDevice<T>::SetUp() {
+  for (auto &routine: routines_) {
+    auto status = routine.SetUp();
+    if (status != StatusCode::kSuccess) { return status; }
+  }
+  return StatusCode::kSuccess;
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+StatusCode XgemmMultiDevice<T>::DoGemm(const Layout layout,
+                                       const Transpose a_transpose, const Transpose b_transpose,
+                                       const size_t m, const size_t n, const size_t k,
+                                       const T alpha,
+                                       const Buffer &a_buffer, const size_t a_offset,
+                                       const size_t a_ld,
+                                       const Buffer &b_buffer, const size_t b_offset,
+                                       const size_t b_ld,
+                                       const T beta,
+                                       const Buffer &c_buffer, const size_t c_offset,
+                                       const size_t c_ld) {
+
+  // Makes sure all dimensions are larger than zero
+  if ((m == 0) || (n == 0) || (k == 0)) { return StatusCode::kInvalidDimension; }
+
+  // The devices have to share a single context, such that they can all access the buffers
+  if (queues_.size() == 0 || !SharesContext(queues_)) { return StatusCode::kNotImplemented; }
+
+  // Computes whether or not the matrices are transposed in memory (see the regular Xgemm routine)
+  auto a_rotated = (layout == Layout::kColMajor && a_transpose != Transpose::kNo) ||
+                   (layout == Layout::kRowMajor && a_transpose == Transpose::kNo);
+  auto b_rotated = (layout == Layout::kColMajor && b_transpose != Transpose::kNo) ||
+                   (layout == Layout::kRowMajor && b_transpose == Transpose::kNo);
+  auto c_rotated = (layout == Layout::kRowMajor);
+
+  // Tests matrix C for validity. Matrices A and B are tested by the per-device routines.
+  auto c_one = (c_rotated) ? n : m;
+  auto c_two = (c_rotated) ? m : n;
+  if (c_ld < c_one) { return StatusCode::kInvalidLeadDimC; }
+  try {
+    auto required_size = (c_ld*(c_two-1) + c_one + c_offset)*sizeof(T);
+    if (c_buffer.GetSize() < required_size) { return StatusCode::kInsufficientMemoryC; }
+  } catch (...) { return StatusCode::kInvalidMatrixC; }
+
+  // Splits C along its second dimension, such that each part is contiguous in memory: these are
+  // rows of C for a row-major layout and columns of C for a column-major layout.
+  auto parts = PartitionWork(c_two, devices_, kGranularity, "GEMM");
+  auto starts = std::vector<size_t>(parts.size(), 0);
+  for (auto i=size_t{1}; i<parts.size(); ++i) { starts[i] = starts[i-1] + parts[i-1]; }
+
+  // Runs each part of the work in a separate host thread, since the routines are blocking
+  auto c_parts = std::vector<Buffer>();
+  auto statuses = std::vector<StatusCode>(parts.size(), StatusCode::kSuccess);
+  try {
+    for (auto i=size_t{0}; i<parts.size(); ++i) {
+      auto c_part_size = (parts[i] == 0) ? size_t{1} : c_one*parts[i];
+      c_parts.push_back(Buffer(queues_[i].GetContext(), CL_MEM_READ_WRITE, c_part_size*sizeof(T)));
+    }
+  } catch (...) { return StatusCode::kTempBufferAllocFailure; }
+  auto threads = std::vector<std::thread>();
+  for (auto i=size_t{0}; i<parts.size(); ++i) {
+    if (parts[i] == 0) { continue; }
+    threads.push_back(std::thread([&, i]() {
+      auto start_time = std::chrono::steady_clock::now();
+
+      // Offsets into the input matrices corresponding to this part of C
+      auto m_part = (c_rotated) ? parts[i] : m;
+      auto n_part = (c_rotated) ? n : parts[i];
+      auto a_offset_part = (c_rotated) ? a_offset + starts[i]*((a_rotated) ? a_ld : 1) : a_offset;
+      auto b_offset_part = (c_rotated) ? b_offset : b_offset + starts[i]*((b_rotated) ? 1 : b_ld);
+      auto c_offset_part = c_offset + starts[i]*c_ld;
+
+      // Copies in the original contents of C (only needed when it is used as input)
+      if (beta != static_cast<T>(0)) {
+        auto status = c_buffer.CopyToRect<T>(queues_[i], c_one, parts[i], c_offset_part, c_ld,
+                                             c_parts[i], 0, c_one);
+        if (status != CL_SUCCESS || queues_[i].Finish() != CL_SUCCESS) {
+          statuses[i] = StatusCode::kTempBufferAllocFailure;
+          return;
+        }
+      }
+
+      // Runs the regular routine on this device
+      statuses[i] = routines_[i].DoGemm(layout, a_transpose, b_transpose, m_part, n_part, k, alpha,
+                                        a_buffer, a_offset_part, a_ld,
+                                        b_buffer, b_offset_part, b_ld, beta,
+                                        c_parts[i], 0, c_one);
+      queues_[i].Finish();
+
+      // Records the achieved throughput for later partitionings
+      auto elapsed = std::chrono::steady_clock::now() - start_time;
+      auto seconds = std::chrono::duration<double>(elapsed).count();
+      if (statuses[i] == StatusCode::kSuccess && seconds > 0.0) {
+        RecordThroughput(devices_[i], "GEMM", (2.0*m_part*n_part*k)/seconds);
+      }
+    }));
+  }
+  for (auto &thread: threads) { thread.join(); }
+  for (auto &status: statuses) {
+    if (status != StatusCode::kSuccess) { return status; }
+  }
+
+  // Copies the results back into C. This is done one device at a time, to avoid concurrent writes.
+  for (auto i=size_t{0}; i<parts.size(); ++i) {
+    if (parts[i] == 0) { continue; }
+    auto status = c_parts[i].CopyToRect<T>(queues_[i], c_one, parts[i], 0, c_one,
+                                           c_buffer, c_offset + starts[i]*c_ld, c_ld);
+    if (status != CL_SUCCESS) { return StatusCode::kKernelRunError; }
+    if (queues_[i].Finish() != CL_SUCCESS) { return StatusCode::kKernelRunError; }
+  }
+
+  // Provides a single event, which signals completion of the work on all devices
+  if (queues_[0].EnqueueMarker(event_) != CL_SUCCESS) { return StatusCode::kKernelLaunchError; }
+  if (event_.Wait() != CL_SUCCESS) { return StatusCode::kKernelRunError; }
+
+  // Successfully finished the computation
+  return StatusCode::kSuccess;
+}
+
+// =================================================================================================
+
+// Constructor: creates a regular single-device routine per queue
+template <typename T>
+XaxpyMultiDevice<T>::XaxpyMultiDevice(std::vector<CommandQueue> &queues, Event &event):
+    queues_(queues),
+    event_(event) {
+  routines_.reserve(queues_.size());
+  for (auto &queue: queues_) {
+    devices_.push_back(queue.GetDevice());
+    auto routine_event = Event();
+    routines_.emplace_back(queue, routine_event);
+  }
+}
+
+// Compiles the kernels for all devices (sequentially, see XgemmMultiDevice::SetUp)
+template <typename T>
+StatusCode XaxpyMultiDevice<T>::SetUp() {
+  for (auto &routine: routines_) {
+    auto status = routine.SetUp();
+    if (status != StatusCode::kSuccess) { return status; }
+  }
+  return StatusCode::kSuccess;
+}
+
+// The main routine
+template <typename T>
+StatusCode XaxpyMultiDevice<T>::DoAxpy(const size_t n, const T alpha,
+                                       const Buffer &x_buffer, const size_t x_offset,
+                                       const size_t x_inc,
+                                       const Buffer &y_buffer, const size_t y_offset,
+                                       const size_t y_inc) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { return StatusCode::kInvalidDimension; }
+
+  // The devices have to share a single context, such that they can all access the buffers
+  if (queues_.size() == 0 || !SharesContext(queues_)) { return StatusCode::kNotImplemented; }
+
+  // A strided vector Y cannot be split into non-overlapping sub-buffers: uses the first device only
+  if (y_inc != 1 || queues_.size() == 1) {
+    auto status = routines_[0].DoAxpy(n, alpha, x_buffer, x_offset, x_inc,
+                                      y_buffer, y_offset, y_inc);
+    if (status != StatusCode::kSuccess) { return status; }
+  }
+  else {
+
+    // Tests vector Y for validity. Vector X is tested by the per-device routines.
+    try {
+      if (y_buffer.GetSize() < (y_offset + n)*sizeof(T)) {
+        return StatusCode::kInsufficientMemoryY;
+      }
+    } catch (...) { return StatusCode::kInvalidVectorY; }
+
+    // Computes the boundaries between the parts, aligned in memory as required for sub-buffers
+    auto align = size_t{1};
+    for (auto &device: devices_) {
+      auto device_align = (device.MemBaseAddrAlign()/8) / sizeof(T);
+      if (device_align > align) { align = device_align; }
+    }
+    auto parts = PartitionWork(n, devices_, kGranularity, "AXPY");
+    auto starts = std::vector<size_t>(parts.size() + 1, 0);
+    auto boundary = size_t{0};
+    for (auto i=size_t{1}; i<parts.size(); ++i) {
+      boundary += parts[i-1];
+      auto aligned = Ceil(y_offset + boundary, align) - y_offset;
+      starts[i] = (aligned < n) ? aligned : n;
+    }
+    starts[parts.size()] = n;
+
+    // Creates a non-overlapping sub-buffer of Y per device
+    auto y_parts = std::vector<Buffer>();
+    auto y_part_offsets = std::vector<size_t>();
+    try {
+      for (auto i=size_t{0}; i<parts.size(); ++i) {
+        auto origin = ((y_offset + starts[i]) / align) * align;
+        auto size = (starts[i+1] > starts[i]) ? y_offset + starts[i+1] - origin : size_t{1};
+        y_parts.push_back(Buffer(y_buffer, CL_MEM_READ_WRITE, origin*sizeof(T), size*sizeof(T)));
+        y_part_offsets.push_back(y_offset + starts[i] - origin);
+      }
+    } catch (...) { return StatusCode::kInvalidVectorY; }
+
+    // Runs each part of the work in a separate host thread, since the routines are blocking
+    auto statuses = std::vector<StatusCode>(parts.size(), StatusCode::kSuccess);
+    auto threads = std::vector<std::thread>();
+    for (auto i=size_t{0}; i<parts.size(); ++i) {
+      auto n_part = starts[i+1] - starts[i];
+      if (n_part == 0) { continue; }
+      threads.push_back(std::thread([&, i, n_part]() {
+        auto start_time = std::chrono::steady_clock::now();
+        statuses[i] = routines_[i].DoAxpy(n_part, alpha,
+                                          x_buffer, x_offset + starts[i]*x_inc, x_inc,
+                                          y_parts[i], y_part_offsets[i], 1);
+
+        // Records the achieved throughput for later partitionings
+        auto elapsed = std::chrono::steady_clock::now() - start_time;
+        auto seconds = std::chrono::duration<double>(elapsed).count();
+        if (statuses[i] == StatusCode::kSuccess && seconds > 0.0) {
+          RecordThroughput(devices_[i], "AXPY", (2.0*n_part)/seconds);
+        }
+      }));
+    }
+    for (auto &thread: threads) { thread.join(); }
+    for (auto &status: statuses) {
+      if (status != StatusCode::kSuccess) { return status; }
+    }
+  }
+
+  // Provides a single event, which signals completion of the work on all devices
+  if (queues_[0].EnqueueMarker(event_) != CL_SUCCESS) { return StatusCode::kKernelLaunchError; }
+  if (event_.Wait() != CL_SUCCESS) { return StatusCode::kKernelRunError; }
+
+  // Successfully finished the computation
+  return StatusCode::kSuccess;
+}
+
+// =================================================================================================
+
+// Compiles the templated classes
+template class XaxpyMultiDevice<float>;
+template class XaxpyMultiDevice<double>;
+template class XaxpyMultiDevice<float2>;
+template class XaxpyMultiDevice<double2>;
+template class XgemmMultiDevice<float>;
+template class XgemmMultiDevice<double>;
+template class XgemmMultiDevice<float2>;
+template class XgemmMultiDevice<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -14,6 +14,9 @@
 #include "internal/routine.h"
 
 #include "internal/utilities.h"
+#include "internal/hostblas.h"
+
+#include <algorithm>
 
 namespace clblast {
 // =================================================================================================
@@ -30,7 +33,6 @@ Routine::Routine(CommandQueue &queue, Event &event, const std::string &name,
     event_(event),
     context_(queue_.GetContext()),
     device_(queue_.GetDevice()),
-    device_name_(device_.Name()),
     max_work_item_dimensions_(device_.MaxWorkItemDimensions()),
     max_work_item_sizes_(device_.MaxWorkItemSizes()),
     max_work_group_size_(device_.MaxWorkGroupSize()),
@@ -97,7 +99,7 @@ StatusCode Routine::SetUp() {
       if (status == CL_INVALID_BINARY) { return StatusCode::kInvalidBinary; }
 
       // Store the compiled program in the cache
-      program_cache_.push_back({program, device_name_, precision_, routine_name_});
+      program_cache_.push_back({program, context_(), device_(), precision_, routine_name_});
     } catch (...) { return StatusCode::kBuildProgramFailure; }
   }
 
@@ -107,9 +109,10 @@ StatusCode Routine::SetUp() {
 
 // =================================================================================================
 
-// Enqueues a kernel, waits for completion, and checks for errors
+// Enqueues a kernel, optionally waits for completion, and checks for errors
 StatusCode Routine::RunKernel(const Kernel &kernel, std::vector<size_t> &global,
-                              const std::vector<size_t> &local) {
+                              const std::vector<size_t> &local, const bool wait,
+                              const std::vector<Event> &wait_for_events) {
 
   // Tests for validity of the local thread sizes
   if (local.size() > max_work_item_dimensions_) {
@@ -132,10 +135,11 @@ StatusCode Routine::RunKernel(const Kernel &kernel, std::vector<size_t> &global,
   if (!device_.IsLocalMemoryValid(local_mem_usage)) { return StatusCode::kInvalidLocalMemUsage; }
 
   // Launches the kernel (and checks for launch errors)
-  auto status = queue_.EnqueueKernel(kernel, global, local, event_);
+  auto status = queue_.EnqueueKernel(kernel, global, local, event_, wait_for_events);
   if (status != CL_SUCCESS) { return StatusCode::kKernelLaunchError; }
 
   // Waits for completion of the kernel
+  if (!wait) { return StatusCode::kSuccess; }
   status = event_.Wait();
   if (status != CL_SUCCESS) { return StatusCode::kKernelRunError; }
 
@@ -143,15 +147,36 @@ StatusCode Routine::RunKernel(const Kernel &kernel, std::vector<size_t> &global,
   return StatusCode::kSuccess;
 }
 
+// Computes the amount of tiles of C containing elements of the triangle, using the same enumeration
+// as the kernel: per column of tiles, a range of rows of tiles. Then runs the kernel as a 3D range
+// with one work-group per tile in the third dimension.
+StatusCode Routine::RunTriangularKernel(const Kernel &kernel, const size_t n_ceiled,
+                                        const Triangle triangle) {
+  auto num_tiles_m = n_ceiled / db_["MWG"];
+  auto num_tiles = size_t{0};
+  for (auto tile_n = size_t{0}; tile_n < n_ceiled / db_["NWG"]; ++tile_n) {
+    if (triangle == Triangle::kUpper) {
+      num_tiles += std::min(((tile_n + 1)*db_["NWG"] - 1) / db_["MWG"] + 1, num_tiles_m);
+    }
+    else {
+      num_tiles += num_tiles_m - (tile_n*db_["NWG"]) / db_["MWG"];
+    }
+  }
+  auto global = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"], num_tiles};
+  auto local = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"], 1};
+  return RunKernel(kernel, global, local);
+}
+
 // =================================================================================================
 
 // Tests matrix A for validity: checks for a valid OpenCL buffer, a valid lead-dimension, and for a
-// sufficient buffer size.
+// sufficient buffer size. The last column (or row) only needs to hold 'one' elements instead of a
+// full lead-dimension, such that sub-matrices at the end of a buffer are also valid.
 StatusCode Routine::TestMatrixA(const size_t one, const size_t two, const Buffer &buffer,
                                 const size_t offset, const size_t ld, const size_t data_size) {
   if (ld < one) { return StatusCode::kInvalidLeadDimA; }
   try {
-    auto required_size = (ld*two + offset)*data_size;
+    auto required_size = (ld*(two - 1) + one + offset)*data_size;
     auto buffer_size = buffer.GetSize();
     if (buffer_size < required_size) { return StatusCode::kInsufficientMemoryA; }
   } catch (...) { return StatusCode::kInvalidMatrixA; }
@@ -164,7 +189,7 @@ StatusCode Routine::TestMatrixB(const size_t one, const size_t two, const Buffer
                                 const size_t offset, const size_t ld, const size_t data_size) {
   if (ld < one) { return StatusCode::kInvalidLeadDimB; }
   try {
-    auto required_size = (ld*two + offset)*data_size;
+    auto required_size = (ld*(two - 1) + one + offset)*data_size;
     auto buffer_size = buffer.GetSize();
     if (buffer_size < required_size) { return StatusCode::kInsufficientMemoryB; }
   } catch (...) { return StatusCode::kInvalidMatrixB; }
@@ -177,13 +202,25 @@ StatusCode Routine::TestMatrixC(const size_t one, const size_t two, const Buffer
                                 const size_t offset, const size_t ld, const size_t data_size) {
   if (ld < one) { return StatusCode::kInvalidLeadDimC; }
   try {
-    auto required_size = (ld*two + offset)*data_size;
+    auto required_size = (ld*(two - 1) + one + offset)*data_size;
     auto buffer_size = buffer.GetSize();
     if (buffer_size < required_size) { return StatusCode::kInsufficientMemoryC; }
   } catch (...) { return StatusCode::kInvalidMatrixC; }
   return StatusCode::kSuccess;
 }
 
+// Tests the packed matrix AP for validity: checks for a valid OpenCL buffer and for a sufficient
+// buffer size to hold the n*(n+1)/2 elements of the triangle.
+StatusCode Routine::TestMatrixAP(const size_t n, const Buffer &buffer, const size_t offset,
+                                 const size_t data_size) {
+  try {
+    auto required_size = ((n*(n + 1))/2 + offset)*data_size;
+    auto buffer_size = buffer.GetSize();
+    if (buffer_size < required_size) { return StatusCode::kInsufficientMemoryA; }
+  } catch (...) { return StatusCode::kInvalidMatrixA; }
+  return StatusCode::kSuccess;
+}
+
 // =================================================================================================
 
 // Tests vector X for validity: checks for a valid increment, a valid OpenCL buffer, and for a
@@ -212,6 +249,28 @@ StatusCode Routine::TestVectorY(const size_t n, const Buffer &buffer, const size
   return StatusCode::kSuccess;
 }
 
+// Tests the output of a reduction for validity: checks for a valid OpenCL buffer and for a
+// sufficient buffer size to hold 'n' values starting at 'offset'.
+StatusCode Routine::TestVectorScalar(const size_t n, const Buffer &buffer, const size_t offset,
+                                     const size_t data_size) {
+  try {
+    auto required_size = (n + offset)*data_size;
+    auto buffer_size = buffer.GetSize();
+    if (buffer_size < required_size) { return StatusCode::kInsufficientMemoryScalar; }
+  } catch (...) { return StatusCode::kInvalidVectorScalar; }
+  return StatusCode::kSuccess;
+}
+
+// =================================================================================================
+
+// Decides whether or not to compute a problem with the host backend instead of on the device. This
+// is only done for small problems on devices which share their memory with the host, since mapping
+// their buffers into host memory is then free.
+bool Routine::UseHostBackend(const size_t work) const {
+  if (work > HostBackendThreshold()) { return false; }
+  return device_.HostUnifiedMemory() || device_.Type() == CL_DEVICE_TYPE_CPU;
+}
+
 // =================================================================================================
 
 // Copies or transposes a matrix and pads/unpads it with zeros
@@ -330,7 +389,7 @@ StatusCode Routine::PadCopyTransposeMatrix(const size_t src_one, const size_t sr
 // otherwise.
 const Program& Routine::GetProgramFromCache() const {
   for (auto &cached_program: program_cache_) {
-    if (cached_program.MatchInCache(device_name_, precision_, routine_name_)) {
+    if (cached_program.MatchInCache(context_(), device_(), precision_, routine_name_)) {
       return cached_program.program;
     }
   }
@@ -340,7 +399,9 @@ const Program& Routine::GetProgramFromCache() const {
 // Queries the cache to see whether or not the compiled kernel is already there
 bool Routine::ProgramIsInCache() const {
   for (auto &cached_program: program_cache_) {
-    if (cached_program.MatchInCache(device_name_, precision_, routine_name_)) { return true; }
+    if (cached_program.MatchInCache(context_(), device_(), precision_, routine_name_)) {
+      return true;
+    }
   }
   return false;
 }
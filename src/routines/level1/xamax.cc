@@ -0,0 +1,126 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xamax class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "internal/routines/level1/xamax.h"
+#include "internal/hostblas.h"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Specific implementations to get the memory-type based on a template argument
+template <> const Precision Xamax<float>::precision_ = Precision::kSingle;
+template <> const Precision Xamax<double>::precision_ = Precision::kDouble;
+template <> const Precision Xamax<float2>::precision_ = Precision::kComplexSingle;
+template <> const Precision Xamax<double2>::precision_ = Precision::kComplexDouble;
+
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xamax<T>::Xamax(CommandQueue &queue, Event &event):
+    Routine(queue, event, "AMAX", {"Xamax"}, precision_) {
+  source_string_ =
+    #include "../../kernels/xamax.opencl"
+  ;
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+StatusCode Xamax<T>::DoAmax(const size_t n,
+                            const Buffer &imax_buffer, const size_t imax_offset,
+                            const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                            const bool do_min) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { return StatusCode::kInvalidDimension; }
+
+  // Tests the vectors for validity
+  auto status = TestVectorX(n, x_buffer, x_offset, x_inc, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorScalar(1, imax_buffer, imax_offset, sizeof(unsigned int));
+  if (ErrorIn(status)) { return status; }
+
+  // Small problems on devices sharing their memory with the host are computed by the host backend
+  if (UseHostBackend(n)) {
+    try {
+      HostMapping host(queue_, {imax_buffer, x_buffer});
+      HostAmax(n, host.Get<unsigned int>(0, imax_offset), host.Get<T>(1, x_offset), x_inc, do_min);
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kKernelRunError; }
+  }
+
+  // The number of work-groups of the first kernel, each producing one partial result
+  auto num_groups = 2*db_["WGS2"];
+
+  // Temporary buffers for the partial results, consisting of the values and of their indices: if
+  // memory allocation fails, throw an exception
+  try {
+    auto temp_max = Buffer(context_, CL_MEM_READ_WRITE, num_groups*sizeof(T));
+    auto temp_imax = Buffer(context_, CL_MEM_READ_WRITE, num_groups*sizeof(unsigned int));
+
+    // Retrieves the Xamax kernels from the compiled binary
+    try {
+      auto& program = GetProgramFromCache();
+      auto kernel1 = Kernel(program, "Xamax");
+      auto kernel2 = Kernel(program, "XamaxEpilogue");
+
+      // Sets the kernel arguments
+      kernel1.SetArgument(0, static_cast<int>(n));
+      kernel1.SetArgument(1, x_buffer());
+      kernel1.SetArgument(2, static_cast<int>(x_offset));
+      kernel1.SetArgument(3, static_cast<int>(x_inc));
+      kernel1.SetArgument(4, temp_max());
+      kernel1.SetArgument(5, temp_imax());
+      kernel1.SetArgument(6, static_cast<int>(do_min));
+      kernel2.SetArgument(0, static_cast<int>(n));
+      kernel2.SetArgument(1, temp_max());
+      kernel2.SetArgument(2, temp_imax());
+      kernel2.SetArgument(3, imax_buffer());
+      kernel2.SetArgument(4, static_cast<int>(imax_offset));
+      kernel2.SetArgument(5, static_cast<int>(do_min));
+
+      // Launches the main kernel, computing the partial results
+      auto global1 = std::vector<size_t>{db_["WGS1"]*num_groups};
+      auto local1 = std::vector<size_t>{db_["WGS1"]};
+      status = RunKernel(kernel1, global1, local1, false);
+      if (ErrorIn(status)) { return status; }
+      auto main_event = std::vector<Event>{event_};
+
+      // Launches the epilogue kernel, reducing the partial results into the final result. It waits
+      // for the event of the main kernel instead of the main kernel being waited for. The event of
+      // the routine is that of the epilogue, which thus signals the completion of the computation.
+      auto global2 = std::vector<size_t>{db_["WGS2"]};
+      auto local2 = std::vector<size_t>{db_["WGS2"]};
+      status = RunKernel(kernel2, global2, local2, false, main_event);
+      if (ErrorIn(status)) { return status; }
+
+      // Succesfully finished the computation
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kInvalidKernel; }
+  } catch (...) { return StatusCode::kTempBufferAllocFailure; }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xamax<float>;
+template class Xamax<double>;
+template class Xamax<float2>;
+template class Xamax<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,48 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xamin class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "internal/routines/level1/xamin.h"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xamin<T>::Xamin(CommandQueue &queue, Event &event):
+    Xamax<T>(queue, event) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+StatusCode Xamin<T>::DoAmin(const size_t n,
+                            const Buffer &imin_buffer, const size_t imin_offset,
+                            const Buffer &x_buffer, const size_t x_offset, const size_t x_inc) {
+  return DoAmax(n, imin_buffer, imin_offset,
+                x_buffer, x_offset, x_inc,
+                true);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xamin<float>;
+template class Xamin<double>;
+template class Xamin<float2>;
+template class Xamin<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,118 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xasum class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "internal/routines/level1/xasum.h"
+#include "internal/hostblas.h"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Specific implementations to get the memory-type based on a template argument
+template <> const Precision Xasum<float>::precision_ = Precision::kSingle;
+template <> const Precision Xasum<double>::precision_ = Precision::kDouble;
+template <> const Precision Xasum<float2>::precision_ = Precision::kComplexSingle;
+template <> const Precision Xasum<double2>::precision_ = Precision::kComplexDouble;
+
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xasum<T>::Xasum(CommandQueue &queue, Event &event):
+    Routine(queue, event, "ASUM", {"Xdot"}, precision_) {
+  source_string_ =
+    #include "../../kernels/xasum.opencl"
+  ;
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+StatusCode Xasum<T>::DoAsum(const size_t n,
+                            const Buffer &asum_buffer, const size_t asum_offset,
+                            const Buffer &x_buffer, const size_t x_offset, const size_t x_inc) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { return StatusCode::kInvalidDimension; }
+
+  // Tests the vectors for validity
+  auto status = TestVectorX(n, x_buffer, x_offset, x_inc, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorScalar(1, asum_buffer, asum_offset, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+
+  // Small problems on devices sharing their memory with the host are computed by the host backend
+  if (UseHostBackend(n)) {
+    try {
+      HostMapping host(queue_, {asum_buffer, x_buffer});
+      HostAsum(n, host.Get<T>(0, asum_offset), host.Get<T>(1, x_offset), x_inc);
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kKernelRunError; }
+  }
+
+  // The number of work-groups of the first kernel, each producing one partial result
+  auto num_groups = 2*db_["WGS2"];
+
+  // Temporary buffer for the partial results: if memory allocation fails, throw an exception
+  try {
+    auto temp_buffer = Buffer(context_, CL_MEM_READ_WRITE, num_groups*sizeof(T));
+
+    // Retrieves the Xasum kernels from the compiled binary
+    try {
+      auto& program = GetProgramFromCache();
+      auto kernel1 = Kernel(program, "Xasum");
+      auto kernel2 = Kernel(program, "XasumEpilogue");
+
+      // Sets the kernel arguments
+      kernel1.SetArgument(0, static_cast<int>(n));
+      kernel1.SetArgument(1, x_buffer());
+      kernel1.SetArgument(2, static_cast<int>(x_offset));
+      kernel1.SetArgument(3, static_cast<int>(x_inc));
+      kernel1.SetArgument(4, temp_buffer());
+      kernel2.SetArgument(0, temp_buffer());
+      kernel2.SetArgument(1, asum_buffer());
+      kernel2.SetArgument(2, static_cast<int>(asum_offset));
+
+      // Launches the main kernel, computing the partial results
+      auto global1 = std::vector<size_t>{db_["WGS1"]*num_groups};
+      auto local1 = std::vector<size_t>{db_["WGS1"]};
+      status = RunKernel(kernel1, global1, local1, false);
+      if (ErrorIn(status)) { return status; }
+      auto main_event = std::vector<Event>{event_};
+
+      // Launches the epilogue kernel, reducing the partial results into the final result. It waits
+      // for the event of the main kernel instead of the main kernel being waited for. The event of
+      // the routine is that of the epilogue, which thus signals the completion of the computation.
+      auto global2 = std::vector<size_t>{db_["WGS2"]};
+      auto local2 = std::vector<size_t>{db_["WGS2"]};
+      status = RunKernel(kernel2, global2, local2, false, main_event);
+      if (ErrorIn(status)) { return status; }
+
+      // Succesfully finished the computation
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kInvalidKernel; }
+  } catch (...) { return StatusCode::kTempBufferAllocFailure; }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xasum<float>;
+template class Xasum<double>;
+template class Xasum<float2>;
+template class Xasum<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -12,6 +12,7 @@
 // =================================================================================================
 
 #include "internal/routines/level1/xaxpy.h"
+#include "internal/hostblas.h"
 
 #include <string>
 #include <vector>
@@ -24,6 +25,7 @@ template <> const Precision Xaxpy<float>::precision_ = Precision::kSingle;
 template <> const Precision Xaxpy<double>::precision_ = Precision::kDouble;
 template <> const Precision Xaxpy<float2>::precision_ = Precision::kComplexSingle;
 template <> const Precision Xaxpy<double2>::precision_ = Precision::kComplexDouble;
+template <> const Precision Xaxpy<half>::precision_ = Precision::kHalf;
 
 // =================================================================================================
 
@@ -32,6 +34,7 @@ template <typename T>
 Xaxpy<T>::Xaxpy(CommandQueue &queue, Event &event):
     Routine(queue, event, "AXPY", {"Xaxpy"}, precision_) {
   source_string_ =
+    #include "../../kernels/level1.opencl"
     #include "../../kernels/xaxpy.opencl"
   ;
 }
@@ -53,6 +56,15 @@ StatusCode Xaxpy<T>::DoAxpy(const size_t n, const T alpha,
   status = TestVectorY(n, y_buffer, y_offset, y_inc, sizeof(T));
   if (ErrorIn(status)) { return status; }
 
+  // Small problems on devices sharing their memory with the host are computed by the host backend
+  if (UseHostBackend(n)) {
+    try {
+      HostMapping host(queue_, {x_buffer, y_buffer});
+      HostAxpy(n, alpha, host.Get<T>(0, x_offset), x_inc, host.Get<T>(1, y_offset), y_inc);
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kKernelRunError; }
+  }
+
   // Determines whether or not the fast-version can be used
   bool use_fast_kernel = (x_offset == 0) && (x_inc == 1) &&
                          (y_offset == 0) && (y_inc == 1) &&
@@ -113,6 +125,7 @@ template class Xaxpy<float>;
 template class Xaxpy<double>;
 template class Xaxpy<float2>;
 template class Xaxpy<double2>;
+template class Xaxpy<half>;
 
 // =================================================================================================
 } // namespace clblast
@@ -0,0 +1,131 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xdsdot class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "internal/routines/level1/xdsdot.h"
+#include "internal/hostblas.h"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Specific implementations to get the memory-type and the name based on a template argument. The
+// inputs are always in single precision, the template argument only determines the result.
+template <> const Precision Xdsdot<float>::precision_ = Precision::kSingle;
+template <> const Precision Xdsdot<double>::precision_ = Precision::kSingle;
+template <> const std::string Xdsdot<float>::name_ = "SDSDOT";
+template <> const std::string Xdsdot<double>::name_ = "DSDOT";
+
+// =================================================================================================
+
+// Constructor: forwards to base class constructor. The kernels are compiled with a double-precision
+// accumulator only if the device supports it.
+template <typename T>
+Xdsdot<T>::Xdsdot(CommandQueue &queue, Event &event):
+    Routine(queue, event, name_, {"Xdot"}, precision_),
+    use_double_(device_.Extensions().find(kKhronosDoublePrecision) != std::string::npos) {
+  source_string_ =
+    "#define USE_DOUBLE_ACCUMULATION " + ToString(static_cast<int>(use_double_)) + "\n" +
+    #include "../../kernels/xdsdot.opencl"
+  ;
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+StatusCode Xdsdot<T>::DoDsdot(const size_t n,
+                              const Buffer &dot_buffer, const size_t dot_offset,
+                              const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                              const Buffer &y_buffer, const size_t y_offset, const size_t y_inc,
+                              const float sb) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { return StatusCode::kInvalidDimension; }
+
+  // Tests the vectors for validity
+  auto status = TestVectorX(n, x_buffer, x_offset, x_inc, sizeof(float));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorY(n, y_buffer, y_offset, y_inc, sizeof(float));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorScalar(1, dot_buffer, dot_offset, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+
+  // Small problems on devices sharing their memory with the host are computed by the host backend
+  if (UseHostBackend(n)) {
+    try {
+      HostMapping host(queue_, {dot_buffer, x_buffer, y_buffer});
+      HostDsdot(n, host.Get<T>(0, dot_offset),
+                host.Get<float>(1, x_offset), x_inc, host.Get<float>(2, y_offset), y_inc, sb);
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kKernelRunError; }
+  }
+
+  // The number of work-groups of the first kernel, each producing one partial result. These are
+  // stored as accumulators: either a double or a pair of floats.
+  auto num_groups = 2*db_["WGS2"];
+  auto accumulator_size = 2*sizeof(float);
+
+  // Temporary buffer for the partial results: if memory allocation fails, throw an exception
+  try {
+    auto temp_buffer = Buffer(context_, CL_MEM_READ_WRITE, num_groups*accumulator_size);
+
+    // Retrieves the Xdsdot kernels from the compiled binary
+    try {
+      auto& program = GetProgramFromCache();
+      auto kernel1 = Kernel(program, "Xdsdot");
+      auto kernel2 = Kernel(program, "XdsdotEpilogue");
+
+      // Sets the kernel arguments
+      kernel1.SetArgument(0, static_cast<int>(n));
+      kernel1.SetArgument(1, x_buffer());
+      kernel1.SetArgument(2, static_cast<int>(x_offset));
+      kernel1.SetArgument(3, static_cast<int>(x_inc));
+      kernel1.SetArgument(4, y_buffer());
+      kernel1.SetArgument(5, static_cast<int>(y_offset));
+      kernel1.SetArgument(6, static_cast<int>(y_inc));
+      kernel1.SetArgument(7, temp_buffer());
+      kernel2.SetArgument(0, temp_buffer());
+      kernel2.SetArgument(1, dot_buffer());
+      kernel2.SetArgument(2, static_cast<int>(dot_offset));
+      kernel2.SetArgument(3, sb);
+
+      // Launches the main kernel, computing the partial sums
+      auto global1 = std::vector<size_t>{db_["WGS1"]*num_groups};
+      auto local1 = std::vector<size_t>{db_["WGS1"]};
+      status = RunKernel(kernel1, global1, local1, false);
+      if (ErrorIn(status)) { return status; }
+      auto main_event = std::vector<Event>{event_};
+
+      // Launches the epilogue kernel, reducing the partial sums into the final result. It waits for
+      // the event of the main kernel instead of the main kernel being waited for. The event of the
+      // routine is that of the epilogue, which thus signals the completion of the computation.
+      auto global2 = std::vector<size_t>{db_["WGS2"]};
+      auto local2 = std::vector<size_t>{db_["WGS2"]};
+      status = RunKernel(kernel2, global2, local2, false, main_event);
+      if (ErrorIn(status)) { return status; }
+
+      // Succesfully finished the computation
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kInvalidKernel; }
+  } catch (...) { return StatusCode::kTempBufferAllocFailure; }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xdsdot<float>;
+template class Xdsdot<double>;
+
+// =================================================================================================
+} // namespace clblast
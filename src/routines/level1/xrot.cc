@@ -0,0 +1,138 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xrot class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "internal/routines/level1/xrot.h"
+#include "internal/hostblas.h"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Specific implementations to get the memory-type based on a template argument
+template <> const Precision Xrot<float>::precision_ = Precision::kSingle;
+template <> const Precision Xrot<double>::precision_ = Precision::kDouble;
+
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xrot<T>::Xrot(CommandQueue &queue, Event &event):
+    Routine(queue, event, "ROT", {"Xrot"}, precision_) {
+  source_string_ =
+    #include "../../kernels/level1.opencl"
+    #include "../../kernels/xrot.opencl"
+  ;
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+StatusCode Xrot<T>::DoRot(const size_t n,
+                          const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                          const Buffer &y_buffer, const size_t y_offset, const size_t y_inc,
+                          const Buffer &c_buffer, const size_t c_offset,
+                          const Buffer &s_buffer, const size_t s_offset) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { return StatusCode::kInvalidDimension; }
+
+  // Tests the vectors and the rotation parameters for validity
+  auto status = TestVectorX(n, x_buffer, x_offset, x_inc, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorY(n, y_buffer, y_offset, y_inc, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorScalar(1, c_buffer, c_offset, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorScalar(1, s_buffer, s_offset, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+
+  // Small problems on devices sharing their memory with the host are computed by the host backend
+  if (UseHostBackend(n)) {
+    try {
+      HostMapping host(queue_, {x_buffer, y_buffer, c_buffer, s_buffer});
+      HostRot(n, host.Get<T>(0, x_offset), x_inc, host.Get<T>(1, y_offset), y_inc,
+              *host.Get<T>(2, c_offset), *host.Get<T>(3, s_offset));
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kKernelRunError; }
+  }
+
+  // Determines whether or not the fast-version can be used
+  bool use_fast_kernel = (x_offset == 0) && (x_inc == 1) &&
+                         (y_offset == 0) && (y_inc == 1) &&
+                         IsMultiple(n, db_["WGS"]*db_["WPT"]*db_["VW"]);
+
+  // If possible, run the fast-version of the kernel
+  auto kernel_name = (use_fast_kernel) ? "XrotFast" : "Xrot";
+
+  // Retrieves the Xrot kernel from the compiled binary
+  try {
+    auto& program = GetProgramFromCache();
+    auto kernel = Kernel(program, kernel_name);
+
+    // Sets the kernel arguments
+    if (use_fast_kernel) {
+      kernel.SetArgument(0, static_cast<int>(n));
+      kernel.SetArgument(1, x_buffer());
+      kernel.SetArgument(2, y_buffer());
+      kernel.SetArgument(3, c_buffer());
+      kernel.SetArgument(4, static_cast<int>(c_offset));
+      kernel.SetArgument(5, s_buffer());
+      kernel.SetArgument(6, static_cast<int>(s_offset));
+    }
+    else {
+      kernel.SetArgument(0, static_cast<int>(n));
+      kernel.SetArgument(1, x_buffer());
+      kernel.SetArgument(2, static_cast<int>(x_offset));
+      kernel.SetArgument(3, static_cast<int>(x_inc));
+      kernel.SetArgument(4, y_buffer());
+      kernel.SetArgument(5, static_cast<int>(y_offset));
+      kernel.SetArgument(6, static_cast<int>(y_inc));
+      kernel.SetArgument(7, c_buffer());
+      kernel.SetArgument(8, static_cast<int>(c_offset));
+      kernel.SetArgument(9, s_buffer());
+      kernel.SetArgument(10, static_cast<int>(s_offset));
+    }
+
+    // Launches the kernel
+    if (use_fast_kernel) {
+      auto global = std::vector<size_t>{CeilDiv(n, db_["WPT"]*db_["VW"])};
+      auto local = std::vector<size_t>{db_["WGS"]};
+      status = RunKernel(kernel, global, local);
+    }
+    else {
+      auto n_ceiled = Ceil(n, db_["WGS"]*db_["WPT"]);
+      auto global = std::vector<size_t>{n_ceiled/db_["WPT"]};
+      auto local = std::vector<size_t>{db_["WGS"]};
+      status = RunKernel(kernel, global, local);
+    }
+    if (ErrorIn(status)) { return status; }
+
+    // Waits for all kernels to finish
+    queue_.Finish();
+
+    // Succesfully finished the computation
+    return StatusCode::kSuccess;
+  } catch (...) { return StatusCode::kInvalidKernel; }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xrot<float>;
+template class Xrot<double>;
+
+// =================================================================================================
+} // namespace clblast
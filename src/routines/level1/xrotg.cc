@@ -0,0 +1,93 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xrotg class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "internal/routines/level1/xrotg.h"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Specific implementations to get the memory-type based on a template argument
+template <> const Precision Xrotg<float>::precision_ = Precision::kSingle;
+template <> const Precision Xrotg<double>::precision_ = Precision::kDouble;
+
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xrotg<T>::Xrotg(CommandQueue &queue, Event &event):
+    Routine(queue, event, "ROTG", {}, precision_) {
+  source_string_ =
+    #include "../../kernels/xrotg.opencl"
+  ;
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+StatusCode Xrotg<T>::DoRotg(const Buffer &a_buffer, const size_t a_offset,
+                            const Buffer &b_buffer, const size_t b_offset,
+                            const Buffer &c_buffer, const size_t c_offset,
+                            const Buffer &s_buffer, const size_t s_offset) {
+
+  // Tests the scalars for validity
+  auto status = TestVectorScalar(1, a_buffer, a_offset, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorScalar(1, b_buffer, b_offset, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorScalar(1, c_buffer, c_offset, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorScalar(1, s_buffer, s_offset, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+
+  // Retrieves the Xrotg kernel from the compiled binary. There is no host backend for this routine:
+  // it stays on the queue, such that it can be chained with Xrot without synchronisation.
+  try {
+    auto& program = GetProgramFromCache();
+    auto kernel = Kernel(program, "Xrotg");
+
+    // Sets the kernel arguments
+    kernel.SetArgument(0, a_buffer());
+    kernel.SetArgument(1, static_cast<int>(a_offset));
+    kernel.SetArgument(2, b_buffer());
+    kernel.SetArgument(3, static_cast<int>(b_offset));
+    kernel.SetArgument(4, c_buffer());
+    kernel.SetArgument(5, static_cast<int>(c_offset));
+    kernel.SetArgument(6, s_buffer());
+    kernel.SetArgument(7, static_cast<int>(s_offset));
+
+    // Launches the kernel with a single work-item
+    auto global = std::vector<size_t>{1};
+    auto local = std::vector<size_t>{1};
+    status = RunKernel(kernel, global, local);
+    if (ErrorIn(status)) { return status; }
+
+    // Waits for all kernels to finish
+    queue_.Finish();
+
+    // Succesfully finished the computation
+    return StatusCode::kSuccess;
+  } catch (...) { return StatusCode::kInvalidKernel; }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xrotg<float>;
+template class Xrotg<double>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,98 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xrotmg class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "internal/routines/level1/xrotmg.h"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Specific implementations to get the memory-type based on a template argument
+template <> const Precision Xrotmg<float>::precision_ = Precision::kSingle;
+template <> const Precision Xrotmg<double>::precision_ = Precision::kDouble;
+
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xrotmg<T>::Xrotmg(CommandQueue &queue, Event &event):
+    Routine(queue, event, "ROTMG", {}, precision_) {
+  source_string_ =
+    #include "../../kernels/xrotg.opencl"
+  ;
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+StatusCode Xrotmg<T>::DoRotmg(const Buffer &d1_buffer, const size_t d1_offset,
+                              const Buffer &d2_buffer, const size_t d2_offset,
+                              const Buffer &x1_buffer, const size_t x1_offset,
+                              const Buffer &y1_buffer, const size_t y1_offset,
+                              const Buffer &param_buffer, const size_t param_offset) {
+
+  // Tests the scalars and the parameter array for validity
+  auto status = TestVectorScalar(1, d1_buffer, d1_offset, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorScalar(1, d2_buffer, d2_offset, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorScalar(1, x1_buffer, x1_offset, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorScalar(1, y1_buffer, y1_offset, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorScalar(5, param_buffer, param_offset, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+
+  // Retrieves the Xrotmg kernel from the compiled binary. There is no host backend for this
+  // routine: it stays on the queue, such that it can be chained with Xrotm without synchronisation.
+  try {
+    auto& program = GetProgramFromCache();
+    auto kernel = Kernel(program, "Xrotmg");
+
+    // Sets the kernel arguments
+    kernel.SetArgument(0, d1_buffer());
+    kernel.SetArgument(1, static_cast<int>(d1_offset));
+    kernel.SetArgument(2, d2_buffer());
+    kernel.SetArgument(3, static_cast<int>(d2_offset));
+    kernel.SetArgument(4, x1_buffer());
+    kernel.SetArgument(5, static_cast<int>(x1_offset));
+    kernel.SetArgument(6, y1_buffer());
+    kernel.SetArgument(7, static_cast<int>(y1_offset));
+    kernel.SetArgument(8, param_buffer());
+    kernel.SetArgument(9, static_cast<int>(param_offset));
+
+    // Launches the kernel with a single work-item
+    auto global = std::vector<size_t>{1};
+    auto local = std::vector<size_t>{1};
+    status = RunKernel(kernel, global, local);
+    if (ErrorIn(status)) { return status; }
+
+    // Waits for all kernels to finish
+    queue_.Finish();
+
+    // Succesfully finished the computation
+    return StatusCode::kSuccess;
+  } catch (...) { return StatusCode::kInvalidKernel; }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xrotmg<float>;
+template class Xrotmg<double>;
+
+// =================================================================================================
+} // namespace clblast
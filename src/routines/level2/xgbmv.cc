@@ -0,0 +1,159 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xgbmv class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "internal/routines/level2/xgbmv.h"
+#include "internal/hostblas.h"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Specific implementations to get the memory-type based on a template argument
+template <> const Precision Xgbmv<float>::precision_ = Precision::kSingle;
+template <> const Precision Xgbmv<double>::precision_ = Precision::kDouble;
+template <> const Precision Xgbmv<float2>::precision_ = Precision::kComplexSingle;
+template <> const Precision Xgbmv<double2>::precision_ = Precision::kComplexDouble;
+
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xgbmv<T>::Xgbmv(CommandQueue &queue, Event &event):
+    Routine(queue, event, "GBMV", {"Xgbmv"}, precision_) {
+  source_string_ =
+    #include "../../kernels/xgbmv.opencl"
+  ;
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+StatusCode Xgbmv<T>::DoGbmv(const Layout layout, const Transpose a_transpose,
+                            const size_t m, const size_t n, const size_t kl, const size_t ku,
+                            const T alpha,
+                            const Buffer &a_buffer, const size_t a_offset, const size_t a_ld,
+                            const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                            const T beta,
+                            const Buffer &y_buffer, const size_t y_offset, const size_t y_inc) {
+
+  // Makes sure all dimensions are larger than zero
+  if (m == 0 || n == 0) { return StatusCode::kInvalidDimension; }
+
+  // Computes whether or not the matrix has an alternative layout (row or column-major), with the
+  // same definitions as the Xgemv routine ('^' is the XOR operator). Transposing swaps the sub- and
+  // super-diagonals of the band.
+  auto a_transposed = (a_transpose != Transpose::kNo);
+  auto a_rotated = a_transposed ^ (layout == Layout::kRowMajor);
+  auto a_conjugate = (a_transpose == Transpose::kConjugate);
+  auto m_real = (a_transposed) ? n : m;
+  auto n_real = (a_transposed) ? m : n;
+  auto kl_real = (a_transposed) ? ku : kl;
+  auto ku_real = (a_transposed) ? kl : ku;
+
+  // Tests the matrix and the vectors for validity: the band format holds kl+ku+1 elements for each
+  // column (or row, for a row-major layout) of A
+  auto a_two = (layout == Layout::kRowMajor) ? m : n;
+  auto status = TestMatrixA(kl + ku + 1, a_two, a_buffer, a_offset, a_ld, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorX(n_real, x_buffer, x_offset, x_inc, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorY(m_real, y_buffer, y_offset, y_inc, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+
+  // Small problems on devices sharing their memory with the host are computed by the host backend
+  if (UseHostBackend(m_real*(kl + ku + 1))) {
+    try {
+      HostMapping host(queue_, {a_buffer, x_buffer, y_buffer});
+      HostGbmv(layout, a_transpose, m, n, kl, ku, alpha, host.Get<T>(0, a_offset), a_ld,
+               host.Get<T>(1, x_offset), x_inc, beta, host.Get<T>(2, y_offset), y_inc);
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kKernelRunError; }
+  }
+
+  // Runs the kernel
+  return BandMatVec(m_real, n_real, static_cast<int>(kl_real), static_cast<int>(ku_real),
+                    alpha, beta,
+                    a_buffer, a_offset, a_ld,
+                    x_buffer, x_offset, x_inc,
+                    y_buffer, y_offset, y_inc,
+                    a_rotated, a_conjugate, false, false, false);
+}
+
+// =================================================================================================
+
+// Runs the Xgbmv kernel, optionally without waiting for its completion but after the given events
+template <typename T>
+StatusCode Xgbmv<T>::BandMatVec(const size_t m, const size_t n, const int kl, const int ku,
+                                const T alpha, const T beta,
+                                const Buffer &a_buffer, const size_t a_offset, const size_t a_ld,
+                                const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                                const Buffer &y_buffer, const size_t y_offset, const size_t y_inc,
+                                const bool a_rotated, const bool a_conjugate,
+                                const bool is_symmetric, const bool is_hermitian,
+                                const bool unit_diagonal, const bool wait,
+                                const std::vector<Event> &wait_for_events) {
+
+  // Retrieves the Xgbmv kernel from the compiled binary
+  try {
+    auto& program = GetProgramFromCache();
+    auto kernel = Kernel(program, "Xgbmv");
+
+    // Sets the kernel arguments
+    kernel.SetArgument(0, static_cast<int>(m));
+    kernel.SetArgument(1, static_cast<int>(n));
+    kernel.SetArgument(2, kl);
+    kernel.SetArgument(3, ku);
+    kernel.SetArgument(4, alpha);
+    kernel.SetArgument(5, beta);
+    kernel.SetArgument(6, a_buffer());
+    kernel.SetArgument(7, static_cast<int>(a_offset));
+    kernel.SetArgument(8, static_cast<int>(a_ld));
+    kernel.SetArgument(9, x_buffer());
+    kernel.SetArgument(10, static_cast<int>(x_offset));
+    kernel.SetArgument(11, static_cast<int>(x_inc));
+    kernel.SetArgument(12, y_buffer());
+    kernel.SetArgument(13, static_cast<int>(y_offset));
+    kernel.SetArgument(14, static_cast<int>(y_inc));
+    kernel.SetArgument(15, static_cast<int>(a_rotated));
+    kernel.SetArgument(16, static_cast<int>(a_conjugate));
+    kernel.SetArgument(17, static_cast<int>(is_symmetric));
+    kernel.SetArgument(18, static_cast<int>(is_hermitian));
+    kernel.SetArgument(19, static_cast<int>(unit_diagonal));
+
+    // Launches the kernel: each work-group computes WGS*WPT consecutive elements of Y
+    auto num_groups = CeilDiv(m, db_["WGS"]*db_["WPT"]);
+    auto global = std::vector<size_t>{num_groups*db_["WGS"]};
+    auto local = std::vector<size_t>{db_["WGS"]};
+    auto status = RunKernel(kernel, global, local, wait, wait_for_events);
+    if (ErrorIn(status)) { return status; }
+
+    // Waits for all kernels to finish
+    if (wait) { queue_.Finish(); }
+
+    // Succesfully finished the computation
+    return StatusCode::kSuccess;
+  } catch (...) { return StatusCode::kInvalidKernel; }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xgbmv<float>;
+template class Xgbmv<double>;
+template class Xgbmv<float2>;
+template class Xgbmv<double2>;
+
+// =================================================================================================
+} // namespace clblast
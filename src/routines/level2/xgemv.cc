@@ -12,6 +12,7 @@
 // =================================================================================================
 
 #include "internal/routines/level2/xgemv.h"
+#include "internal/hostblas.h"
 
 #include <string>
 #include <vector>
@@ -24,6 +25,7 @@ template <> const Precision Xgemv<float>::precision_ = Precision::kSingle;
 template <> const Precision Xgemv<double>::precision_ = Precision::kDouble;
 template <> const Precision Xgemv<float2>::precision_ = Precision::kComplexSingle;
 template <> const Precision Xgemv<double2>::precision_ = Precision::kComplexDouble;
+template <> const Precision Xgemv<half>::precision_ = Precision::kHalf;
 
 // =================================================================================================
 
@@ -75,6 +77,16 @@ StatusCode Xgemv<T>::DoGemv(const Layout layout, const Transpose a_transpose,
   status = TestVectorY(m_real, y_buffer, y_offset, y_inc, sizeof(T));
   if (ErrorIn(status)) { return status; }
 
+  // Small problems on devices sharing their memory with the host are computed by the host backend
+  if (UseHostBackend(m*n)) {
+    try {
+      HostMapping host(queue_, {a_buffer, x_buffer, y_buffer});
+      HostGemv(layout, a_transpose, m, n, alpha, host.Get<T>(0, a_offset), a_ld,
+               host.Get<T>(1, x_offset), x_inc, beta, host.Get<T>(2, y_offset), y_inc);
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kKernelRunError; }
+  }
+
   // Determines whether or not the fast-version can be used
   bool use_fast_kernel = (a_offset == 0) && (a_rotated == 0) && (a_conjugate == 0) &&
                          IsMultiple(m, db_["WGS2"]*db_["WPT2"]) &&
@@ -144,6 +156,7 @@ template class Xgemv<float>;
 template class Xgemv<double>;
 template class Xgemv<float2>;
 template class Xgemv<double2>;
+template class Xgemv<half>;
 
 // =================================================================================================
 } // namespace clblast
@@ -0,0 +1,157 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xger class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "internal/routines/level2/xger.h"
+#include "internal/hostblas.h"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Specific implementations to get the memory-type based on a template argument
+template <> const Precision Xger<float>::precision_ = Precision::kSingle;
+template <> const Precision Xger<double>::precision_ = Precision::kDouble;
+template <> const Precision Xger<float2>::precision_ = Precision::kComplexSingle;
+template <> const Precision Xger<double2>::precision_ = Precision::kComplexDouble;
+
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xger<T>::Xger(CommandQueue &queue, Event &event):
+    Routine(queue, event, "GER", {"Xger"}, precision_) {
+  source_string_ =
+    #include "../../kernels/level1.opencl"
+    #include "../../kernels/xger.opencl"
+  ;
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+StatusCode Xger<T>::DoGer(const Layout layout,
+                          const size_t m, const size_t n,
+                          const T alpha,
+                          const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                          const Buffer &y_buffer, const size_t y_offset, const size_t y_inc,
+                          const Buffer &a_buffer, const size_t a_offset, const size_t a_ld,
+                          const bool do_conjugate) {
+
+  // Makes sure all dimensions are larger than zero
+  if (m == 0 || n == 0) { return StatusCode::kInvalidDimension; }
+
+  // Computes whether or not the matrix has an alternative layout (row or column-major). The kernel
+  // updates A along its first dimension with the vector 'u' and along its second with 'v': for a
+  // row-major matrix these are Y and X respectively. The conjugate always applies to Y.
+  auto a_altlayout = (layout == Layout::kRowMajor);
+  auto a_one = (a_altlayout) ? n : m;
+  auto a_two = (a_altlayout) ? m : n;
+
+  // Tests the matrix and the vectors for validity
+  auto status = TestMatrixA(a_one, a_two, a_buffer, a_offset, a_ld, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorX(m, x_buffer, x_offset, x_inc, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorY(n, y_buffer, y_offset, y_inc, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+
+  // Small problems on devices sharing their memory with the host are computed by the host backend
+  if (UseHostBackend(m*n)) {
+    try {
+      HostMapping host(queue_, {x_buffer, y_buffer, a_buffer});
+      HostGer(layout, m, n, alpha, host.Get<T>(0, x_offset), x_inc,
+              host.Get<T>(1, y_offset), y_inc, host.Get<T>(2, a_offset), a_ld, do_conjugate);
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kKernelRunError; }
+  }
+
+  // Selects the vectors along the first and second dimension of the matrix
+  const auto &u_buffer = (a_altlayout) ? y_buffer : x_buffer;
+  const auto &v_buffer = (a_altlayout) ? x_buffer : y_buffer;
+  auto u_offset = (a_altlayout) ? y_offset : x_offset;
+  auto v_offset = (a_altlayout) ? x_offset : y_offset;
+  auto u_inc = (a_altlayout) ? y_inc : x_inc;
+  auto v_inc = (a_altlayout) ? x_inc : y_inc;
+  auto u_conjugate = (do_conjugate && a_altlayout);
+  auto v_conjugate = (do_conjugate && !a_altlayout);
+
+  // Determines whether or not the fast-version can be used
+  bool use_fast_kernel = (a_offset == 0) && IsMultiple(a_ld, db_["VW"]) &&
+                         IsMultiple(a_one, db_["WGS1"]*db_["VW"]) &&
+                         IsMultiple(a_two, db_["WGS2"]*db_["WPT"]);
+
+  // If possible, run the fast-version of the kernel
+  auto kernel_name = (use_fast_kernel) ? "XgerFast" : "Xger";
+
+  // Retrieves the Xger kernel from the compiled binary
+  try {
+    auto& program = GetProgramFromCache();
+    auto kernel = Kernel(program, kernel_name);
+
+    // Sets the kernel arguments
+    kernel.SetArgument(0, static_cast<int>(a_one));
+    kernel.SetArgument(1, static_cast<int>(a_two));
+    kernel.SetArgument(2, alpha);
+    kernel.SetArgument(3, u_buffer());
+    kernel.SetArgument(4, static_cast<int>(u_offset));
+    kernel.SetArgument(5, static_cast<int>(u_inc));
+    kernel.SetArgument(6, v_buffer());
+    kernel.SetArgument(7, static_cast<int>(v_offset));
+    kernel.SetArgument(8, static_cast<int>(v_inc));
+    kernel.SetArgument(9, a_buffer());
+    if (use_fast_kernel) {
+      kernel.SetArgument(10, static_cast<int>(a_ld));
+      kernel.SetArgument(11, static_cast<int>(u_conjugate));
+      kernel.SetArgument(12, static_cast<int>(v_conjugate));
+    }
+    else {
+      kernel.SetArgument(10, static_cast<int>(a_offset));
+      kernel.SetArgument(11, static_cast<int>(a_ld));
+      kernel.SetArgument(12, static_cast<int>(u_conjugate));
+      kernel.SetArgument(13, static_cast<int>(v_conjugate));
+    }
+
+    // Launches the kernel
+    auto local = std::vector<size_t>{db_["WGS1"], db_["WGS2"]};
+    if (use_fast_kernel) {
+      auto global = std::vector<size_t>{a_one/db_["VW"], a_two/db_["WPT"]};
+      status = RunKernel(kernel, global, local);
+    }
+    else {
+      auto a_one_ceiled = Ceil(a_one, db_["WGS1"]);
+      auto a_two_ceiled = Ceil(a_two, db_["WGS2"]*db_["WPT"]);
+      auto global = std::vector<size_t>{a_one_ceiled, a_two_ceiled/db_["WPT"]};
+      status = RunKernel(kernel, global, local);
+    }
+    if (ErrorIn(status)) { return status; }
+
+    // Waits for all kernels to finish
+    queue_.Finish();
+
+    // Succesfully finished the computation
+    return StatusCode::kSuccess;
+  } catch (...) { return StatusCode::kInvalidKernel; }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xger<float>;
+template class Xger<double>;
+template class Xger<float2>;
+template class Xger<double2>;
+
+// =================================================================================================
+} // namespace clblast
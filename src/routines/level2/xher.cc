@@ -0,0 +1,52 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xher class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "internal/routines/level2/xher.h"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T, typename U>
+Xher<T,U>::Xher(CommandQueue &queue, Event &event):
+    Xsyr<T>(queue, event) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T, typename U>
+StatusCode Xher<T,U>::DoHer(const Layout layout, const Triangle triangle,
+                            const size_t n,
+                            const U alpha,
+                            const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                            const Buffer &a_buffer, const size_t a_offset, const size_t a_ld) {
+
+  // The real-valued alpha is passed to the kernel as a complex number
+  auto complex_alpha = T{alpha, static_cast<U>(0.0)};
+  return DoSyr(layout, triangle, n, complex_alpha,
+               x_buffer, x_offset, x_inc,
+               a_buffer, a_offset, a_ld,
+               true);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xher<float2,float>;
+template class Xher<double2,double>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,52 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xhpr class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "internal/routines/level2/xhpr.h"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T, typename U>
+Xhpr<T,U>::Xhpr(CommandQueue &queue, Event &event):
+    Xspr<T>(queue, event) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T, typename U>
+StatusCode Xhpr<T,U>::DoHpr(const Layout layout, const Triangle triangle,
+                            const size_t n,
+                            const U alpha,
+                            const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                            const Buffer &ap_buffer, const size_t ap_offset) {
+
+  // The real-valued alpha is passed to the kernel as a complex number
+  auto complex_alpha = T{alpha, static_cast<U>(0.0)};
+  return DoSpr(layout, triangle, n, complex_alpha,
+               x_buffer, x_offset, x_inc,
+               ap_buffer, ap_offset,
+               true);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xhpr<float2,float>;
+template class Xhpr<double2,double>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,88 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xsbmv class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "internal/routines/level2/xsbmv.h"
+#include "internal/hostblas.h"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xsbmv<T>::Xsbmv(CommandQueue &queue, Event &event):
+    Xgbmv<T>(queue, event) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+StatusCode Xsbmv<T>::DoSbmv(const Layout layout, const Triangle triangle,
+                            const size_t n, const size_t k,
+                            const T alpha,
+                            const Buffer &a_buffer, const size_t a_offset, const size_t a_ld,
+                            const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                            const T beta,
+                            const Buffer &y_buffer, const size_t y_offset, const size_t y_inc,
+                            const bool is_hermitian) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { return StatusCode::kInvalidDimension; }
+
+  // The stored triangle is a band with either 'k' sub-diagonals or 'k' super-diagonals. The band
+  // format holds the columns of A, or its rows in case of a row-major layout. The kernel mirrors
+  // the stored band into the other triangle.
+  auto a_rotated = (layout == Layout::kRowMajor);
+  auto kl = (triangle == Triangle::kLower) ? k : size_t{0};
+  auto ku = (triangle == Triangle::kUpper) ? k : size_t{0};
+
+  // Tests the matrix and the vectors for validity
+  auto status = TestMatrixA(k + 1, n, a_buffer, a_offset, a_ld, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorX(n, x_buffer, x_offset, x_inc, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorY(n, y_buffer, y_offset, y_inc, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+
+  // Small problems on devices sharing their memory with the host are computed by the host backend
+  if (UseHostBackend(n*(2*k + 1))) {
+    try {
+      HostMapping host(queue_, {a_buffer, x_buffer, y_buffer});
+      HostSbmv(layout, triangle, n, k, alpha, host.Get<T>(0, a_offset), a_ld,
+               host.Get<T>(1, x_offset), x_inc, beta, host.Get<T>(2, y_offset), y_inc,
+               is_hermitian);
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kKernelRunError; }
+  }
+
+  // Runs the kernel
+  return BandMatVec(n, n, static_cast<int>(kl), static_cast<int>(ku),
+                    alpha, beta,
+                    a_buffer, a_offset, a_ld,
+                    x_buffer, x_offset, x_inc,
+                    y_buffer, y_offset, y_inc,
+                    a_rotated, false, true, is_hermitian, false);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xsbmv<float>;
+template class Xsbmv<double>;
+template class Xsbmv<float2>;
+template class Xsbmv<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,154 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xspmv class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "internal/routines/level2/xspmv.h"
+#include "internal/hostblas.h"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Specific implementations to get the memory-type based on a template argument
+template <> const Precision Xspmv<float>::precision_ = Precision::kSingle;
+template <> const Precision Xspmv<double>::precision_ = Precision::kDouble;
+template <> const Precision Xspmv<float2>::precision_ = Precision::kComplexSingle;
+template <> const Precision Xspmv<double2>::precision_ = Precision::kComplexDouble;
+
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xspmv<T>::Xspmv(CommandQueue &queue, Event &event):
+    Routine(queue, event, "SPMV", {"Xspmv"}, precision_) {
+  source_string_ =
+    #include "../../kernels/xspmv.opencl"
+  ;
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+StatusCode Xspmv<T>::DoSpmv(const Layout layout, const Triangle triangle,
+                            const size_t n,
+                            const T alpha,
+                            const Buffer &ap_buffer, const size_t ap_offset,
+                            const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                            const T beta,
+                            const Buffer &y_buffer, const size_t y_offset, const size_t y_inc,
+                            const bool is_hermitian) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { return StatusCode::kInvalidDimension; }
+
+  // The packed format holds the columns of the stored triangle of A, or its rows in case of a
+  // row-major layout. The kernel mirrors the stored triangle into the other triangle.
+  auto a_rotated = (layout == Layout::kRowMajor);
+  auto is_lower = (triangle == Triangle::kLower);
+
+  // Tests the matrix and the vectors for validity
+  auto status = TestMatrixAP(n, ap_buffer, ap_offset, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorX(n, x_buffer, x_offset, x_inc, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorY(n, y_buffer, y_offset, y_inc, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+
+  // Small problems on devices sharing their memory with the host are computed by the host backend
+  if (UseHostBackend(n*n)) {
+    try {
+      HostMapping host(queue_, {ap_buffer, x_buffer, y_buffer});
+      HostSpmv(layout, triangle, n, alpha, host.Get<T>(0, ap_offset),
+               host.Get<T>(1, x_offset), x_inc, beta, host.Get<T>(2, y_offset), y_inc,
+               is_hermitian);
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kKernelRunError; }
+  }
+
+  // Runs the kernel
+  return PackedMatVec(n, n, n, 0, 0, alpha, beta,
+                      ap_buffer, ap_offset,
+                      x_buffer, x_offset, x_inc,
+                      y_buffer, y_offset, y_inc,
+                      a_rotated, false, is_lower, true, is_hermitian, false);
+}
+
+// =================================================================================================
+
+// Runs the Xspmv kernel, optionally without waiting for its completion but after the given events
+template <typename T>
+StatusCode Xspmv<T>::PackedMatVec(const size_t m, const size_t n, const size_t a_n,
+                                  const size_t row_offset, const size_t col_offset,
+                                  const T alpha, const T beta,
+                                  const Buffer &ap_buffer, const size_t ap_offset,
+                                  const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                                  const Buffer &y_buffer, const size_t y_offset, const size_t y_inc,
+                                  const bool a_rotated, const bool a_conjugate,
+                                  const bool is_lower, const bool is_symmetric,
+                                  const bool is_hermitian, const bool unit_diagonal,
+                                  const bool wait, const std::vector<Event> &wait_for_events) {
+
+  // Retrieves the Xspmv kernel from the compiled binary
+  try {
+    auto& program = GetProgramFromCache();
+    auto kernel = Kernel(program, "Xspmv");
+
+    // Sets the kernel arguments
+    kernel.SetArgument(0, static_cast<int>(m));
+    kernel.SetArgument(1, static_cast<int>(n));
+    kernel.SetArgument(2, static_cast<int>(a_n));
+    kernel.SetArgument(3, static_cast<int>(row_offset));
+    kernel.SetArgument(4, static_cast<int>(col_offset));
+    kernel.SetArgument(5, alpha);
+    kernel.SetArgument(6, beta);
+    kernel.SetArgument(7, ap_buffer());
+    kernel.SetArgument(8, static_cast<int>(ap_offset));
+    kernel.SetArgument(9, x_buffer());
+    kernel.SetArgument(10, static_cast<int>(x_offset));
+    kernel.SetArgument(11, static_cast<int>(x_inc));
+    kernel.SetArgument(12, y_buffer());
+    kernel.SetArgument(13, static_cast<int>(y_offset));
+    kernel.SetArgument(14, static_cast<int>(y_inc));
+    kernel.SetArgument(15, static_cast<int>(a_rotated));
+    kernel.SetArgument(16, static_cast<int>(a_conjugate));
+    kernel.SetArgument(17, static_cast<int>(is_lower));
+    kernel.SetArgument(18, static_cast<int>(is_symmetric));
+    kernel.SetArgument(19, static_cast<int>(is_hermitian));
+    kernel.SetArgument(20, static_cast<int>(unit_diagonal));
+
+    // Launches the kernel: each work-group computes WGS*WPT consecutive elements of Y
+    auto num_groups = CeilDiv(m, db_["WGS"]*db_["WPT"]);
+    auto global = std::vector<size_t>{num_groups*db_["WGS"]};
+    auto local = std::vector<size_t>{db_["WGS"]};
+    auto status = RunKernel(kernel, global, local, wait, wait_for_events);
+    if (ErrorIn(status)) { return status; }
+
+    // Waits for all kernels to finish
+    if (wait) { queue_.Finish(); }
+
+    // Succesfully finished the computation
+    return StatusCode::kSuccess;
+  } catch (...) { return StatusCode::kInvalidKernel; }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xspmv<float>;
+template class Xspmv<double>;
+template class Xspmv<float2>;
+template class Xspmv<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,103 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xspr class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "internal/routines/level2/xspr.h"
+#include "internal/hostblas.h"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xspr<T>::Xspr(CommandQueue &queue, Event &event):
+    Xspmv<T>(queue, event) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+StatusCode Xspr<T>::DoSpr(const Layout layout, const Triangle triangle,
+                          const size_t n,
+                          const T alpha,
+                          const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                          const Buffer &ap_buffer, const size_t ap_offset,
+                          const bool is_hermitian) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { return StatusCode::kInvalidDimension; }
+
+  // The packed format holds the columns of the stored triangle of A, or its rows in case of a
+  // row-major layout
+  auto a_rotated = (layout == Layout::kRowMajor);
+  auto is_lower = (triangle == Triangle::kLower);
+
+  // Tests the vector and the matrix for validity
+  auto status = TestVectorX(n, x_buffer, x_offset, x_inc, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestMatrixAP(n, ap_buffer, ap_offset, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+
+  // Small problems on devices sharing their memory with the host are computed by the host backend
+  if (UseHostBackend((n*(n + 1))/2)) {
+    try {
+      HostMapping host(queue_, {x_buffer, ap_buffer});
+      HostSpr(layout, triangle, n, alpha, host.Get<T>(0, x_offset), x_inc,
+              host.Get<T>(1, ap_offset), is_hermitian);
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kKernelRunError; }
+  }
+
+  // Retrieves the Xspr kernel from the compiled binary
+  try {
+    auto& program = GetProgramFromCache();
+    auto kernel = Kernel(program, "Xspr");
+
+    // Sets the kernel arguments
+    kernel.SetArgument(0, static_cast<int>(n));
+    kernel.SetArgument(1, alpha);
+    kernel.SetArgument(2, x_buffer());
+    kernel.SetArgument(3, static_cast<int>(x_offset));
+    kernel.SetArgument(4, static_cast<int>(x_inc));
+    kernel.SetArgument(5, ap_buffer());
+    kernel.SetArgument(6, static_cast<int>(ap_offset));
+    kernel.SetArgument(7, static_cast<int>(a_rotated));
+    kernel.SetArgument(8, static_cast<int>(is_lower));
+    kernel.SetArgument(9, static_cast<int>(is_hermitian));
+
+    // Launches the kernel: the first dimension runs along the packed columns (or rows)
+    auto global = std::vector<size_t>{Ceil(n, db_["WGS"]), n};
+    auto local = std::vector<size_t>{db_["WGS"], 1};
+    status = RunKernel(kernel, global, local);
+    if (ErrorIn(status)) { return status; }
+
+    // Waits for all kernels to finish
+    queue_.Finish();
+
+    // Succesfully finished the computation
+    return StatusCode::kSuccess;
+  } catch (...) { return StatusCode::kInvalidKernel; }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xspr<float>;
+template class Xspr<double>;
+template class Xspr<float2>;
+template class Xspr<double2>;
+
+// =================================================================================================
+} // namespace clblast
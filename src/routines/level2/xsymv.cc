@@ -0,0 +1,146 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xsymv class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "internal/routines/level2/xsymv.h"
+#include "internal/hostblas.h"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Specific implementations to get the memory-type based on a template argument
+template <> const Precision Xsymv<float>::precision_ = Precision::kSingle;
+template <> const Precision Xsymv<double>::precision_ = Precision::kDouble;
+template <> const Precision Xsymv<float2>::precision_ = Precision::kComplexSingle;
+template <> const Precision Xsymv<double2>::precision_ = Precision::kComplexDouble;
+
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xsymv<T>::Xsymv(CommandQueue &queue, Event &event):
+    Routine(queue, event, "SYMV", {"Xsymv"}, precision_) {
+  source_string_ =
+    #include "../../kernels/xsymv.opencl"
+  ;
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+StatusCode Xsymv<T>::DoSymv(const Layout layout, const Triangle triangle,
+                            const size_t n,
+                            const T alpha,
+                            const Buffer &a_buffer, const size_t a_offset, const size_t a_ld,
+                            const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                            const T beta,
+                            const Buffer &y_buffer, const size_t y_offset, const size_t y_inc,
+                            const bool is_hermitian) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { return StatusCode::kInvalidDimension; }
+
+  // The kernels read the stored triangle as a lower-triangular matrix. Depending on the layout and
+  // the triangle, this matrix is accessed 'rotated' ('^' is the XOR operator). The stored upper
+  // triangle of a Hermitian matrix is conjugated when mirrored into the lower triangle.
+  auto a_rotated = (triangle == Triangle::kUpper) ^ (layout == Layout::kRowMajor);
+  auto a_conjugate = is_hermitian && (triangle == Triangle::kUpper);
+
+  // Tests the matrix and the vectors for validity
+  auto status = TestMatrixA(n, n, a_buffer, a_offset, a_ld, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorX(n, x_buffer, x_offset, x_inc, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorY(n, y_buffer, y_offset, y_inc, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+
+  // Small problems on devices sharing their memory with the host are computed by the host backend
+  if (UseHostBackend(n*n)) {
+    try {
+      HostMapping host(queue_, {a_buffer, x_buffer, y_buffer});
+      HostSymv(layout, triangle, n, alpha, host.Get<T>(0, a_offset), a_ld,
+               host.Get<T>(1, x_offset), x_inc, beta, host.Get<T>(2, y_offset), y_inc,
+               is_hermitian);
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kKernelRunError; }
+  }
+
+  // Each work-group of the main kernel processes up to WPT1 block-columns of WGS1 wide and stores
+  // its partial results for all n rows of Y
+  auto num_blocks = CeilDiv(n, db_["WGS1"]);
+  auto num_groups = CeilDiv(num_blocks, db_["WPT1"]);
+
+  // Temporary buffer for the partial results: if memory allocation fails, throw an exception
+  try {
+    auto temp_buffer = Buffer(context_, CL_MEM_READ_WRITE, num_groups*n*sizeof(T));
+
+    // Retrieves the Xsymv kernels from the compiled binary
+    try {
+      auto& program = GetProgramFromCache();
+      auto kernel1 = Kernel(program, "Xsymv");
+      auto kernel2 = Kernel(program, "XsymvEpilogue");
+
+      // Sets the kernel arguments
+      kernel1.SetArgument(0, static_cast<int>(n));
+      kernel1.SetArgument(1, a_buffer());
+      kernel1.SetArgument(2, static_cast<int>(a_offset));
+      kernel1.SetArgument(3, static_cast<int>(a_ld));
+      kernel1.SetArgument(4, x_buffer());
+      kernel1.SetArgument(5, static_cast<int>(x_offset));
+      kernel1.SetArgument(6, static_cast<int>(x_inc));
+      kernel1.SetArgument(7, temp_buffer());
+      kernel1.SetArgument(8, static_cast<int>(a_rotated));
+      kernel1.SetArgument(9, static_cast<int>(a_conjugate));
+      kernel1.SetArgument(10, static_cast<int>(is_hermitian));
+      kernel2.SetArgument(0, static_cast<int>(n));
+      kernel2.SetArgument(1, alpha);
+      kernel2.SetArgument(2, beta);
+      kernel2.SetArgument(3, temp_buffer());
+      kernel2.SetArgument(4, static_cast<int>(num_groups));
+      kernel2.SetArgument(5, y_buffer());
+      kernel2.SetArgument(6, static_cast<int>(y_offset));
+      kernel2.SetArgument(7, static_cast<int>(y_inc));
+
+      // Launches the main kernel, computing the partial results
+      auto global1 = std::vector<size_t>{db_["WGS1"]*num_groups};
+      auto local1 = std::vector<size_t>{db_["WGS1"]};
+      status = RunKernel(kernel1, global1, local1);
+      if (ErrorIn(status)) { return status; }
+
+      // Launches the epilogue kernel, summing the partial results into Y
+      auto global2 = std::vector<size_t>{Ceil(n, db_["WGS2"])};
+      auto local2 = std::vector<size_t>{db_["WGS2"]};
+      status = RunKernel(kernel2, global2, local2);
+      if (ErrorIn(status)) { return status; }
+
+      // Waits for all kernels to finish
+      queue_.Finish();
+
+      // Succesfully finished the computation
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kInvalidKernel; }
+  } catch (...) { return StatusCode::kTempBufferAllocFailure; }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xsymv<float>;
+template class Xsymv<double>;
+template class Xsymv<float2>;
+template class Xsymv<double2>;
+
+// =================================================================================================
+} // namespace clblast
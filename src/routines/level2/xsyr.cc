@@ -0,0 +1,138 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xsyr class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "internal/routines/level2/xsyr.h"
+#include "internal/hostblas.h"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xsyr<T>::Xsyr(CommandQueue &queue, Event &event):
+    Xger<T>(queue, event) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+StatusCode Xsyr<T>::DoSyr(const Layout layout, const Triangle triangle,
+                          const size_t n,
+                          const T alpha,
+                          const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                          const Buffer &a_buffer, const size_t a_offset, const size_t a_ld,
+                          const bool is_hermitian) {
+  return RankUpdate(layout, triangle, n, alpha, alpha,
+                    x_buffer, x_offset, x_inc,
+                    x_buffer, x_offset, x_inc,
+                    a_buffer, a_offset, a_ld,
+                    false, is_hermitian);
+}
+
+// =================================================================================================
+
+// The rank-1 or rank-2 update of the triangle of A
+template <typename T>
+StatusCode Xsyr<T>::RankUpdate(const Layout layout, const Triangle triangle,
+                               const size_t n,
+                               const T alpha, const T alpha2,
+                               const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                               const Buffer &y_buffer, const size_t y_offset, const size_t y_inc,
+                               const Buffer &a_buffer, const size_t a_offset, const size_t a_ld,
+                               const bool is_rank_two, const bool is_hermitian) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { return StatusCode::kInvalidDimension; }
+
+  // The kernel sees a row-major matrix as its column-major transpose, of which the other triangle
+  // is stored. For a Hermitian matrix the transpose is the conjugate: the elements along the first
+  // instead of the second dimension are conjugated and the two products swap their alphas.
+  auto a_altlayout = (layout == Layout::kRowMajor);
+  auto upper = (triangle == Triangle::kUpper) != a_altlayout;
+  auto conjugate_one = (is_hermitian && a_altlayout);
+  auto conjugate_two = (is_hermitian && !a_altlayout);
+
+  // Tests the vectors and the matrix for validity
+  auto status = TestVectorX(n, x_buffer, x_offset, x_inc, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  if (is_rank_two) {
+    status = TestVectorY(n, y_buffer, y_offset, y_inc, sizeof(T));
+    if (ErrorIn(status)) { return status; }
+  }
+  status = TestMatrixA(n, n, a_buffer, a_offset, a_ld, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+
+  // Small problems on devices sharing their memory with the host are computed by the host backend
+  if (UseHostBackend((n*(n + 1))/2)) {
+    try {
+      HostMapping host(queue_, {x_buffer, y_buffer, a_buffer});
+      HostSyr2(layout, triangle, n, alpha, host.Get<T>(0, x_offset), x_inc,
+               host.Get<T>(1, y_offset), y_inc, host.Get<T>(2, a_offset), a_ld,
+               is_rank_two, is_hermitian);
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kKernelRunError; }
+  }
+
+  // Retrieves the Xsyr2 kernel from the compiled binary
+  try {
+    auto& program = GetProgramFromCache();
+    auto kernel = Kernel(program, "Xsyr2");
+
+    // Sets the kernel arguments
+    kernel.SetArgument(0, static_cast<int>(n));
+    kernel.SetArgument(1, (a_altlayout) ? alpha2 : alpha);
+    kernel.SetArgument(2, (a_altlayout) ? alpha : alpha2);
+    kernel.SetArgument(3, x_buffer());
+    kernel.SetArgument(4, static_cast<int>(x_offset));
+    kernel.SetArgument(5, static_cast<int>(x_inc));
+    kernel.SetArgument(6, y_buffer());
+    kernel.SetArgument(7, static_cast<int>(y_offset));
+    kernel.SetArgument(8, static_cast<int>(y_inc));
+    kernel.SetArgument(9, a_buffer());
+    kernel.SetArgument(10, static_cast<int>(a_offset));
+    kernel.SetArgument(11, static_cast<int>(a_ld));
+    kernel.SetArgument(12, static_cast<int>(upper));
+    kernel.SetArgument(13, static_cast<int>(is_rank_two));
+    kernel.SetArgument(14, static_cast<int>(is_hermitian));
+    kernel.SetArgument(15, static_cast<int>(conjugate_one));
+    kernel.SetArgument(16, static_cast<int>(conjugate_two));
+
+    // Launches the kernel with the tuning parameters of the Xger kernel
+    auto n_ceiled_one = Ceil(n, db_["WGS1"]);
+    auto n_ceiled_two = Ceil(n, db_["WGS2"]*db_["WPT"]);
+    auto global = std::vector<size_t>{n_ceiled_one, n_ceiled_two/db_["WPT"]};
+    auto local = std::vector<size_t>{db_["WGS1"], db_["WGS2"]};
+    status = RunKernel(kernel, global, local);
+    if (ErrorIn(status)) { return status; }
+
+    // Waits for all kernels to finish
+    queue_.Finish();
+
+    // Succesfully finished the computation
+    return StatusCode::kSuccess;
+  } catch (...) { return StatusCode::kInvalidKernel; }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xsyr<float>;
+template class Xsyr<double>;
+template class Xsyr<float2>;
+template class Xsyr<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,53 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xsyr2 class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "internal/routines/level2/xsyr2.h"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xsyr2<T>::Xsyr2(CommandQueue &queue, Event &event):
+    Xsyr<T>(queue, event) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+StatusCode Xsyr2<T>::DoSyr2(const Layout layout, const Triangle triangle,
+                            const size_t n,
+                            const T alpha,
+                            const Buffer &x_buffer, const size_t x_offset, const size_t x_inc,
+                            const Buffer &y_buffer, const size_t y_offset, const size_t y_inc,
+                            const Buffer &a_buffer, const size_t a_offset, const size_t a_ld) {
+  return RankUpdate(layout, triangle, n, alpha, alpha,
+                    x_buffer, x_offset, x_inc,
+                    y_buffer, y_offset, y_inc,
+                    a_buffer, a_offset, a_ld,
+                    true, false);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xsyr2<float>;
+template class Xsyr2<double>;
+template class Xsyr2<float2>;
+template class Xsyr2<double2>;
+
+// =================================================================================================
+} // namespace clblast
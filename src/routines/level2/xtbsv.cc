@@ -0,0 +1,142 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xtbsv class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "internal/routines/level2/xtbsv.h"
+#include "internal/hostblas.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xtbsv<T>::Xtbsv(CommandQueue &queue, Event &event):
+    Xgbmv<T>(queue, event) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+StatusCode Xtbsv<T>::DoTbsv(const Layout layout, const Triangle triangle,
+                            const Transpose a_transpose, const Diagonal diagonal,
+                            const size_t n, const size_t k,
+                            const Buffer &a_buffer, const size_t a_offset, const size_t a_ld,
+                            const Buffer &x_buffer, const size_t x_offset, const size_t x_inc) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { return StatusCode::kInvalidDimension; }
+
+  // The kernels read op(A) with the same definitions as in the Xtbmv routine
+  auto a_rotated = (a_transpose != Transpose::kNo) ^ (layout == Layout::kRowMajor);
+  auto a_conjugate = (a_transpose == Transpose::kConjugate);
+  auto is_lower = ((triangle == Triangle::kLower) == (a_transpose == Transpose::kNo));
+  auto unit_diagonal = (diagonal == Diagonal::kUnit);
+  auto kl = static_cast<int>((is_lower) ? k : size_t{0});
+  auto ku = static_cast<int>((is_lower) ? size_t{0} : k);
+
+  // Tests the matrix and the vector for validity
+  auto status = TestMatrixA(k + 1, n, a_buffer, a_offset, a_ld, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorX(n, x_buffer, x_offset, x_inc, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+
+  // Small problems on devices sharing their memory with the host are computed by the host backend
+  if (UseHostBackend(n*(k + 1))) {
+    try {
+      HostMapping host(queue_, {a_buffer, x_buffer});
+      HostTbsv(layout, triangle, a_transpose, diagonal, n, k, host.Get<T>(0, a_offset), a_ld,
+               host.Get<T>(1, x_offset), x_inc);
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kKernelRunError; }
+  }
+
+  // The diagonal blocks are as large as the work-group of the Xgbmv kernel
+  auto block_size = db_["WGS"];
+  auto num_blocks = CeilDiv(n, block_size);
+
+  // Retrieves the Xtbsv kernel from the compiled binary
+  try {
+    auto& program = GetProgramFromCache();
+    auto kernel = Kernel(program, "Xtbsv");
+
+    // Sets the arguments which are the same for all blocks
+    kernel.SetArgument(0, static_cast<int>(n));
+    kernel.SetArgument(2, kl);
+    kernel.SetArgument(3, ku);
+    kernel.SetArgument(4, a_buffer());
+    kernel.SetArgument(5, static_cast<int>(a_offset));
+    kernel.SetArgument(6, static_cast<int>(a_ld));
+    kernel.SetArgument(7, x_buffer());
+    kernel.SetArgument(8, static_cast<int>(x_offset));
+    kernel.SetArgument(9, static_cast<int>(x_inc));
+    kernel.SetArgument(10, static_cast<int>(a_rotated));
+    kernel.SetArgument(11, static_cast<int>(a_conjugate));
+    kernel.SetArgument(12, static_cast<int>(is_lower));
+    kernel.SetArgument(13, static_cast<int>(unit_diagonal));
+
+    // Loops over the diagonal blocks: forwards for a lower and backwards for an upper triangle. As
+    // in the Xtrsv routine, the kernels are chained on the queue without waiting in between, each
+    // waiting for the event of the previous one instead.
+    auto previous = std::vector<Event>();
+    for (auto step = size_t{0}; step < num_blocks; ++step) {
+      auto block = (is_lower) ? step : num_blocks - 1 - step;
+      auto i0 = block*block_size;
+      auto ib = std::min(block_size, n - i0);
+
+      // Solves for the current block of X with a single work-group
+      kernel.SetArgument(1, static_cast<int>(i0));
+      auto global = std::vector<size_t>{block_size};
+      auto local = std::vector<size_t>{block_size};
+      status = RunKernel(kernel, global, local, false, previous);
+      if (ErrorIn(status)) { return status; }
+      previous = {event_};
+
+      // Only the 'k' rows following (lower) or preceding (upper) the solved block are within its
+      // band. These are updated using the Xgbmv kernel: "x[rows] := x[rows] - op(A)[rows, block] *
+      // x[block]". The off-diagonal block of op(A) is itself a band, shifted by "r0 - i0".
+      auto r0 = (is_lower) ? i0 + ib : ((i0 > k) ? i0 - k : size_t{0});
+      auto rows = (is_lower) ? std::min(n, i0 + ib + k) - std::min(n, r0) : i0 - r0;
+      if (rows == 0) { continue; }
+      auto shift = static_cast<int>(r0) - static_cast<int>(i0);
+      auto block_a_offset = a_offset + ((a_rotated) ? r0*a_ld : i0*a_ld);
+      status = BandMatVec(rows, ib, kl - shift, ku + shift,
+                          static_cast<T>(-1.0), static_cast<T>(1.0),
+                          a_buffer, block_a_offset, a_ld,
+                          x_buffer, x_offset + i0*x_inc, x_inc,
+                          x_buffer, x_offset + r0*x_inc, x_inc,
+                          a_rotated, a_conjugate, false, false, false, false, previous);
+      if (ErrorIn(status)) { return status; }
+      previous = {event_};
+    }
+
+    // Waits for all kernels to finish
+    queue_.Finish();
+
+    // Succesfully finished the computation
+    return StatusCode::kSuccess;
+  } catch (...) { return StatusCode::kInvalidKernel; }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xtbsv<float>;
+template class Xtbsv<double>;
+template class Xtbsv<float2>;
+template class Xtbsv<double2>;
+
+// =================================================================================================
+} // namespace clblast
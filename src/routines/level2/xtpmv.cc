@@ -0,0 +1,93 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xtpmv class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "internal/routines/level2/xtpmv.h"
+#include "internal/hostblas.h"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xtpmv<T>::Xtpmv(CommandQueue &queue, Event &event):
+    Xspmv<T>(queue, event) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+StatusCode Xtpmv<T>::DoTpmv(const Layout layout, const Triangle triangle,
+                            const Transpose a_transpose, const Diagonal diagonal,
+                            const size_t n,
+                            const Buffer &ap_buffer, const size_t ap_offset,
+                            const Buffer &x_buffer, const size_t x_offset, const size_t x_inc) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { return StatusCode::kInvalidDimension; }
+
+  // The kernel reads op(A) with the same definitions of the rotated and conjugated matrix as in the
+  // Xtrmv routine: the packed format holds either the columns or the rows of op(A)
+  auto a_rotated = (a_transpose != Transpose::kNo) ^ (layout == Layout::kRowMajor);
+  auto a_conjugate = (a_transpose == Transpose::kConjugate);
+  auto is_lower = ((triangle == Triangle::kLower) == (a_transpose == Transpose::kNo));
+  auto unit_diagonal = (diagonal == Diagonal::kUnit);
+
+  // Tests the matrix and the vector for validity
+  auto status = TestMatrixAP(n, ap_buffer, ap_offset, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorX(n, x_buffer, x_offset, x_inc, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+
+  // Small problems on devices sharing their memory with the host are computed by the host backend
+  if (UseHostBackend((n*(n + 1))/2)) {
+    try {
+      HostMapping host(queue_, {ap_buffer, x_buffer});
+      HostTpmv(layout, triangle, a_transpose, diagonal, n, host.Get<T>(0, ap_offset),
+               host.Get<T>(1, x_offset), x_inc);
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kKernelRunError; }
+  }
+
+  // The vector X is both input and output: as in the Xtrmv routine, the kernel reads from a copy of
+  // the strided range of X
+  auto x_size = (n - 1)*x_inc + 1;
+
+  // Temporary buffer for the copy of X: if memory allocation fails, throw an exception
+  try {
+    auto temp_buffer = Buffer(context_, CL_MEM_READ_WRITE, x_size*sizeof(T));
+    auto copy_status = x_buffer.CopyToRect<T>(queue_, x_size, 1, x_offset, x_size,
+                                              temp_buffer, 0, x_size);
+    if (copy_status != CL_SUCCESS) { return StatusCode::kTempBufferAllocFailure; }
+
+    // Runs the kernel, computing "x := op(A) * x_copy + 0 * x"
+    return PackedMatVec(n, n, n, 0, 0, static_cast<T>(1.0), static_cast<T>(0.0),
+                        ap_buffer, ap_offset,
+                        temp_buffer, 0, x_inc,
+                        x_buffer, x_offset, x_inc,
+                        a_rotated, a_conjugate, is_lower, false, false, unit_diagonal);
+  } catch (...) { return StatusCode::kTempBufferAllocFailure; }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xtpmv<float>;
+template class Xtpmv<double>;
+template class Xtpmv<float2>;
+template class Xtpmv<double2>;
+
+// =================================================================================================
+} // namespace clblast
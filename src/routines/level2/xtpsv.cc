@@ -0,0 +1,135 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xtpsv class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "internal/routines/level2/xtpsv.h"
+#include "internal/hostblas.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xtpsv<T>::Xtpsv(CommandQueue &queue, Event &event):
+    Xspmv<T>(queue, event) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+StatusCode Xtpsv<T>::DoTpsv(const Layout layout, const Triangle triangle,
+                            const Transpose a_transpose, const Diagonal diagonal,
+                            const size_t n,
+                            const Buffer &ap_buffer, const size_t ap_offset,
+                            const Buffer &x_buffer, const size_t x_offset, const size_t x_inc) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { return StatusCode::kInvalidDimension; }
+
+  // The kernels read op(A) with the same definitions as in the Xtpmv routine
+  auto a_rotated = (a_transpose != Transpose::kNo) ^ (layout == Layout::kRowMajor);
+  auto a_conjugate = (a_transpose == Transpose::kConjugate);
+  auto is_lower = ((triangle == Triangle::kLower) == (a_transpose == Transpose::kNo));
+  auto unit_diagonal = (diagonal == Diagonal::kUnit);
+
+  // Tests the matrix and the vector for validity
+  auto status = TestMatrixAP(n, ap_buffer, ap_offset, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorX(n, x_buffer, x_offset, x_inc, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+
+  // Small problems on devices sharing their memory with the host are computed by the host backend
+  if (UseHostBackend((n*(n + 1))/2)) {
+    try {
+      HostMapping host(queue_, {ap_buffer, x_buffer});
+      HostTpsv(layout, triangle, a_transpose, diagonal, n, host.Get<T>(0, ap_offset),
+               host.Get<T>(1, x_offset), x_inc);
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kKernelRunError; }
+  }
+
+  // The diagonal blocks are as large as the work-group of the Xspmv kernel
+  auto block_size = db_["WGS"];
+  auto num_blocks = CeilDiv(n, block_size);
+
+  // Retrieves the Xtpsv kernel from the compiled binary
+  try {
+    auto& program = GetProgramFromCache();
+    auto kernel = Kernel(program, "Xtpsv");
+
+    // Sets the arguments which are the same for all blocks
+    kernel.SetArgument(0, static_cast<int>(n));
+    kernel.SetArgument(2, ap_buffer());
+    kernel.SetArgument(3, static_cast<int>(ap_offset));
+    kernel.SetArgument(4, x_buffer());
+    kernel.SetArgument(5, static_cast<int>(x_offset));
+    kernel.SetArgument(6, static_cast<int>(x_inc));
+    kernel.SetArgument(7, static_cast<int>(a_rotated));
+    kernel.SetArgument(8, static_cast<int>(a_conjugate));
+    kernel.SetArgument(9, static_cast<int>(is_lower));
+    kernel.SetArgument(10, static_cast<int>(unit_diagonal));
+
+    // Loops over the diagonal blocks: forwards for a lower and backwards for an upper triangle. As
+    // in the Xtrsv routine, the kernels are chained on the queue without waiting in between, each
+    // waiting for the event of the previous one instead.
+    auto previous = std::vector<Event>();
+    for (auto step = size_t{0}; step < num_blocks; ++step) {
+      auto block = (is_lower) ? step : num_blocks - 1 - step;
+      auto i0 = block*block_size;
+      auto ib = std::min(block_size, n - i0);
+
+      // Solves for the current block of X with a single work-group
+      kernel.SetArgument(1, static_cast<int>(i0));
+      auto global = std::vector<size_t>{block_size};
+      auto local = std::vector<size_t>{block_size};
+      status = RunKernel(kernel, global, local, false, previous);
+      if (ErrorIn(status)) { return status; }
+      previous = {event_};
+
+      // Updates all remaining rows, following (lower) or preceding (upper) the solved block, using
+      // the Xspmv kernel: "x[rows] := x[rows] - op(A)[rows, block] * x[block]"
+      auto r0 = (is_lower) ? i0 + ib : size_t{0};
+      auto rows = (is_lower) ? n - r0 : i0;
+      if (rows == 0) { continue; }
+      status = PackedMatVec(rows, ib, n, r0, i0,
+                            static_cast<T>(-1.0), static_cast<T>(1.0),
+                            ap_buffer, ap_offset,
+                            x_buffer, x_offset + i0*x_inc, x_inc,
+                            x_buffer, x_offset + r0*x_inc, x_inc,
+                            a_rotated, a_conjugate, is_lower, false, false, false, false,
+                            previous);
+      if (ErrorIn(status)) { return status; }
+      previous = {event_};
+    }
+
+    // Waits for all kernels to finish
+    queue_.Finish();
+
+    // Succesfully finished the computation
+    return StatusCode::kSuccess;
+  } catch (...) { return StatusCode::kInvalidKernel; }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xtpsv<float>;
+template class Xtpsv<double>;
+template class Xtpsv<float2>;
+template class Xtpsv<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,133 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xtrmv class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "internal/routines/level2/xtrmv.h"
+#include "internal/hostblas.h"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Specific implementations to get the memory-type based on a template argument
+template <> const Precision Xtrmv<float>::precision_ = Precision::kSingle;
+template <> const Precision Xtrmv<double>::precision_ = Precision::kDouble;
+template <> const Precision Xtrmv<float2>::precision_ = Precision::kComplexSingle;
+template <> const Precision Xtrmv<double2>::precision_ = Precision::kComplexDouble;
+
+// =================================================================================================
+
+// Constructor: forwards to base class constructor. The kernel shares the parameters of Xgemv.
+template <typename T>
+Xtrmv<T>::Xtrmv(CommandQueue &queue, Event &event):
+    Routine(queue, event, "TRMV", {"Xgemv"}, precision_) {
+  source_string_ =
+    #include "../../kernels/xgemv.opencl"
+    #include "../../kernels/xtrmv.opencl"
+  ;
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+StatusCode Xtrmv<T>::DoTrmv(const Layout layout, const Triangle triangle,
+                            const Transpose a_transpose, const Diagonal diagonal,
+                            const size_t n,
+                            const Buffer &a_buffer, const size_t a_offset, const size_t a_ld,
+                            const Buffer &x_buffer, const size_t x_offset, const size_t x_inc) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { return StatusCode::kInvalidDimension; }
+
+  // The kernel reads op(A), i.e. A after the optional transpose, with the same definitions of the
+  // rotated and conjugated matrix as the Xgemv kernel ('^' is the XOR operator). The triangle of
+  // op(A) is lower if A is lower and not transposed or if A is upper and transposed.
+  auto a_rotated = (a_transpose != Transpose::kNo) ^ (layout == Layout::kRowMajor);
+  auto a_conjugate = (a_transpose == Transpose::kConjugate);
+  auto is_lower = ((triangle == Triangle::kLower) == (a_transpose == Transpose::kNo));
+  auto unit_diagonal = (diagonal == Diagonal::kUnit);
+
+  // Tests the matrix and the vector for validity
+  auto status = TestMatrixA(n, n, a_buffer, a_offset, a_ld, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorX(n, x_buffer, x_offset, x_inc, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+
+  // Small problems on devices sharing their memory with the host are computed by the host backend
+  if (UseHostBackend((n*n)/2)) {
+    try {
+      HostMapping host(queue_, {a_buffer, x_buffer});
+      HostTrmv(layout, triangle, a_transpose, diagonal, n, host.Get<T>(0, a_offset), a_ld,
+               host.Get<T>(1, x_offset), x_inc);
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kKernelRunError; }
+  }
+
+  // The vector X is both input and output: the kernel reads from a copy of it. Only the strided
+  // range of X is copied, such that the copy has no offset.
+  auto x_size = (n - 1)*x_inc + 1;
+
+  // Temporary buffer for the copy of X: if memory allocation fails, throw an exception
+  try {
+    auto temp_buffer = Buffer(context_, CL_MEM_READ_WRITE, x_size*sizeof(T));
+    auto copy_status = x_buffer.CopyToRect<T>(queue_, x_size, 1, x_offset, x_size,
+                                              temp_buffer, 0, x_size);
+    if (copy_status != CL_SUCCESS) { return StatusCode::kTempBufferAllocFailure; }
+
+    // Retrieves the Xtrmv kernel from the compiled binary
+    try {
+      auto& program = GetProgramFromCache();
+      auto kernel = Kernel(program, "Xtrmv");
+
+      // Sets the kernel arguments
+      kernel.SetArgument(0, static_cast<int>(n));
+      kernel.SetArgument(1, a_buffer());
+      kernel.SetArgument(2, static_cast<int>(a_offset));
+      kernel.SetArgument(3, static_cast<int>(a_ld));
+      kernel.SetArgument(4, temp_buffer());
+      kernel.SetArgument(5, static_cast<int>(x_inc));
+      kernel.SetArgument(6, x_buffer());
+      kernel.SetArgument(7, static_cast<int>(x_offset));
+      kernel.SetArgument(8, static_cast<int>(x_inc));
+      kernel.SetArgument(9, static_cast<int>(a_rotated));
+      kernel.SetArgument(10, static_cast<int>(a_conjugate));
+      kernel.SetArgument(11, static_cast<int>(is_lower));
+      kernel.SetArgument(12, static_cast<int>(unit_diagonal));
+
+      // Launches the kernel: each work-group computes WGS1*WPT1 consecutive elements of X
+      auto num_groups = CeilDiv(n, db_["WGS1"]*db_["WPT1"]);
+      auto global = std::vector<size_t>{num_groups*db_["WGS1"]};
+      auto local = std::vector<size_t>{db_["WGS1"]};
+      status = RunKernel(kernel, global, local);
+      if (ErrorIn(status)) { return status; }
+
+      // Waits for all kernels to finish
+      queue_.Finish();
+
+      // Succesfully finished the computation
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kInvalidKernel; }
+  } catch (...) { return StatusCode::kTempBufferAllocFailure; }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xtrmv<float>;
+template class Xtrmv<double>;
+template class Xtrmv<float2>;
+template class Xtrmv<double2>;
+
+// =================================================================================================
+} // namespace clblast
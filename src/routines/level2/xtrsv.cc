@@ -0,0 +1,168 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xtrsv class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "internal/routines/level2/xtrsv.h"
+#include "internal/hostblas.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Specific implementations to get the memory-type based on a template argument
+template <> const Precision Xtrsv<float>::precision_ = Precision::kSingle;
+template <> const Precision Xtrsv<double>::precision_ = Precision::kDouble;
+template <> const Precision Xtrsv<float2>::precision_ = Precision::kComplexSingle;
+template <> const Precision Xtrsv<double2>::precision_ = Precision::kComplexDouble;
+
+// =================================================================================================
+
+// Constructor: forwards to base class constructor. The kernels share the parameters of Xgemv.
+template <typename T>
+Xtrsv<T>::Xtrsv(CommandQueue &queue, Event &event):
+    Routine(queue, event, "TRSV", {"Xgemv"}, precision_) {
+  source_string_ =
+    #include "../../kernels/xgemv.opencl"
+    #include "../../kernels/xtrmv.opencl"
+  ;
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+StatusCode Xtrsv<T>::DoTrsv(const Layout layout, const Triangle triangle,
+                            const Transpose a_transpose, const Diagonal diagonal,
+                            const size_t n,
+                            const Buffer &a_buffer, const size_t a_offset, const size_t a_ld,
+                            const Buffer &x_buffer, const size_t x_offset, const size_t x_inc) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { return StatusCode::kInvalidDimension; }
+
+  // The kernels read op(A), i.e. A after the optional transpose, with the same definitions of the
+  // rotated and conjugated matrix as the Xgemv kernel ('^' is the XOR operator). The triangle of
+  // op(A) is lower if A is lower and not transposed or if A is upper and transposed.
+  auto a_rotated = (a_transpose != Transpose::kNo) ^ (layout == Layout::kRowMajor);
+  auto a_conjugate = (a_transpose == Transpose::kConjugate);
+  auto is_lower = ((triangle == Triangle::kLower) == (a_transpose == Transpose::kNo));
+  auto unit_diagonal = (diagonal == Diagonal::kUnit);
+
+  // Tests the matrix and the vector for validity
+  auto status = TestMatrixA(n, n, a_buffer, a_offset, a_ld, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorX(n, x_buffer, x_offset, x_inc, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+
+  // Small problems on devices sharing their memory with the host are computed by the host backend
+  if (UseHostBackend((n*n)/2)) {
+    try {
+      HostMapping host(queue_, {a_buffer, x_buffer});
+      HostTrsv(layout, triangle, a_transpose, diagonal, n, host.Get<T>(0, a_offset), a_ld,
+               host.Get<T>(1, x_offset), x_inc);
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kKernelRunError; }
+  }
+
+  // Computes the offset of an element (row, column) of op(A)
+  auto a_op_offset = [&](const size_t row, const size_t col) {
+    return a_offset + ((a_rotated) ? row*a_ld + col : col*a_ld + row);
+  };
+
+  // The diagonal blocks are as large as the work-group of the Xgemv kernel
+  auto block_size = db_["WGS1"];
+  auto num_blocks = CeilDiv(n, block_size);
+
+  // Retrieves the Xtrsv and Xgemv kernels from the compiled binary
+  try {
+    auto& program = GetProgramFromCache();
+    auto solve_kernel = Kernel(program, "Xtrsv");
+    auto update_kernel = Kernel(program, "Xgemv");
+
+    // Sets the arguments which are the same for all blocks
+    solve_kernel.SetArgument(0, static_cast<int>(n));
+    solve_kernel.SetArgument(2, a_buffer());
+    solve_kernel.SetArgument(3, static_cast<int>(a_offset));
+    solve_kernel.SetArgument(4, static_cast<int>(a_ld));
+    solve_kernel.SetArgument(5, x_buffer());
+    solve_kernel.SetArgument(6, static_cast<int>(x_offset));
+    solve_kernel.SetArgument(7, static_cast<int>(x_inc));
+    solve_kernel.SetArgument(8, static_cast<int>(a_rotated));
+    solve_kernel.SetArgument(9, static_cast<int>(a_conjugate));
+    solve_kernel.SetArgument(10, static_cast<int>(is_lower));
+    solve_kernel.SetArgument(11, static_cast<int>(unit_diagonal));
+    update_kernel.SetArgument(2, static_cast<T>(-1.0));
+    update_kernel.SetArgument(3, static_cast<T>(1.0));
+    update_kernel.SetArgument(4, static_cast<int>(a_rotated));
+    update_kernel.SetArgument(5, a_buffer());
+    update_kernel.SetArgument(7, static_cast<int>(a_ld));
+    update_kernel.SetArgument(8, x_buffer());
+    update_kernel.SetArgument(10, static_cast<int>(x_inc));
+    update_kernel.SetArgument(11, x_buffer());
+    update_kernel.SetArgument(13, static_cast<int>(x_inc));
+    update_kernel.SetArgument(14, static_cast<int>(a_conjugate));
+
+    // Loops over the diagonal blocks: forwards for a lower and backwards for an upper triangle. The
+    // kernels are chained on the queue without waiting for their completion in between. Instead,
+    // each kernel waits for the event of the previous one, as the queue might be out-of-order.
+    auto previous = std::vector<Event>();
+    for (auto step = size_t{0}; step < num_blocks; ++step) {
+      auto block = (is_lower) ? step : num_blocks - 1 - step;
+      auto i0 = block*block_size;
+      auto ib = std::min(block_size, n - i0);
+
+      // Solves for the current block of X with a single work-group
+      solve_kernel.SetArgument(1, static_cast<int>(i0));
+      auto solve_global = std::vector<size_t>{block_size};
+      auto solve_local = std::vector<size_t>{block_size};
+      status = RunKernel(solve_kernel, solve_global, solve_local, false, previous);
+      if (ErrorIn(status)) { return status; }
+      previous = {event_};
+
+      // Subtracts the contribution of the solved block from the blocks which are not yet solved:
+      // "x[rows] := x[rows] - op(A)[rows, block] * x[block]" using the Xgemv kernel
+      auto r0 = (is_lower) ? i0 + ib : size_t{0};
+      auto rows = (is_lower) ? n - r0 : i0;
+      if (rows == 0) { continue; }
+      update_kernel.SetArgument(0, static_cast<int>(rows));
+      update_kernel.SetArgument(1, static_cast<int>(ib));
+      update_kernel.SetArgument(6, static_cast<int>(a_op_offset(r0, i0)));
+      update_kernel.SetArgument(9, static_cast<int>(x_offset + i0*x_inc));
+      update_kernel.SetArgument(12, static_cast<int>(x_offset + r0*x_inc));
+      auto rows_ceiled = Ceil(rows, db_["WGS1"]*db_["WPT1"]);
+      auto update_global = std::vector<size_t>{rows_ceiled / db_["WPT1"]};
+      auto update_local = std::vector<size_t>{db_["WGS1"]};
+      status = RunKernel(update_kernel, update_global, update_local, false, previous);
+      if (ErrorIn(status)) { return status; }
+      previous = {event_};
+    }
+
+    // Waits for all kernels to finish
+    queue_.Finish();
+
+    // Succesfully finished the computation
+    return StatusCode::kSuccess;
+  } catch (...) { return StatusCode::kInvalidKernel; }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xtrsv<float>;
+template class Xtrsv<double>;
+template class Xtrsv<float2>;
+template class Xtrsv<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -12,6 +12,7 @@
 // =================================================================================================
 
 #include "internal/routines/level3/xgemm.h"
+#include "internal/hostblas.h"
 
 #include <string>
 #include <vector>
@@ -24,14 +25,46 @@ template <> const Precision Xgemm<float>::precision_ = Precision::kSingle;
 template <> const Precision Xgemm<double>::precision_ = Precision::kDouble;
 template <> const Precision Xgemm<float2>::precision_ = Precision::kComplexSingle;
 template <> const Precision Xgemm<double2>::precision_ = Precision::kComplexDouble;
+template <> const Precision Xgemm<half>::precision_ = Precision::kHalf;
+
+// =================================================================================================
+
+// Whether or not an epilogue does anything
+bool EpilogueIsUsed(const Epilogue &epilogue) {
+  return epilogue.scale != EpilogueVector::kNone || epilogue.bias != EpilogueVector::kNone ||
+         epilogue.activation != Activation::kNone || epilogue.clamp;
+}
+
+// Generates the defines selecting the variant of the epilogue in the kernel (see xgemm.opencl)
+std::string EpilogueDefines(const Epilogue &epilogue) {
+  if (!EpilogueIsUsed(epilogue)) { return ""; }
+  return "#define EPILOGUE 1\n"
+         "#define EPILOGUE_SCALE "+ToString(static_cast<int>(epilogue.scale))+"\n"
+         "#define EPILOGUE_BIAS "+ToString(static_cast<int>(epilogue.bias))+"\n"
+         "#define EPILOGUE_ACTIVATION "+ToString(static_cast<int>(epilogue.activation))+"\n"
+         "#define EPILOGUE_CLAMP "+ToString(static_cast<int>(epilogue.clamp))+"\n";
+}
+
+// The name of the routine, which also identifies the compiled program in the cache. Therefore, each
+// variant of the epilogue has its own name.
+std::string GemmRoutineName(const Epilogue &epilogue) {
+  if (!EpilogueIsUsed(epilogue)) { return "GEMM"; }
+  return "GEMMEPILOGUE_"+ToString(static_cast<int>(epilogue.scale))+
+                         ToString(static_cast<int>(epilogue.bias))+
+                         ToString(static_cast<int>(epilogue.activation))+
+                         ToString(static_cast<int>(epilogue.clamp));
+}
 
 // =================================================================================================
 
 // Constructor: forwards to base class constructor
 template <typename T>
-Xgemm<T>::Xgemm(CommandQueue &queue, Event &event):
-    Routine(queue, event, "GEMM", {"Copy","Pad","Transpose","PadTranspose","Xgemm"}, precision_) {
-  source_string_ =
+Xgemm<T>::Xgemm(CommandQueue &queue, Event &event, const Epilogue &epilogue):
+    Routine(queue, event, GemmRoutineName(epilogue),
+            {"Copy","Pad","Transpose","PadTranspose","Xgemm"}, precision_),
+    epilogue_(epilogue),
+    use_epilogue_(EpilogueIsUsed(epilogue)) {
+  source_string_ = EpilogueDefines(epilogue) +
     #include "../../kernels/copy.opencl"
     #include "../../kernels/pad.opencl"
     #include "../../kernels/transpose.opencl"
@@ -51,7 +84,8 @@ StatusCode Xgemm<T>::DoGemm(const Layout layout,
                             const Buffer &a_buffer, const size_t a_offset, const size_t a_ld,
                             const Buffer &b_buffer, const size_t b_offset, const size_t b_ld,
                             const T beta,
-                            const Buffer &c_buffer, const size_t c_offset, const size_t c_ld) {
+                            const Buffer &c_buffer, const size_t c_offset, const size_t c_ld,
+                            const std::string &a_pad_kernel, const std::string &b_pad_kernel) {
 
   // Makes sure all dimensions are larger than zero
   if ((m == 0) || (n == 0) || (k == 0)) { return StatusCode::kInvalidDimension; }
@@ -97,6 +131,26 @@ StatusCode Xgemm<T>::DoGemm(const Layout layout,
   status = TestMatrixC(c_one, c_two, c_buffer, c_offset, c_ld, sizeof(T));
   if (ErrorIn(status)) { return status; }
 
+  // Tests the vectors of the epilogue (if used) for validity
+  status = TestEpilogueVector(epilogue_.scale, epilogue_.scale_buffer, epilogue_.scale_offset,
+                              m, n);
+  if (ErrorIn(status)) { return status; }
+  status = TestEpilogueVector(epilogue_.bias, epilogue_.bias_buffer, epilogue_.bias_offset,
+                              m, n);
+  if (ErrorIn(status)) { return status; }
+
+  // Small problems on devices sharing their memory with the host are computed by the host backend.
+  // The epilogue and matrices stored as a triangle are only supported by the kernels.
+  if (!use_epilogue_ && a_pad_kernel.empty() && b_pad_kernel.empty() && UseHostBackend(m*n*k)) {
+    try {
+      HostMapping host(queue_, {a_buffer, b_buffer, c_buffer});
+      HostGemm(layout, a_transpose, b_transpose, m, n, k, alpha,
+               host.Get<T>(0, a_offset), a_ld, host.Get<T>(1, b_offset), b_ld, beta,
+               host.Get<T>(2, c_offset), c_ld);
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kKernelRunError; }
+  }
+
   // Calculates the ceiled versions of m, n, and k
   auto m_ceiled = Ceil(m, db_["MWG"]);
   auto n_ceiled = Ceil(n, db_["NWG"]);
@@ -108,11 +162,12 @@ StatusCode Xgemm<T>::DoGemm(const Layout layout,
     // Loads the program from the database
     auto& program = GetProgramFromCache();
 
-    // Determines whether or not temporary matrices are needed
+    // Determines whether or not temporary matrices are needed. A matrix stored as a triangle
+    // always needs to be expanded.
     auto a_no_temp = a_one == m_ceiled && a_two == k_ceiled && a_ld == m_ceiled && a_offset == 0 &&
-                     a_do_transpose == false && a_conjugate == false;
+                     a_do_transpose == false && a_conjugate == false && a_pad_kernel.empty();
     auto b_no_temp = b_one == n_ceiled && b_two == k_ceiled && b_ld == n_ceiled && b_offset == 0 &&
-                     b_do_transpose == false && b_conjugate == false;
+                     b_do_transpose == false && b_conjugate == false && b_pad_kernel.empty();
     auto c_no_temp = c_one == m_ceiled && c_two == n_ceiled && c_ld == m_ceiled && c_offset == 0 &&
                      c_do_transpose == false;
 
@@ -124,20 +179,32 @@ StatusCode Xgemm<T>::DoGemm(const Layout layout,
     // Runs the pre-processing kernel for matrix A. This transposes the matrix, but also pads zeros
     // to fill it up until it reaches a certain multiple of size (kernel parameter dependent). In
     // case nothing has to be done, these kernels can be skipped.
-    if (!a_no_temp) {
+    if (!a_no_temp && a_pad_kernel.empty()) {
       status = PadCopyTransposeMatrix(a_one, a_two, a_ld, a_offset, a_buffer,
                                       m_ceiled, k_ceiled, m_ceiled, 0, a_temp,
                                       program, true, a_do_transpose, a_conjugate);
       if (ErrorIn(status)) { return status; }
     }
+    else if (!a_no_temp) {
+      status = PadTriangleToMatrix(a_pad_kernel, a_one, a_ld, a_offset, a_buffer,
+                                   m_ceiled, k_ceiled, a_temp,
+                                   program, a_do_transpose, a_conjugate);
+      if (ErrorIn(status)) { return status; }
+    }
 
     // As above, but now for matrix B
-    if (!b_no_temp) {
+    if (!b_no_temp && b_pad_kernel.empty()) {
       status = PadCopyTransposeMatrix(b_one, b_two, b_ld, b_offset, b_buffer,
                                       n_ceiled, k_ceiled, n_ceiled, 0, b_temp,
                                       program, true, b_do_transpose, b_conjugate);
       if (ErrorIn(status)) { return status; }
     }
+    else if (!b_no_temp) {
+      status = PadTriangleToMatrix(b_pad_kernel, b_one, b_ld, b_offset, b_buffer,
+                                   n_ceiled, k_ceiled, b_temp,
+                                   program, b_do_transpose, b_conjugate);
+      if (ErrorIn(status)) { return status; }
+    }
 
     // As above, but now for matrix C. This is only necessary if C is used both as input and output.
     if (!c_no_temp && beta != static_cast<T>(0)) {
@@ -161,6 +228,20 @@ StatusCode Xgemm<T>::DoGemm(const Layout layout,
       kernel.SetArgument(6, b_temp());
       kernel.SetArgument(7, c_temp());
 
+      // Sets the additional arguments of the epilogue. Unused vectors are replaced by matrix C.
+      if (use_epilogue_) {
+        auto use_scale = (epilogue_.scale != EpilogueVector::kNone);
+        auto use_bias = (epilogue_.bias != EpilogueVector::kNone);
+        kernel.SetArgument(8, (use_scale) ? epilogue_.scale_buffer : c_temp());
+        kernel.SetArgument(9, static_cast<int>(epilogue_.scale_offset));
+        kernel.SetArgument(10, (use_bias) ? epilogue_.bias_buffer : c_temp());
+        kernel.SetArgument(11, static_cast<int>(epilogue_.bias_offset));
+        kernel.SetArgument(12, static_cast<int>(m));
+        kernel.SetArgument(13, static_cast<int>(n));
+        kernel.SetArgument(14, FromDouble<T>(epilogue_.clamp_min));
+        kernel.SetArgument(15, FromDouble<T>(epilogue_.clamp_max));
+      }
+
       // Computes the global and local thread sizes
       auto global = std::vector<size_t>{
         (m_ceiled * db_["MDIMC"]) / db_["MWG"],
@@ -188,11 +269,69 @@ StatusCode Xgemm<T>::DoGemm(const Layout layout,
 
 // =================================================================================================
 
+// Expands a symmetric or hermitian matrix stored as a triangle into a padded matrix. The square
+// source matrix is mirrored by the kernel and written into the destination matrix of which the
+// leading dimension equals its first dimension. This uses the padding kernel's parameters.
+template <typename T>
+StatusCode Xgemm<T>::PadTriangleToMatrix(const std::string &kernel_name, const size_t src_dim,
+                                         const size_t src_ld, const size_t src_offset,
+                                         const Buffer &src,
+                                         const size_t dest_one, const size_t dest_two,
+                                         const Buffer &dest, const Program &program,
+                                         const bool do_transpose, const bool do_conjugate) {
+  try {
+    auto kernel = Kernel(program, kernel_name);
+
+    // Sets the kernel arguments
+    kernel.SetArgument(0, static_cast<int>(src_dim));
+    kernel.SetArgument(1, static_cast<int>(src_ld));
+    kernel.SetArgument(2, static_cast<int>(src_offset));
+    kernel.SetArgument(3, src());
+    kernel.SetArgument(4, static_cast<int>(dest_one));
+    kernel.SetArgument(5, static_cast<int>(dest_two));
+    kernel.SetArgument(6, static_cast<int>(dest_one));
+    kernel.SetArgument(7, static_cast<int>(0));
+    kernel.SetArgument(8, dest());
+    kernel.SetArgument(9, static_cast<int>(do_transpose));
+    kernel.SetArgument(10, static_cast<int>(do_conjugate));
+
+    // Launches the kernel and returns the error code (if any)
+    auto global = std::vector<size_t>{
+      Ceil(CeilDiv(dest_one, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
+      Ceil(CeilDiv(dest_two, db_["PAD_WPTY"]), db_["PAD_DIMY"])
+    };
+    auto local = std::vector<size_t>{db_["PAD_DIMX"], db_["PAD_DIMY"]};
+    return RunKernel(kernel, global, local);
+  } catch (...) { return StatusCode::kInvalidKernel; }
+}
+
+// =================================================================================================
+
+// Tests a vector of the epilogue for validity: checks for a valid OpenCL buffer and for a
+// sufficient buffer size. An unused vector is always valid.
+template <typename T>
+StatusCode Xgemm<T>::TestEpilogueVector(const EpilogueVector type, const cl_mem buffer,
+                                        const size_t offset,
+                                        const size_t m, const size_t n) const {
+  if (type == EpilogueVector::kNone) { return StatusCode::kSuccess; }
+  if (buffer == nullptr) { return StatusCode::kInvalidEpilogue; }
+  auto size = (type == EpilogueVector::kPerRow) ? m : n;
+  try {
+    auto required_size = (size + offset)*sizeof(T);
+    auto buffer_size = Buffer(buffer).GetSize();
+    if (buffer_size < required_size) { return StatusCode::kInvalidEpilogue; }
+  } catch (...) { return StatusCode::kInvalidEpilogue; }
+  return StatusCode::kSuccess;
+}
+
+// =================================================================================================
+
 // Compiles the templated class
 template class Xgemm<float>;
 template class Xgemm<double>;
 template class Xgemm<float2>;
 template class Xgemm<double2>;
+template class Xgemm<half>;
 
 // =================================================================================================
 } // namespace clblast
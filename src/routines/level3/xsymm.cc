@@ -12,6 +12,7 @@
 // =================================================================================================
 
 #include "internal/routines/level3/xsymm.h"
+#include "internal/hostblas.h"
 
 #include <string>
 #include <vector>
@@ -48,76 +49,66 @@ StatusCode Xsymm<T>::DoSymm(const Layout layout, const Side side, const Triangle
   auto status = TestMatrixA(k, k, a_buffer, a_offset, a_ld, sizeof(T));
   if (ErrorIn(status)) { return status; }
 
+  // Small problems on devices sharing their memory with the host are computed by the host backend
+  if (UseHostBackend(m*n*k)) {
+    auto bc_one = (layout == Layout::kRowMajor) ? n : m;
+    auto bc_two = (layout == Layout::kRowMajor) ? m : n;
+    status = TestMatrixB(bc_one, bc_two, b_buffer, b_offset, b_ld, sizeof(T));
+    if (ErrorIn(status)) { return status; }
+    status = TestMatrixC(bc_one, bc_two, c_buffer, c_offset, c_ld, sizeof(T));
+    if (ErrorIn(status)) { return status; }
+    try {
+      HostMapping host(queue_, {a_buffer, b_buffer, c_buffer});
+      HostSymm(layout, side, triangle, m, n, alpha,
+               host.Get<T>(0, a_offset), a_ld, host.Get<T>(1, b_offset), b_ld, beta,
+               host.Get<T>(2, c_offset), c_ld);
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kKernelRunError; }
+  }
+
   // Determines which kernel to run based on the layout (the Xgemm kernel assumes column-major as
   // default) and on whether we are dealing with an upper or lower triangle of the symmetric matrix
   bool is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
                    (triangle == Triangle::kLower && layout == Layout::kRowMajor));
-  auto kernel_name = (is_upper) ? "SymmUpperToSquared" : "SymmLowerToSquared";
-
-  // Temporary buffer for a copy of the symmetric matrix
-  try {
-    auto temp_symm = Buffer(context_, CL_MEM_READ_WRITE, k*k*sizeof(T));
-
-    // Creates a general matrix from the symmetric matrix to be able to run the regular Xgemm
-    // routine afterwards
-    try {
-      auto& program = GetProgramFromCache();
-      auto kernel = Kernel(program, kernel_name);
-
-      // Sets the arguments for the symmetric-to-squared kernel
-      kernel.SetArgument(0, static_cast<int>(k));
-      kernel.SetArgument(1, static_cast<int>(a_ld));
-      kernel.SetArgument(2, static_cast<int>(a_offset));
-      kernel.SetArgument(3, a_buffer());
-      kernel.SetArgument(4, static_cast<int>(k));
-      kernel.SetArgument(5, static_cast<int>(k));
-      kernel.SetArgument(6, static_cast<int>(0));
-      kernel.SetArgument(7, temp_symm());
-
-      // Uses the common padding kernel's thread configuration. This is allowed, since the
-      // symmetric-to-squared kernel uses the same parameters.
-      auto global = std::vector<size_t>{Ceil(CeilDiv(k, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
-                                        Ceil(CeilDiv(k, db_["PAD_WPTY"]), db_["PAD_DIMY"])};
-      auto local = std::vector<size_t>{db_["PAD_DIMX"], db_["PAD_DIMY"]};
-      status = RunKernel(kernel, global, local);
-      if (ErrorIn(status)) { return status; }
-
-      // Runs the regular Xgemm code with either "C := AB+C" or ...
-      if (side == Side::kLeft) {
-        status = DoGemm(layout, Transpose::kNo, Transpose::kNo,
-                        m, n, k,
-                        alpha,
-                        temp_symm, 0, k,
-                        b_buffer, b_offset, b_ld,
-                        beta,
-                        c_buffer, c_offset, c_ld);
-      }
-
-      // ... with "C := BA+C". Note that A and B are now reversed.
-      else {
-        status = DoGemm(layout, Transpose::kNo, Transpose::kNo,
-                        m, n, k,
-                        alpha,
-                        b_buffer, b_offset, b_ld,
-                        temp_symm, 0, k,
-                        beta,
-                        c_buffer, c_offset, c_ld);
-
-        // A and B are now reversed, so also reverse the error codes returned from the Xgemm routine
-        switch(status) {
-          case StatusCode::kInvalidMatrixA:      status = StatusCode::kInvalidMatrixB; break;
-          case StatusCode::kInvalidMatrixB:      status = StatusCode::kInvalidMatrixA; break;
-          case StatusCode::kInvalidLeadDimA:     status = StatusCode::kInvalidLeadDimB; break;
-          case StatusCode::kInvalidLeadDimB:     status = StatusCode::kInvalidLeadDimA; break;
-          case StatusCode::kInsufficientMemoryA: status = StatusCode::kInsufficientMemoryB; break;
-          case StatusCode::kInsufficientMemoryB: status = StatusCode::kInsufficientMemoryA; break;
-        }
-      }
-
-      // Return the status of the Xgemm routine
-      return status;
-    } catch (...) { return StatusCode::kInvalidKernel; }
-  } catch (...) { return StatusCode::kTempBufferAllocFailure; }
+  auto kernel_name = (is_upper) ? "SymmUpperToPadded" : "SymmLowerToPadded";
+
+  // Runs the regular Xgemm code with either "C := AB+C" or ... The symmetric matrix is expanded
+  // from its triangle directly into the padded matrix as used by the Xgemm kernel.
+  if (side == Side::kLeft) {
+    status = DoGemm(layout, Transpose::kNo, Transpose::kNo,
+                    m, n, k,
+                    alpha,
+                    a_buffer, a_offset, a_ld,
+                    b_buffer, b_offset, b_ld,
+                    beta,
+                    c_buffer, c_offset, c_ld,
+                    kernel_name, "");
+  }
+
+  // ... with "C := BA+C". Note that A and B are now reversed.
+  else {
+    status = DoGemm(layout, Transpose::kNo, Transpose::kNo,
+                    m, n, k,
+                    alpha,
+                    b_buffer, b_offset, b_ld,
+                    a_buffer, a_offset, a_ld,
+                    beta,
+                    c_buffer, c_offset, c_ld,
+                    "", kernel_name);
+
+    // A and B are now reversed, so also reverse the error codes returned from the Xgemm routine
+    switch(status) {
+      case StatusCode::kInvalidMatrixA:      status = StatusCode::kInvalidMatrixB; break;
+      case StatusCode::kInvalidMatrixB:      status = StatusCode::kInvalidMatrixA; break;
+      case StatusCode::kInvalidLeadDimA:     status = StatusCode::kInvalidLeadDimB; break;
+      case StatusCode::kInvalidLeadDimB:     status = StatusCode::kInvalidLeadDimA; break;
+      case StatusCode::kInsufficientMemoryA: status = StatusCode::kInsufficientMemoryB; break;
+      case StatusCode::kInsufficientMemoryB: status = StatusCode::kInsufficientMemoryA; break;
+    }
+  }
+
+  // Return the status of the Xgemm routine
+  return status;
 }
 
 // =================================================================================================
@@ -12,6 +12,7 @@
 // =================================================================================================
 
 #include "internal/routines/level3/xsyr2k.h"
+#include "internal/hostblas.h"
 
 #include <string>
 #include <vector>
@@ -79,6 +80,17 @@ StatusCode Xsyr2k<T>::DoSyr2k(const Layout layout, const Triangle triangle, cons
   status = TestMatrixC(n, n, c_buffer, c_offset, c_ld, sizeof(T));
   if (ErrorIn(status)) { return status; }
 
+  // Small problems on devices sharing their memory with the host are computed by the host backend
+  if (UseHostBackend(n*n*k)) {
+    try {
+      HostMapping host(queue_, {a_buffer, b_buffer, c_buffer});
+      HostSyr2k(layout, triangle, ab_transpose, n, k, alpha,
+                host.Get<T>(0, a_offset), a_ld, host.Get<T>(1, b_offset), b_ld, beta,
+                host.Get<T>(2, c_offset), c_ld);
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kKernelRunError; }
+  }
+
   // Calculates the ceiled versions of n and k
   auto n_ceiled = Ceil(n, db_["NWG"]);
   auto k_ceiled = Ceil(k, db_["KWG"]);
@@ -101,7 +113,6 @@ StatusCode Xsyr2k<T>::DoSyr2k(const Layout layout, const Triangle triangle, cons
     // Creates the temporary matrices
     auto a_temp = (a_no_temp) ? a_buffer : Buffer(context_, CL_MEM_READ_WRITE, k_ceiled*n_ceiled*sizeof(T));
     auto b_temp = (b_no_temp) ? b_buffer : Buffer(context_, CL_MEM_READ_WRITE, k_ceiled*n_ceiled*sizeof(T));
-    auto c_temp = Buffer(context_, CL_MEM_READ_WRITE, n_ceiled*n_ceiled*sizeof(T));
 
     // Runs the pre-processing kernels. This transposes the matrices A and B, but also pads zeros to
     // to fill it up until it reaches a certain multiple of size (kernel parameter dependent). In
@@ -119,13 +130,6 @@ StatusCode Xsyr2k<T>::DoSyr2k(const Layout layout, const Triangle triangle, cons
       if (ErrorIn(status)) { return status; }
     }
 
-    // Furthermore, also creates a (possibly padded) copy of matrix C, since it is not allowed to
-    // modify the other triangle.
-    status = PadCopyTransposeMatrix(n, n, c_ld, c_offset, c_buffer,
-                                    n_ceiled, n_ceiled, n_ceiled, 0, c_temp,
-                                    program, true, c_rotated, false);
-    if (ErrorIn(status)) { return status; }
-
     // Retrieves the XgemmUpper or XgemmLower kernel from the compiled binary
     try {
       auto kernel = Kernel(program, kernel_name);
@@ -137,35 +141,19 @@ StatusCode Xsyr2k<T>::DoSyr2k(const Layout layout, const Triangle triangle, cons
       kernel.SetArgument(3, beta);
       kernel.SetArgument(4, a_temp());
       kernel.SetArgument(5, b_temp());
-      kernel.SetArgument(6, c_temp());
-
-      // Computes the global and local thread sizes
-      auto global = std::vector<size_t>{
-        (n_ceiled * db_["MDIMC"]) / db_["MWG"],
-        (n_ceiled * db_["NDIMC"]) / db_["NWG"]
-      };
-      auto local = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"]};
-
-      // Launches the kernel
-      status = RunKernel(kernel, global, local);
-      if (ErrorIn(status)) { return status; }
-
-      // Swaps the arguments for matrices A and B, and sets 'beta' to 1
-      auto one = static_cast<T>(1);
-      kernel.SetArgument(3, one);
-      kernel.SetArgument(4, b_temp());
-      kernel.SetArgument(5, a_temp());
-
-      // Runs the kernel again
-      status = RunKernel(kernel, global, local);
-      if (ErrorIn(status)) { return status; }
-
-      // Runs the post-processing kernel
-      auto upper = (triangle == Triangle::kUpper);
-      auto lower = (triangle == Triangle::kLower);
-      status = PadCopyTransposeMatrix(n_ceiled, n_ceiled, n_ceiled, 0, c_temp,
-                                      n, n, c_ld, c_offset, c_buffer,
-                                      program, false, c_rotated, false, upper, lower, false);
+      kernel.SetArgument(6, c_buffer());
+      kernel.SetArgument(7, static_cast<int>(n));
+      kernel.SetArgument(8, static_cast<int>(c_ld));
+      kernel.SetArgument(9, static_cast<int>(c_offset));
+      kernel.SetArgument(10, static_cast<int>(c_rotated));
+
+      // Sets the arguments for the second product, in which matrices A and B are swapped
+      kernel.SetArgument(11, b_temp());
+      kernel.SetArgument(12, a_temp());
+      kernel.SetArgument(13, alpha);
+
+      // Launches the kernel, computing both products in a single pass
+      status = RunTriangularKernel(kernel, n_ceiled, triangle);
       if (ErrorIn(status)) { return status; }
 
       // Successfully finished the computation
@@ -12,6 +12,7 @@
 // =================================================================================================
 
 #include "internal/routines/level3/xsyrk.h"
+#include "internal/hostblas.h"
 
 #include <string>
 #include <vector>
@@ -75,6 +76,16 @@ StatusCode Xsyrk<T>::DoSyrk(const Layout layout, const Triangle triangle, const
   status = TestMatrixC(n, n, c_buffer, c_offset, c_ld, sizeof(T));
   if (ErrorIn(status)) { return status; }
 
+  // Small problems on devices sharing their memory with the host are computed by the host backend
+  if (UseHostBackend(n*n*k/2)) {
+    try {
+      HostMapping host(queue_, {a_buffer, c_buffer});
+      HostSyrk(layout, triangle, a_transpose, n, k, alpha, host.Get<T>(0, a_offset), a_ld,
+               beta, host.Get<T>(1, c_offset), c_ld);
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kKernelRunError; }
+  }
+
   // Calculates the ceiled versions of n and k
   auto n_ceiled = Ceil(n, db_["NWG"]);
   auto k_ceiled = Ceil(k, db_["KWG"]);
@@ -94,7 +105,6 @@ StatusCode Xsyrk<T>::DoSyrk(const Layout layout, const Triangle triangle, const
 
     // Creates the temporary matrices
     auto a_temp = (a_no_temp) ? a_buffer : Buffer(context_, CL_MEM_READ_WRITE, k_ceiled*n_ceiled*sizeof(T));
-    auto c_temp = Buffer(context_, CL_MEM_READ_WRITE, n_ceiled*n_ceiled*sizeof(T));
 
     // Runs the pre-processing kernel for matrix A. This transposes the matrix, but also pads zeros
     // to fill it up until it reaches a certain multiple of size (kernel parameter dependent). In
@@ -106,13 +116,6 @@ StatusCode Xsyrk<T>::DoSyrk(const Layout layout, const Triangle triangle, const
       if (ErrorIn(status)) { return status; }
     }
 
-    // Furthermore, also creates a (possibly padded) copy of matrix C, since it is not allowed to
-    // modify the other triangle.
-    status = PadCopyTransposeMatrix(n, n, c_ld, c_offset, c_buffer,
-                                    n_ceiled, n_ceiled, n_ceiled, 0, c_temp,
-                                    program, true, c_rotated, false);
-    if (ErrorIn(status)) { return status; }
-
     // Retrieves the XgemmUpper or XgemmLower kernel from the compiled binary
     try {
       auto kernel = Kernel(program, kernel_name);
@@ -124,25 +127,14 @@ StatusCode Xsyrk<T>::DoSyrk(const Layout layout, const Triangle triangle, const
       kernel.SetArgument(3, beta);
       kernel.SetArgument(4, a_temp());
       kernel.SetArgument(5, a_temp());
-      kernel.SetArgument(6, c_temp());
-
-      // Computes the global and local thread sizes
-      auto global = std::vector<size_t>{
-        (n_ceiled * db_["MDIMC"]) / db_["MWG"],
-        (n_ceiled * db_["NDIMC"]) / db_["NWG"]
-      };
-      auto local = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"]};
+      kernel.SetArgument(6, c_buffer());
+      kernel.SetArgument(7, static_cast<int>(n));
+      kernel.SetArgument(8, static_cast<int>(c_ld));
+      kernel.SetArgument(9, static_cast<int>(c_offset));
+      kernel.SetArgument(10, static_cast<int>(c_rotated));
 
       // Launches the kernel
-      status = RunKernel(kernel, global, local);
-      if (ErrorIn(status)) { return status; }
-
-      // Runs the post-processing kernel
-      auto upper = (triangle == Triangle::kUpper);
-      auto lower = (triangle == Triangle::kLower);
-      status = PadCopyTransposeMatrix(n_ceiled, n_ceiled, n_ceiled, 0, c_temp,
-                                      n, n, c_ld, c_offset, c_buffer,
-                                      program, false, c_rotated, false, upper, lower, false);
+      status = RunTriangularKernel(kernel, n_ceiled, triangle);
       if (ErrorIn(status)) { return status; }
 
       // Successfully finished the computation
@@ -12,6 +12,7 @@
 // =================================================================================================
 
 #include "internal/routines/level3/xtrmm.h"
+#include "internal/hostblas.h"
 
 #include <string>
 #include <vector>
@@ -19,10 +20,25 @@
 namespace clblast {
 // =================================================================================================
 
+// Specific implementations to get the memory-type based on a template argument
+template <> const Precision Xtrmm<float>::precision_ = Precision::kSingle;
+template <> const Precision Xtrmm<double>::precision_ = Precision::kDouble;
+template <> const Precision Xtrmm<float2>::precision_ = Precision::kComplexSingle;
+template <> const Precision Xtrmm<double2>::precision_ = Precision::kComplexDouble;
+
+// =================================================================================================
+
 // Constructor: forwards to base class constructor
 template <typename T>
 Xtrmm<T>::Xtrmm(CommandQueue &queue, Event &event):
-    Xgemm<T>(queue, event) {
+    Routine(queue, event, "TRMM", {"Copy","Pad","Transpose","PadTranspose","Xgemm"}, precision_) {
+  source_string_ =
+    #include "../../kernels/copy.opencl"
+    #include "../../kernels/pad.opencl"
+    #include "../../kernels/transpose.opencl"
+    #include "../../kernels/padtranspose.opencl"
+    #include "../../kernels/xgemm.opencl"
+  ;
 }
 
 // =================================================================================================
@@ -40,85 +56,147 @@ StatusCode Xtrmm<T>::DoTrmm(const Layout layout, const Side side, const Triangle
   if ((m == 0) || (n == 0)) { return StatusCode::kInvalidDimension; }
 
   // Computes the k dimension. This is based on whether or not matrix is A (on the left)
-  // or B (on the right) in the Xgemm routine.
-  auto k = (side == Side::kLeft) ? m : n;
-
-  // Checks for validity of the triangular A matrix
+  // or B (on the right) in the Xgemm kernel.
+  auto left = (side == Side::kLeft);
+  auto k = (left) ? m : n;
+
+  // Checks for validity of the triangular A matrix and of the B matrix, which is both input (of
+  // size k*n or m*k) and output (of size m*n). These two sizes are the same.
+  auto b_rotated = (layout == Layout::kRowMajor);
+  auto b_one = (b_rotated) ? n : m;
+  auto b_two = (b_rotated) ? m : n;
   auto status = TestMatrixA(k, k, a_buffer, a_offset, a_ld, sizeof(T));
   if (ErrorIn(status)) { return status; }
+  status = TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld, sizeof(T));
+  if (ErrorIn(status)) { return status; }
 
-  // Determines which kernel to run based on the layout (the Xgemm kernel assumes column-major as
+  // Small problems on devices sharing their memory with the host are computed by the host backend
+  if (UseHostBackend(m*n*k)) {
+    try {
+      HostMapping host(queue_, {a_buffer, b_buffer});
+      HostTrmm(layout, side, triangle, a_transpose, diagonal, m, n, alpha,
+               host.Get<T>(0, a_offset), a_ld, host.Get<T>(1, b_offset), b_ld);
+      return StatusCode::kSuccess;
+    } catch (...) { return StatusCode::kKernelRunError; }
+  }
+
+  // Determines which padding kernel to run based on the layout (the kernels assume column-major as
   // default) and on whether we are dealing with an upper or lower triangle of the triangular matrix
   bool is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
                    (triangle == Triangle::kLower && layout == Layout::kRowMajor));
-  auto kernel_name = (is_upper) ? "TrmmUpperToSquared" : "TrmmLowerToSquared";
+  auto kernel_name = (is_upper) ? "TrmmUpperToPadded" : "TrmmLowerToPadded";
+
+  // Determines whether the triangular matrix is upper-triangular as seen by the Xgemm kernel, i.e.
+  // after the optional transpose
+  auto op_upper = ((triangle == Triangle::kUpper) == (a_transpose == Transpose::kNo));
 
   // Determines whether or not the triangular matrix is unit-diagonal
   auto unit_diagonal = (diagonal == Diagonal::kUnit) ? true : false;
 
-  // Temporary buffer for a copy of the triangular matrix
+  // Computes whether or not the matrices are transposed in memory, following the Xgemm routine
+  // for either "B := alpha*A*B" or "B := alpha*B*A". Note that in the latter case A and B are
+  // reversed as seen by the Xgemm kernel.
+  auto a_rotated = (layout == Layout::kColMajor && a_transpose != Transpose::kNo) ||
+                   (layout == Layout::kRowMajor && a_transpose == Transpose::kNo);
+  auto a_do_transpose = (left) ? a_rotated : !a_rotated;
+  auto a_conjugate = (a_transpose == Transpose::kConjugate);
+  auto b_do_transpose = (left) ? !b_rotated : b_rotated;
+  auto c_do_transpose = b_rotated;
+
+  // Calculates the ceiled versions of m, n, and k
+  auto m_ceiled = Ceil(m, db_["MWG"]);
+  auto n_ceiled = Ceil(n, db_["NWG"]);
+  auto k_ceiled = Ceil(k, db_["KWG"]);
+
+  // The dimensions of the padded triangular and general matrices as seen by the Xgemm kernel
+  auto triangular_one = (left) ? m_ceiled : n_ceiled;
+  auto general_one = (left) ? n_ceiled : m_ceiled;
+
+  // The padded/transposed input/output matrices: if memory allocation fails, throw an exception
   try {
-    auto temp_triangular = Buffer(context_, CL_MEM_READ_WRITE, k*k*sizeof(T));
 
-    // Creates a general matrix from the triangular matrix to be able to run the regular Xgemm
-    // routine afterwards
+    // Loads the program from the database
+    auto& program = GetProgramFromCache();
+
+    // Determines whether or not a temporary output matrix is needed. A temporary input matrix is
+    // always needed, since matrix B is both input and output.
+    auto c_no_temp = b_one == m_ceiled && b_two == n_ceiled && b_ld == m_ceiled && b_offset == 0 &&
+                     c_do_transpose == false;
+
+    // Creates the temporary matrices
+    auto triangular_temp = Buffer(context_, CL_MEM_READ_WRITE, k_ceiled*triangular_one*sizeof(T));
+    auto general_temp = Buffer(context_, CL_MEM_READ_WRITE, k_ceiled*general_one*sizeof(T));
+    auto c_temp = (c_no_temp) ? b_buffer :
+                                Buffer(context_, CL_MEM_READ_WRITE, m_ceiled*n_ceiled*sizeof(T));
+
+    // Copies the triangular matrix directly into the padded matrix as used by the Xgemm kernel,
+    // setting the other triangle to zero and, optionally, the diagonal to one
     try {
-      auto& program = GetProgramFromCache();
       auto kernel = Kernel(program, kernel_name);
-
-      // Sets the arguments for the triangular-to-squared kernel
       kernel.SetArgument(0, static_cast<int>(k));
       kernel.SetArgument(1, static_cast<int>(a_ld));
       kernel.SetArgument(2, static_cast<int>(a_offset));
       kernel.SetArgument(3, a_buffer());
-      kernel.SetArgument(4, static_cast<int>(k));
-      kernel.SetArgument(5, static_cast<int>(k));
-      kernel.SetArgument(6, static_cast<int>(0));
-      kernel.SetArgument(7, temp_triangular());
-      kernel.SetArgument(8, static_cast<int>(unit_diagonal));
-
-      // Uses the common padding kernel's thread configuration. This is allowed, since the
-      // triangular-to-squared kernel uses the same parameters.
-      auto global = std::vector<size_t>{Ceil(CeilDiv(k, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
-                                        Ceil(CeilDiv(k, db_["PAD_WPTY"]), db_["PAD_DIMY"])};
+      kernel.SetArgument(4, static_cast<int>(triangular_one));
+      kernel.SetArgument(5, static_cast<int>(k_ceiled));
+      kernel.SetArgument(6, static_cast<int>(triangular_one));
+      kernel.SetArgument(7, static_cast<int>(0));
+      kernel.SetArgument(8, triangular_temp());
+      kernel.SetArgument(9, static_cast<int>(a_do_transpose));
+      kernel.SetArgument(10, static_cast<int>(a_conjugate));
+      kernel.SetArgument(11, static_cast<int>(unit_diagonal));
+      auto global = std::vector<size_t>{
+        Ceil(CeilDiv(triangular_one, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
+        Ceil(CeilDiv(k_ceiled, db_["PAD_WPTY"]), db_["PAD_DIMY"])
+      };
       auto local = std::vector<size_t>{db_["PAD_DIMX"], db_["PAD_DIMY"]};
       status = RunKernel(kernel, global, local);
       if (ErrorIn(status)) { return status; }
+    } catch (...) { return StatusCode::kInvalidKernel; }
 
-      // Runs the regular Xgemm code with either "B := alpha*A*B" or ...
-      if (side == Side::kLeft) {
-        status = DoGemm(layout, a_transpose, Transpose::kNo,
-                        m, n, k,
-                        alpha,
-                        temp_triangular, 0, k,
-                        b_buffer, b_offset, b_ld,
-                        static_cast<T>(0.0),
-                        b_buffer, b_offset, b_ld);
-      }
+    // Runs the pre-processing kernel for the general matrix B
+    status = PadCopyTransposeMatrix(b_one, b_two, b_ld, b_offset, b_buffer,
+                                    general_one, k_ceiled, general_one, 0, general_temp,
+                                    program, true, b_do_transpose, false);
+    if (ErrorIn(status)) { return status; }
+
+    // Retrieves the Xgemm kernel from the compiled binary
+    try {
+      auto kernel = Kernel(program, "Xgemm");
+
+      // Sets the kernel arguments. The triangular matrix is either the first or the second input.
+      kernel.SetArgument(0, static_cast<int>(m_ceiled));
+      kernel.SetArgument(1, static_cast<int>(n_ceiled));
+      kernel.SetArgument(2, static_cast<int>(k_ceiled));
+      kernel.SetArgument(3, alpha);
+      kernel.SetArgument(4, static_cast<T>(0.0));
+      kernel.SetArgument(5, (left) ? triangular_temp() : general_temp());
+      kernel.SetArgument(6, (left) ? general_temp() : triangular_temp());
+      kernel.SetArgument(7, c_temp());
+      kernel.SetArgument(8, static_cast<int>(left));
+      kernel.SetArgument(9, static_cast<int>(op_upper));
+
+      // Computes the global and local thread sizes
+      auto global = std::vector<size_t>{
+        (m_ceiled * db_["MDIMC"]) / db_["MWG"],
+        (n_ceiled * db_["NDIMC"]) / db_["NWG"]
+      };
+      auto local = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"]};
+
+      // Launches the kernel
+      status = RunKernel(kernel, global, local);
+      if (ErrorIn(status)) { return status; }
 
-      // ... with "B := alpha*B*A". Note that A and B are now reversed.
-      else {
-        status = DoGemm(layout, Transpose::kNo, a_transpose,
-                        m, n, k,
-                        alpha,
-                        b_buffer, b_offset, b_ld,
-                        temp_triangular, 0, k,
-                        static_cast<T>(0.0),
-                        b_buffer, b_offset, b_ld);
-
-        // A and B are now reversed, so also reverse the error codes returned from the Xgemm routine
-        switch(status) {
-          case StatusCode::kInvalidMatrixA:      status = StatusCode::kInvalidMatrixB; break;
-          case StatusCode::kInvalidMatrixB:      status = StatusCode::kInvalidMatrixA; break;
-          case StatusCode::kInvalidLeadDimA:     status = StatusCode::kInvalidLeadDimB; break;
-          case StatusCode::kInvalidLeadDimB:     status = StatusCode::kInvalidLeadDimA; break;
-          case StatusCode::kInsufficientMemoryA: status = StatusCode::kInsufficientMemoryB; break;
-          case StatusCode::kInsufficientMemoryB: status = StatusCode::kInsufficientMemoryA; break;
-        }
+      // Runs the post-processing kernel if needed
+      if (!c_no_temp) {
+        status = PadCopyTransposeMatrix(m_ceiled, n_ceiled, m_ceiled, 0, c_temp,
+                                        b_one, b_two, b_ld, b_offset, b_buffer,
+                                        program, false, c_do_transpose, false);
+        if (ErrorIn(status)) { return status; }
       }
 
-      // Return the status of the Xgemm routine
-      return status;
+      // Successfully finished the computation
+      return StatusCode::kSuccess;
     } catch (...) { return StatusCode::kInvalidKernel; }
   } catch (...) { return StatusCode::kTempBufferAllocFailure; }
 }
@@ -0,0 +1,218 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xtrsm class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "internal/routines/level3/xtrsm.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Specific implementations to get the memory-type based on a template argument
+template <> const Precision Xtrsm<float>::precision_ = Precision::kSingle;
+template <> const Precision Xtrsm<double>::precision_ = Precision::kDouble;
+template <> const Precision Xtrsm<float2>::precision_ = Precision::kComplexSingle;
+template <> const Precision Xtrsm<double2>::precision_ = Precision::kComplexDouble;
+
+// Definitions of the constants of the blocked algorithm
+template <typename T> constexpr size_t Xtrsm<T>::kBlockSize;
+template <typename T> constexpr size_t Xtrsm<T>::kInvertThreads;
+
+// =================================================================================================
+
+// Constructor: forwards to base class constructor and creates the Xgemm routine
+template <typename T>
+Xtrsm<T>::Xtrsm(CommandQueue &queue, Event &event):
+    Routine(queue, event, "TRSM", {"Copy","Pad"}, precision_),
+    gemm_(queue, event) {
+  source_string_ =
+    #include "../../kernels/copy.opencl"
+    #include "../../kernels/pad.opencl"
+    #include "../../kernels/invert.opencl"
+  ;
+}
+
+// Compiles the kernels of this routine and of the Xgemm routine
+template <typename T>
+StatusCode Xtrsm<T>::SetUp() {
+  auto status = Routine::SetUp();
+  if (ErrorIn(status)) { return status; }
+  return gemm_.SetUp();
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+StatusCode Xtrsm<T>::DoTrsm(const Layout layout, const Side side, const Triangle triangle,
+                            const Transpose a_transpose, const Diagonal diagonal,
+                            const size_t m, const size_t n,
+                            const T alpha,
+                            const Buffer &a_buffer, const size_t a_offset, const size_t a_ld,
+                            const Buffer &b_buffer, const size_t b_offset, const size_t b_ld) {
+
+  // Makes sure all dimensions are larger than zero
+  if ((m == 0) || (n == 0)) { return StatusCode::kInvalidDimension; }
+
+  // Computes the k dimension: the size of the triangular matrix A
+  auto left = (side == Side::kLeft);
+  auto k = (left) ? m : n;
+
+  // Checks for validity of the triangular A matrix and of the B matrix, which holds the right-hand
+  // sides on input and the solution on output
+  auto col_major = (layout == Layout::kColMajor);
+  auto b_one = (col_major) ? m : n;
+  auto b_two = (col_major) ? n : m;
+  auto status = TestMatrixA(k, k, a_buffer, a_offset, a_ld, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+
+  // Determines whether the triangle is upper or lower as stored in memory (the kernel assumes
+  // column-major) and whether it is lower as seen by the solver, i.e. after the optional transpose
+  auto is_upper = ((triangle == Triangle::kUpper) == col_major);
+  auto op_lower = ((triangle == Triangle::kLower) == (a_transpose == Transpose::kNo));
+  auto unit_diagonal = (diagonal == Diagonal::kUnit);
+
+  // Computes the offsets of an element (row, column) of the matrices A, B, and of the temporary
+  // solution X. For A, the element is given as seen after the optional transpose.
+  auto x_ld = (col_major) ? m : n;
+  auto a_op_offset = [&](const size_t row, const size_t col) {
+    auto a_row = (a_transpose == Transpose::kNo) ? row : col;
+    auto a_col = (a_transpose == Transpose::kNo) ? col : row;
+    return a_offset + ((col_major) ? a_col*a_ld + a_row : a_row*a_ld + a_col);
+  };
+  auto b_index = [&](const size_t row, const size_t col) {
+    return b_offset + ((col_major) ? col*b_ld + row : row*b_ld + col);
+  };
+  auto x_index = [&](const size_t row, const size_t col) {
+    return (col_major) ? col*x_ld + row : row*x_ld + col;
+  };
+
+  // The number of diagonal blocks
+  auto num_blocks = CeilDiv(k, kBlockSize);
+
+  // Temporary buffers: if memory allocation fails, throw an exception
+  try {
+
+    // Loads the program from the database
+    auto& program = GetProgramFromCache();
+
+    // Creates the temporary buffers for the inverted diagonal blocks and for the solution
+    auto inverse_size = num_blocks*kBlockSize*kBlockSize;
+    auto inverse_temp = Buffer(context_, CL_MEM_READ_WRITE, inverse_size*sizeof(T));
+    auto x_temp = Buffer(context_, CL_MEM_READ_WRITE, m*n*sizeof(T));
+
+    // Inverts the diagonal blocks of the triangular matrix
+    try {
+      auto kernel = Kernel(program, "InvertDiagonalBlocks");
+      kernel.SetArgument(0, static_cast<int>(k));
+      kernel.SetArgument(1, static_cast<int>(kBlockSize));
+      kernel.SetArgument(2, static_cast<int>(a_ld));
+      kernel.SetArgument(3, static_cast<int>(a_offset));
+      kernel.SetArgument(4, a_buffer());
+      kernel.SetArgument(5, inverse_temp());
+      kernel.SetArgument(6, static_cast<int>(is_upper));
+      kernel.SetArgument(7, static_cast<int>(unit_diagonal));
+      auto global = std::vector<size_t>{num_blocks*kInvertThreads};
+      auto local = std::vector<size_t>{kInvertThreads};
+      status = RunKernel(kernel, global, local);
+      if (ErrorIn(status)) { return status; }
+    } catch (...) { return StatusCode::kInvalidKernel; }
+
+    // Loops over the blocks of the triangular matrix, in forward order if the triangle (after the
+    // optional transpose) is lower for A on the left or upper for A on the right, else backwards
+    auto forward = (left) ? op_lower : !op_lower;
+    for (auto step = size_t{0}; step < num_blocks; ++step) {
+      auto block = (forward) ? step : num_blocks - 1 - step;
+      auto i0 = block*kBlockSize;
+      auto ib = std::min(kBlockSize, k - i0);
+
+      // The range of the already solved blocks, which are used to update the current block
+      auto j0 = (forward) ? size_t{0} : i0 + ib;
+      auto jb = (forward) ? i0 : k - j0;
+
+      // The right-hand sides are scaled by alpha by the first of the below two steps
+      auto solve_alpha = (step == 0) ? alpha : static_cast<T>(1.0);
+
+      // Solves "op(A) * X = alpha * B" for the current rows of X
+      if (left) {
+
+        // Updates the current rows of B with the already solved rows of X
+        if (jb > 0) {
+          status = gemm_.DoGemm(layout, a_transpose, Transpose::kNo,
+                                ib, n, jb, static_cast<T>(-1.0),
+                                a_buffer, a_op_offset(i0, j0), a_ld,
+                                x_temp, x_index(j0, 0), x_ld,
+                                alpha,
+                                b_buffer, b_index(i0, 0), b_ld);
+          if (ErrorIn(status)) { return status; }
+        }
+
+        // Solves for the current rows of X using the inverse of the diagonal block
+        status = gemm_.DoGemm(layout, a_transpose, Transpose::kNo,
+                              ib, n, ib, solve_alpha,
+                              inverse_temp, block*kBlockSize*kBlockSize, kBlockSize,
+                              b_buffer, b_index(i0, 0), b_ld,
+                              static_cast<T>(0.0),
+                              x_temp, x_index(i0, 0), x_ld);
+        if (ErrorIn(status)) { return status; }
+      }
+
+      // Solves "X * op(A) = alpha * B" for the current columns of X
+      else {
+
+        // Updates the current columns of B with the already solved columns of X
+        if (jb > 0) {
+          status = gemm_.DoGemm(layout, Transpose::kNo, a_transpose,
+                                m, ib, jb, static_cast<T>(-1.0),
+                                x_temp, x_index(0, j0), x_ld,
+                                a_buffer, a_op_offset(j0, i0), a_ld,
+                                alpha,
+                                b_buffer, b_index(0, i0), b_ld);
+          if (ErrorIn(status)) { return status; }
+        }
+
+        // Solves for the current columns of X using the inverse of the diagonal block
+        status = gemm_.DoGemm(layout, Transpose::kNo, a_transpose,
+                              m, ib, ib, solve_alpha,
+                              b_buffer, b_index(0, i0), b_ld,
+                              inverse_temp, block*kBlockSize*kBlockSize, kBlockSize,
+                              static_cast<T>(0.0),
+                              x_temp, x_index(0, i0), x_ld);
+        if (ErrorIn(status)) { return status; }
+      }
+    }
+
+    // Copies the solution back into the B matrix
+    status = PadCopyTransposeMatrix(b_one, b_two, b_one, 0, x_temp,
+                                    b_one, b_two, b_ld, b_offset, b_buffer,
+                                    program, false, false, false);
+    if (ErrorIn(status)) { return status; }
+
+    // Successfully finished the computation
+    return StatusCode::kSuccess;
+  } catch (...) { return StatusCode::kTempBufferAllocFailure; }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xtrsm<float>;
+template class Xtrsm<double>;
+template class Xtrsm<float2>;
+template class Xtrsm<double2>;
+
+// =================================================================================================
+} // namespace clblast
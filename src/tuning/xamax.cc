@@ -0,0 +1,83 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements an auto-tuner to tune the Xamax OpenCL kernel. It uses the CLTune library.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+#include "internal/utilities.h"
+#include "internal/tuning.h"
+
+namespace clblast {
+// =================================================================================================
+
+// The Xamax auto-tuner
+template <typename T>
+void XamaxTune(const Arguments<T> &args,
+               const std::vector<T> &x_vec, std::vector<T> &y_vec,
+               cltune::Tuner &tuner) {
+
+  // This points to the Xamax kernel as found in the CLBlast library. The kernel finds the maximum
+  // absolute value of the x vector and stores 2*WGS2 partial results (values and indices) in the
+  // y vector. Note that no reference kernel is set: the partial results depend on the parameters.
+  std::string sources =
+    #include "../src/kernels/common.opencl"
+    #include "../src/kernels/xamax.opencl"
+  ;
+  auto id = tuner.AddKernelFromString(sources, "Xamax", {2}, {1});
+
+  // Sets the tunable parameters and their possible values
+  tuner.AddParameter(id, "WGS1", {32, 64, 128, 256, 512, 1024});
+  tuner.AddParameter(id, "WGS2", {32, 64, 128, 256, 512, 1024});
+
+  // Tests for a specific precision
+  tuner.AddParameter(id, "PRECISION", {static_cast<size_t>(args.precision)});
+
+  // Modifies the thread-sizes (global and local) based on the parameters
+  tuner.MulLocalSize(id, {"WGS1"});
+  tuner.MulGlobalSize(id, {"WGS1"});
+  tuner.MulGlobalSize(id, {"WGS2"});
+
+  // Sets the function's arguments
+  tuner.AddArgumentScalar(static_cast<int>(args.n));
+  tuner.AddArgumentInput(x_vec);
+  tuner.AddArgumentScalar(0);
+  tuner.AddArgumentScalar(1);
+  tuner.AddArgumentOutput(y_vec);
+  tuner.AddArgumentOutput(y_vec);
+  tuner.AddArgumentScalar(0);
+}
+
+// =================================================================================================
+
+// Main function which calls the common client code with the routine-specific function as argument.
+void TunerXamax(int argc, char *argv[]) {
+  switch(GetPrecision(argc, argv)) {
+    case Precision::kHalf: throw std::runtime_error("Unsupported precision mode");
+    case Precision::kSingle: TunerXY<float>(argc, argv, XamaxTune<float>); break;
+    case Precision::kDouble: TunerXY<double>(argc, argv, XamaxTune<double>); break;
+    case Precision::kComplexSingle: TunerXY<float2>(argc, argv, XamaxTune<float2>); break;
+    case Precision::kComplexDouble: TunerXY<double2>(argc, argv, XamaxTune<double2>); break;
+  }
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  clblast::TunerXamax(argc, argv);
+  return 0;
+}
+
+// =================================================================================================
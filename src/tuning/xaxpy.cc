@@ -36,6 +36,7 @@ void XaxpyTune(const Arguments<T> &args,
   // This points to the XaxpyFast kernel as found in the CLBlast library
   std::string sources =
     #include "../src/kernels/common.opencl"
+    #include "../src/kernels/level1.opencl"
     #include "../src/kernels/xaxpy.opencl"
   ;
   auto id = tuner.AddKernelFromString(sources, "XaxpyFast", {args.n}, {1});
@@ -0,0 +1,85 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements an auto-tuner to tune the Xdot OpenCL kernel. It uses the CLTune library.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+#include "internal/utilities.h"
+#include "internal/tuning.h"
+
+namespace clblast {
+// =================================================================================================
+
+// The Xdot auto-tuner
+template <typename T>
+void XdotTune(const Arguments<T> &args,
+              const std::vector<T> &x_vec, std::vector<T> &y_vec,
+              cltune::Tuner &tuner) {
+
+  // This points to the Xdot kernel as found in the CLBlast library. The kernel computes the dot-
+  // product of the x vector with itself and stores 2*WGS2 partial results in the y vector. Note
+  // that no reference kernel is set: the values of the partial results depend on the parameters.
+  std::string sources =
+    #include "../src/kernels/common.opencl"
+    #include "../src/kernels/xdot.opencl"
+  ;
+  auto id = tuner.AddKernelFromString(sources, "Xdot", {2}, {1});
+
+  // Sets the tunable parameters and their possible values
+  tuner.AddParameter(id, "WGS1", {32, 64, 128, 256, 512, 1024});
+  tuner.AddParameter(id, "WGS2", {32, 64, 128, 256, 512, 1024});
+
+  // Tests for a specific precision
+  tuner.AddParameter(id, "PRECISION", {static_cast<size_t>(args.precision)});
+
+  // Modifies the thread-sizes (global and local) based on the parameters
+  tuner.MulLocalSize(id, {"WGS1"});
+  tuner.MulGlobalSize(id, {"WGS1"});
+  tuner.MulGlobalSize(id, {"WGS2"});
+
+  // Sets the function's arguments
+  tuner.AddArgumentScalar(static_cast<int>(args.n));
+  tuner.AddArgumentInput(x_vec);
+  tuner.AddArgumentScalar(0);
+  tuner.AddArgumentScalar(1);
+  tuner.AddArgumentInput(x_vec);
+  tuner.AddArgumentScalar(0);
+  tuner.AddArgumentScalar(1);
+  tuner.AddArgumentOutput(y_vec);
+  tuner.AddArgumentScalar(0);
+}
+
+// =================================================================================================
+
+// Main function which calls the common client code with the routine-specific function as argument.
+void TunerXdot(int argc, char *argv[]) {
+  switch(GetPrecision(argc, argv)) {
+    case Precision::kHalf: throw std::runtime_error("Unsupported precision mode");
+    case Precision::kSingle: TunerXY<float>(argc, argv, XdotTune<float>); break;
+    case Precision::kDouble: TunerXY<double>(argc, argv, XdotTune<double>); break;
+    case Precision::kComplexSingle: TunerXY<float2>(argc, argv, XdotTune<float2>); break;
+    case Precision::kComplexDouble: TunerXY<double2>(argc, argv, XdotTune<double2>); break;
+  }
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  clblast::TunerXdot(argc, argv);
+  return 0;
+}
+
+// =================================================================================================
@@ -0,0 +1,100 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements an auto-tuner to tune the Xger OpenCL kernel. It uses the CLTune library.
+// Only the fast version of the kernel is tuned: the full version shares its parameters.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+#include "internal/utilities.h"
+#include "internal/tuning.h"
+
+namespace clblast {
+// =================================================================================================
+
+// The Xger auto-tuner
+template <typename T>
+void XgerTune(const Arguments<T> &args, const size_t,
+              const std::vector<T> &a_mat, const std::vector<T> &x_vec, std::vector<T> &y_vec,
+              cltune::Tuner &tuner) {
+
+  // The XgerFast kernel only works under certain conditions. Check here whether the condition is
+  // true for the reference kernel and for the largest values of the tuning parameters.
+  if (!IsMultiple(args.m, 256*8) || !IsMultiple(args.n, 16*4)) {
+    throw std::runtime_error("The 'XgerFast' kernel requires 'm' to be a multiple of WGS1*VW and "
+                             "'n' to be a multiple of WGS2*WPT");
+  }
+
+  // This points to the XgerFast kernel as found in the CLBlast library. The matrix is column-major
+  // with 'm' rows: the vector along its first dimension has length 'm' and along its second 'n'.
+  std::string sources =
+    #include "../src/kernels/common.opencl"
+    #include "../src/kernels/level1.opencl"
+    #include "../src/kernels/xger.opencl"
+  ;
+  auto id = tuner.AddKernelFromString(sources, "XgerFast", {args.m, args.n}, {1, 1});
+  tuner.SetReferenceFromString(sources, "XgerFast", {args.m, args.n}, {64, 4});
+
+  // Sets the tunable parameters and their possible values
+  tuner.AddParameter(id, "WGS1", {8, 16, 32, 64, 128, 256});
+  tuner.AddParameter(id, "WGS2", {1, 2, 4, 8, 16});
+  tuner.AddParameter(id, "WPT", {1, 2, 4});
+  tuner.AddParameter(id, "VW", {1, 2, 4, 8});
+
+  // Tests for a specific precision
+  tuner.AddParameter(id, "PRECISION", {static_cast<size_t>(args.precision)});
+  tuner.AddParameterReference("PRECISION", static_cast<size_t>(args.precision));
+
+  // Modifies the thread-sizes (both global and local) based on the parameters
+  tuner.MulLocalSize(id, {"WGS1", "WGS2"});
+  tuner.DivGlobalSize(id, {"VW", "WPT"});
+
+  // Sets the function's arguments
+  tuner.AddArgumentScalar(static_cast<int>(args.m));
+  tuner.AddArgumentScalar(static_cast<int>(args.n));
+  tuner.AddArgumentScalar(args.alpha);
+  tuner.AddArgumentInput(y_vec);
+  tuner.AddArgumentScalar(0);
+  tuner.AddArgumentScalar(1);
+  tuner.AddArgumentInput(x_vec);
+  tuner.AddArgumentScalar(0);
+  tuner.AddArgumentScalar(1);
+  tuner.AddArgumentOutput(a_mat);
+  tuner.AddArgumentScalar(static_cast<int>(args.m));
+  tuner.AddArgumentScalar(0); // Conjugate of the first vector
+  tuner.AddArgumentScalar(0); // Conjugate of the second vector
+}
+
+// =================================================================================================
+
+// Main function which calls the common client code with the routine-specific function as argument.
+void TunerXger(int argc, char *argv[]) {
+  auto num_variations = size_t{1};
+  switch(GetPrecision(argc, argv)) {
+    case Precision::kHalf: throw std::runtime_error("Unsupported precision mode");
+    case Precision::kSingle: TunerAXY<float>(argc, argv, num_variations, XgerTune<float>); break;
+    case Precision::kDouble: TunerAXY<double>(argc, argv, num_variations, XgerTune<double>); break;
+    case Precision::kComplexSingle: TunerAXY<float2>(argc, argv, num_variations, XgerTune<float2>); break;
+    case Precision::kComplexDouble: TunerAXY<double2>(argc, argv, num_variations, XgerTune<double2>); break;
+  }
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  clblast::TunerXger(argc, argv);
+  return 0;
+}
+
+// =================================================================================================
@@ -0,0 +1,93 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements an auto-tuner to tune the Xrot OpenCL kernel. It uses the CLTune library.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+#include "internal/utilities.h"
+#include "internal/tuning.h"
+
+namespace clblast {
+// =================================================================================================
+
+// The Xrot auto-tuner
+template <typename T>
+void XrotTune(const Arguments<T> &args,
+               const std::vector<T> &x_vec, std::vector<T> &y_vec,
+               cltune::Tuner &tuner) {
+
+  // The XrotFast kernel only works under certain conditions. Check here whether the condition is
+  // true for the reference kernel
+  if (!IsMultiple(args.n, 64)) {
+    throw std::runtime_error("The 'XrotFast' kernel requires 'n' to be a multiple of WGS*WPT*VW");
+  }
+
+  // This points to the XrotFast kernel as found in the CLBlast library. Note that no reference
+  // kernel is set: the x vector is rotated in-place repeatedly, such that the results of the runs
+  // differ from each other.
+  std::string sources =
+    #include "../src/kernels/common.opencl"
+    #include "../src/kernels/level1.opencl"
+    #include "../src/kernels/xrot.opencl"
+  ;
+  auto id = tuner.AddKernelFromString(sources, "XrotFast", {args.n}, {1});
+
+  // Sets the tunable parameters and their possible values
+  tuner.AddParameter(id, "WGS", {64, 128, 256, 512, 1024, 2048});
+  tuner.AddParameter(id, "WPT", {1, 2, 4, 8});
+  tuner.AddParameter(id, "VW", {1, 2, 4, 8});
+
+  // Tests for a specific precision
+  tuner.AddParameter(id, "PRECISION", {static_cast<size_t>(args.precision)});
+
+  // Modifies the thread-sizes (local) based on the parameters
+  tuner.MulLocalSize(id, {"WGS"});
+  tuner.DivGlobalSize(id, {"WPT"});
+  tuner.DivGlobalSize(id, {"VW"});
+
+  // Sets the function's arguments. The rotation parameters are stored in single-element buffers.
+  auto c_vec = std::vector<T>{static_cast<T>(0.6)};
+  auto s_vec = std::vector<T>{static_cast<T>(0.8)};
+  tuner.AddArgumentScalar(static_cast<int>(args.n));
+  tuner.AddArgumentInput(x_vec);
+  tuner.AddArgumentOutput(y_vec);
+  tuner.AddArgumentInput(c_vec);
+  tuner.AddArgumentScalar(0);
+  tuner.AddArgumentInput(s_vec);
+  tuner.AddArgumentScalar(0);
+}
+
+// =================================================================================================
+
+// Main function which calls the common client code with the routine-specific function as argument.
+void TunerXrot(int argc, char *argv[]) {
+  switch(GetPrecision(argc, argv)) {
+    case Precision::kHalf: throw std::runtime_error("Unsupported precision mode");
+    case Precision::kSingle: TunerXY<float>(argc, argv, XrotTune<float>); break;
+    case Precision::kDouble: TunerXY<double>(argc, argv, XrotTune<double>); break;
+    case Precision::kComplexSingle: throw std::runtime_error("Unsupported precision mode");
+    case Precision::kComplexDouble: throw std::runtime_error("Unsupported precision mode");
+  }
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  clblast::TunerXrot(argc, argv);
+  return 0;
+}
+
+// =================================================================================================
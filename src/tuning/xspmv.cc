@@ -0,0 +1,104 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements an auto-tuner to tune the Xspmv OpenCL kernel. It uses the CLTune library.
+// The kernel is tuned for a full symmetric packed matrix, which is the case of the SPMV and HPMV
+// routines. The triangular routines use the same parameters.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+#include "internal/utilities.h"
+#include "internal/tuning.h"
+
+namespace clblast {
+// =================================================================================================
+
+// The Xspmv auto-tuner
+template <typename T>
+void XspmvTune(const Arguments<T> &args, const size_t,
+               const std::vector<T> &a_mat, const std::vector<T> &x_vec, std::vector<T> &y_vec,
+               cltune::Tuner &tuner) {
+
+  // The kernel is tuned for an n-by-n packed matrix, which fits in the m-by-n input buffer
+  if (!IsMultiple(args.n, 256*8) || args.m < args.n) {
+    throw std::runtime_error("The 'Xspmv' kernel is tuned for 'n' a multiple of WGS*WPT and for "
+                             "'m' at least 'n'");
+  }
+
+  // This points to the Xspmv kernel as found in the CLBlast library
+  std::string sources =
+    #include "../src/kernels/common.opencl"
+    #include "../src/kernels/xspmv.opencl"
+  ;
+  auto id = tuner.AddKernelFromString(sources, "Xspmv", {args.n}, {1});
+  tuner.SetReferenceFromString(sources, "Xspmv", {args.n}, {64});
+
+  // Sets the tunable parameters and their possible values
+  tuner.AddParameter(id, "WGS", {32, 64, 128, 256});
+  tuner.AddParameter(id, "WPT", {1, 2, 4, 8});
+
+  // Tests for a specific precision
+  tuner.AddParameter(id, "PRECISION", {static_cast<size_t>(args.precision)});
+  tuner.AddParameterReference("PRECISION", static_cast<size_t>(args.precision));
+
+  // Modifies the thread-sizes (local) based on the parameters
+  tuner.MulLocalSize(id, {"WGS"});
+  tuner.DivGlobalSize(id, {"WPT"});
+
+  // Sets the function's arguments
+  tuner.AddArgumentScalar(static_cast<int>(args.n));
+  tuner.AddArgumentScalar(static_cast<int>(args.n));
+  tuner.AddArgumentScalar(static_cast<int>(args.n));
+  tuner.AddArgumentScalar(0);
+  tuner.AddArgumentScalar(0);
+  tuner.AddArgumentScalar(args.alpha);
+  tuner.AddArgumentScalar(args.beta);
+  tuner.AddArgumentInput(a_mat);
+  tuner.AddArgumentScalar(0);
+  tuner.AddArgumentInput(x_vec);
+  tuner.AddArgumentScalar(0);
+  tuner.AddArgumentScalar(1);
+  tuner.AddArgumentOutput(y_vec);
+  tuner.AddArgumentScalar(0);
+  tuner.AddArgumentScalar(1);
+  tuner.AddArgumentScalar(0); // Rotated matrix
+  tuner.AddArgumentScalar(0); // Conjugate transpose
+  tuner.AddArgumentScalar(1); // Lower triangle
+  tuner.AddArgumentScalar(1); // Symmetric matrix
+  tuner.AddArgumentScalar(0); // Hermitian matrix
+  tuner.AddArgumentScalar(0); // Unit diagonal
+}
+
+// =================================================================================================
+
+// Main function which calls the common client code with the routine-specific function as argument.
+void TunerXspmv(int argc, char *argv[]) {
+  auto num_variations = size_t{1};
+  switch(GetPrecision(argc, argv)) {
+    case Precision::kHalf: throw std::runtime_error("Unsupported precision mode");
+    case Precision::kSingle: TunerAXY<float>(argc, argv, num_variations, XspmvTune<float>); break;
+    case Precision::kDouble: TunerAXY<double>(argc, argv, num_variations, XspmvTune<double>); break;
+    case Precision::kComplexSingle: TunerAXY<float2>(argc, argv, num_variations, XspmvTune<float2>); break;
+    case Precision::kComplexDouble: TunerAXY<double2>(argc, argv, num_variations, XspmvTune<double2>); break;
+  }
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  clblast::TunerXspmv(argc, argv);
+  return 0;
+}
+
+// =================================================================================================
@@ -0,0 +1,104 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements an auto-tuner to tune the Xsymv OpenCL kernel. It uses the CLTune library.
+// Only the main kernel is tuned: the epilogue kernel is small compared to it.
+//
+// =================================================================================================
+
+
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+#include "internal/utilities.h"
+#include "internal/tuning.h"
+
+namespace clblast {
+// =================================================================================================
+
+// The Xsymv auto-tuner
+template <typename T>
+void XsymvTune(const Arguments<T> &args, const size_t,
+               const std::vector<T> &a_mat, const std::vector<T> &x_vec, std::vector<T> &,
+               cltune::Tuner &tuner) {
+
+  // The kernel is tuned for full tiles and for an equal amount of block-columns per work-group.
+  // Check here whether this is true for the largest values of the tuning parameters.
+  if (!IsMultiple(args.n, 64*8) || args.m < args.n) {
+    throw std::runtime_error("The 'Xsymv' kernel is tuned for 'n' a multiple of WGS1*WPT1 and for "
+                             "'m' at least 'n'");
+  }
+
+  // This points to the Xsymv kernel as found in the CLBlast library. The kernel reads the lower
+  // triangle of the (column-major) n-by-n matrix and stores its partial results in a copy of the
+  // matrix, which is large enough for any number of work-groups. Note that no reference kernel is
+  // set: the values of the partial results depend on the parameters.
+  std::string sources =
+    #include "../src/kernels/common.opencl"
+    #include "../src/kernels/xsymv.opencl"
+  ;
+  auto id = tuner.AddKernelFromString(sources, "Xsymv", {args.n}, {1});
+
+  // Sets the tunable parameters and their possible values. The local work-group size of the
+  // epilogue kernel is not tuned, but is listed to obtain a complete database entry.
+  tuner.AddParameter(id, "WGS1", {8, 16, 32, 64});
+  tuner.AddParameter(id, "WPT1", {1, 2, 4, 8});
+  tuner.AddParameter(id, "WGS2", {64});
+
+  // Tests for a specific precision
+  tuner.AddParameter(id, "PRECISION", {static_cast<size_t>(args.precision)});
+
+  // Sets the constraints for local memory size limitations
+  auto LocalMemorySize = [args] (std::vector<size_t> v) {
+    return ((v[0]*(v[0] + 1) + 2*v[0])*GetBytes(args.precision));
+  };
+  tuner.SetLocalMemoryUsage(id, LocalMemorySize, {"WGS1"});
+
+  // Modifies the thread-sizes (both global and local) based on the parameters
+  tuner.MulLocalSize(id, {"WGS1"});
+  tuner.DivGlobalSize(id, {"WPT1"});
+
+  // Sets the function's arguments
+  tuner.AddArgumentScalar(static_cast<int>(args.n));
+  tuner.AddArgumentInput(a_mat);
+  tuner.AddArgumentScalar(0);
+  tuner.AddArgumentScalar(static_cast<int>(args.n));
+  tuner.AddArgumentInput(x_vec);
+  tuner.AddArgumentScalar(0);
+  tuner.AddArgumentScalar(1);
+  tuner.AddArgumentOutput(a_mat);
+  tuner.AddArgumentScalar(0); // Whether the lower triangle is read rotated
+  tuner.AddArgumentScalar(0); // Whether the lower triangle is conjugated
+  tuner.AddArgumentScalar(0); // Whether the matrix is Hermitian
+}
+
+// =================================================================================================
+
+// Main function which calls the common client code with the routine-specific function as argument.
+void TunerXsymv(int argc, char *argv[]) {
+  auto num_variations = size_t{1};
+  switch(GetPrecision(argc, argv)) {
+    case Precision::kHalf: throw std::runtime_error("Unsupported precision mode");
+    case Precision::kSingle: TunerAXY<float>(argc, argv, num_variations, XsymvTune<float>); break;
+    case Precision::kDouble: TunerAXY<double>(argc, argv, num_variations, XsymvTune<double>); break;
+    case Precision::kComplexSingle: TunerAXY<float2>(argc, argv, num_variations, XsymvTune<float2>); break;
+    case Precision::kComplexDouble: TunerAXY<double2>(argc, argv, num_variations, XsymvTune<double2>); break;
+  }
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  clblast::TunerXsymv(argc, argv);
+  return 0;
+}
+
+// =================================================================================================
@@ -48,6 +48,12 @@ std::string ToString(double2 value) {
   return real.str()+"+"+imag.str()+"i";
 }
 
+// If not possible directly: special case for half-precision, printed as its float value
+template <>
+std::string ToString(half value) {
+  return std::to_string(HalfToFloat(value));
+}
+
 // If not possible directly: special cases for CLBlast data-types
 template <>
 std::string ToString(Layout value) {
@@ -113,6 +119,9 @@ template <> double2 ConvertArgument(const char* value) {
   auto val = static_cast<double>(std::stod(value));
   return double2{val, val};
 }
+template <> half ConvertArgument(const char* value) {
+  return FloatToHalf(static_cast<float>(std::stod(value)));
+}
 
 // This function matches patterns in the form of "-option value" or "--option value". It returns a
 // default value in case the option is not found in the argument string.
@@ -146,6 +155,7 @@ template float GetArgument<float>(const int, char **, std::string&, const std::s
 template double GetArgument<double>(const int, char **, std::string&, const std::string&, const double);
 template float2 GetArgument<float2>(const int, char **, std::string&, const std::string&, const float2);
 template double2 GetArgument<double2>(const int, char **, std::string&, const std::string&, const double2);
+template half GetArgument<half>(const int, char **, std::string&, const std::string&, const half);
 template Layout GetArgument<Layout>(const int, char **, std::string&, const std::string&, const Layout);
 template Transpose GetArgument<Transpose>(const int, char **, std::string&, const std::string&, const Transpose);
 template Side GetArgument<Side>(const int, char **, std::string&, const std::string&, const Side);
@@ -222,6 +232,16 @@ void PopulateVector(std::vector<double2> &vector) {
   for (auto &element: vector) { element.real(dist(mt)); element.imag(dist(mt)); }
 }
 
+// Specialized version of the above for half-precision: the samples are drawn in single-precision
+template <>
+void PopulateVector(std::vector<half> &vector) {
+  auto lower_limit = static_cast<float>(kTestDataLowerLimit);
+  auto upper_limit = static_cast<float>(kTestDataUpperLimit);
+  std::mt19937 mt(GetRandomSeed());
+  std::uniform_real_distribution<float> dist(lower_limit, upper_limit);
+  for (auto &element: vector) { element = FloatToHalf(dist(mt)); }
+}
+
 // =================================================================================================
 
 // Returns a scalar with a default value
@@ -242,6 +262,30 @@ double2 GetScalar() {
   return {2.0, 0.5};
 }
 
+// Specialized version of the above for half-precision
+template <>
+half GetScalar() {
+  return FloatToHalf(2.0f);
+}
+
+// =================================================================================================
+
+// Converts a double into the given data-type, for complex data-types as the real part
+template <typename T>
+T FromDouble(const double value) {
+  return static_cast<T>(value);
+}
+template float FromDouble<float>(const double);
+template double FromDouble<double>(const double);
+template float2 FromDouble<float2>(const double);
+template double2 FromDouble<double2>(const double);
+
+// Specialized version of the above for half-precision
+template <>
+half FromDouble(const double value) {
+  return FloatToHalf(static_cast<float>(value));
+}
+
 // =================================================================================================
 
 // Rounding functions performing ceiling and division operations
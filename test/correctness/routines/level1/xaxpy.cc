@@ -75,6 +75,7 @@ int main(int argc, char *argv[]) {
   clblast::RunTest<double>(argc, argv, true, "DAXPY");
   clblast::RunTest<clblast::float2>(argc, argv, true, "CAXPY");
   clblast::RunTest<clblast::double2>(argc, argv, true, "ZAXPY");
+  clblast::RunTest<clblast::half>(argc, argv, true, "HAXPY");
   return 0;
 }
 
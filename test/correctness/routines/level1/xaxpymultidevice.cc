@@ -0,0 +1,79 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the tests for the multi-device version of the Xaxpy routine. The vector
+// sizes are chosen such that the work is split unevenly over the devices, and the odd offsets
+// make sure the boundaries between the sub-buffers have to be re-aligned. Only regular tests are
+// run: the invalid-buffer tests check error codes, which are found in a different order than by
+// the single-device reference.
+//
+// =================================================================================================
+
+#include "correctness/testblas.h"
+#include "routines/level1/xaxpymultidevice.h"
+
+namespace clblast {
+// =================================================================================================
+
+// The correctness tester
+template <typename T>
+void RunTest(int argc, char *argv[], const bool silent, const std::string &name) {
+
+  // Creates a tester
+  TestBlas<T,T> tester{argc, argv, silent, name, TestXaxpyMultiDevice<T>::GetOptions(),
+                       TestXaxpyMultiDevice<T>::RunRoutine, TestXaxpyMultiDevice<T>::RunReference,
+                       TestXaxpyMultiDevice<T>::DownloadResult,
+                       TestXaxpyMultiDevice<T>::GetResultIndex,
+                       TestXaxpyMultiDevice<T>::ResultID1, TestXaxpyMultiDevice<T>::ResultID2};
+
+  // Vector sizes below, at, and above multiples of the partitioning granularity (4096), and
+  // offsets which are not a multiple of any memory alignment
+  const auto kMultiDeviceDims = std::vector<size_t>{7, 4096, 10000};
+  const auto kMultiDeviceIncrements = std::vector<size_t>{1, 2};
+  const auto kMultiDeviceOffsets = std::vector<size_t>{0, 5};
+
+  // This variable holds the arguments relevant for this routine
+  auto args = Arguments<T>{};
+
+  // Creates the arguments vector for the regular tests
+  auto regular_test_vector = std::vector<Arguments<T>>{};
+  for (auto &n: kMultiDeviceDims) { args.n = n;
+    for (auto &x_inc: kMultiDeviceIncrements) { args.x_inc = x_inc;
+      for (auto &x_offset: kMultiDeviceOffsets) { args.x_offset = x_offset;
+        for (auto &y_inc: kMultiDeviceIncrements) { args.y_inc = y_inc;
+          for (auto &y_offset: kMultiDeviceOffsets) { args.y_offset = y_offset;
+            for (auto &alpha: tester.kAlphaValues) { args.alpha = alpha;
+              args.x_size = TestXaxpyMultiDevice<T>::GetSizeX(args);
+              args.y_size = TestXaxpyMultiDevice<T>::GetSizeY(args);
+              if (args.x_size<1 || args.y_size<1) { continue; }
+              regular_test_vector.push_back(args);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // Runs the tests
+  const auto case_name = "default";
+  tester.TestRegular(regular_test_vector, case_name);
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  clblast::RunTest<float>(argc, argv, false, "SAXPY-MULTIDEVICE");
+  clblast::RunTest<double>(argc, argv, true, "DAXPY-MULTIDEVICE");
+  clblast::RunTest<clblast::float2>(argc, argv, true, "CAXPY-MULTIDEVICE");
+  clblast::RunTest<clblast::double2>(argc, argv, true, "ZAXPY-MULTIDEVICE");
+  return 0;
+}
+
+// =================================================================================================
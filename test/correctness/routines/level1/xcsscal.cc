@@ -0,0 +1,72 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the tests for the Xcsscal routine (CSSCAL and ZDSCAL).
+//
+// =================================================================================================
+
+#include "correctness/testblas.h"
+#include "routines/level1/xcsscal.h"
+
+namespace clblast {
+// =================================================================================================
+
+// The correctness tester
+template <typename T, typename U>
+void RunTest(int argc, char *argv[], const bool silent, const std::string &name) {
+
+  // Creates a tester
+  TestBlas<T,U> tester{argc, argv, silent, name, TestXcsscal<T,U>::GetOptions(),
+                       TestXcsscal<T,U>::RunRoutine, TestXcsscal<T,U>::RunReference,
+                       TestXcsscal<T,U>::DownloadResult, TestXcsscal<T,U>::GetResultIndex,
+                       TestXcsscal<T,U>::ResultID1, TestXcsscal<T,U>::ResultID2};
+
+  // This variable holds the arguments relevant for this routine
+  auto args = Arguments<U>{};
+
+  // Creates the arguments vector for the regular tests
+  auto regular_test_vector = std::vector<Arguments<U>>{};
+  for (auto &n: tester.kVectorDims) { args.n = n;
+    for (auto &x_inc: tester.kIncrements) { args.x_inc = x_inc;
+      for (auto &x_offset: tester.kOffsets) { args.x_offset = x_offset;
+        for (auto &alpha: tester.kAlphaValues) { args.alpha = alpha;
+          args.x_size = TestXcsscal<T,U>::GetSizeX(args);
+          if (args.x_size<1) { continue; }
+          regular_test_vector.push_back(args);
+        }
+      }
+    }
+  }
+
+  // Creates the arguments vector for the invalid-buffer tests
+  auto invalid_test_vector = std::vector<Arguments<U>>{};
+  args.n = tester.kBufferSize;
+  args.x_inc = 1;
+  args.x_offset = 0;
+  for (auto &x_size: tester.kVecSizes) { args.x_size = x_size;
+    invalid_test_vector.push_back(args);
+  }
+
+  // Runs the tests
+  const auto case_name = "default";
+  tester.TestRegular(regular_test_vector, case_name);
+  tester.TestInvalid(invalid_test_vector, case_name);
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  clblast::RunTest<clblast::float2,float>(argc, argv, false, "CSSCAL");
+  clblast::RunTest<clblast::double2,double>(argc, argv, true, "ZDSCAL");
+  return 0;
+}
+
+// =================================================================================================
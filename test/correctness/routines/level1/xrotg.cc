@@ -0,0 +1,53 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the tests for the Xrotg routine.
+//
+// =================================================================================================
+
+#include "correctness/testblas.h"
+#include "routines/level1/xrotg.h"
+
+namespace clblast {
+// =================================================================================================
+
+// The correctness tester
+template <typename T>
+void RunTest(int argc, char *argv[], const bool silent, const std::string &name) {
+
+  // Creates a tester
+  TestBlas<T,T> tester{argc, argv, silent, name, TestXrotg<T>::GetOptions(),
+                       TestXrotg<T>::RunRoutine, TestXrotg<T>::RunReference,
+                       TestXrotg<T>::DownloadResult, TestXrotg<T>::GetResultIndex,
+                       TestXrotg<T>::ResultID1, TestXrotg<T>::ResultID2};
+
+  // This variable holds the arguments relevant for this routine
+  auto args = Arguments<T>{};
+
+  // Creates the arguments vector for the regular tests: this routine only operates on scalars
+  auto regular_test_vector = std::vector<Arguments<T>>{};
+  args.scalar_size = 4;
+  regular_test_vector.push_back(args);
+
+  // Runs the tests
+  const auto case_name = "default";
+  tester.TestRegular(regular_test_vector, case_name);
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  clblast::RunTest<float>(argc, argv, false, "SROTG");
+  clblast::RunTest<double>(argc, argv, true, "DROTG");
+  return 0;
+}
+
+// =================================================================================================
@@ -0,0 +1,86 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the tests for the Xrotm routine.
+//
+// =================================================================================================
+
+#include "correctness/testblas.h"
+#include "routines/level1/xrotm.h"
+
+namespace clblast {
+// =================================================================================================
+
+// The correctness tester
+template <typename T>
+void RunTest(int argc, char *argv[], const bool silent, const std::string &name) {
+
+  // Creates a tester
+  TestBlas<T,T> tester{argc, argv, silent, name, TestXrotm<T>::GetOptions(),
+                       TestXrotm<T>::RunRoutine, TestXrotm<T>::RunReference,
+                       TestXrotm<T>::DownloadResult, TestXrotm<T>::GetResultIndex,
+                       TestXrotm<T>::ResultID1, TestXrotm<T>::ResultID2};
+
+  // This variable holds the arguments relevant for this routine
+  auto args = Arguments<T>{};
+
+  // The values of the flag of the parameter array, covering all forms of the matrix H
+  const auto kFlags = std::vector<T>{-2, -1, 0, 1};
+
+  // Creates the arguments vector for the regular tests
+  auto regular_test_vector = std::vector<Arguments<T>>{};
+  for (auto &flag: kFlags) { args.alpha = flag;
+    for (auto &n: tester.kVectorDims) { args.n = n;
+      for (auto &x_inc: tester.kIncrements) { args.x_inc = x_inc;
+        for (auto &x_offset: tester.kOffsets) { args.x_offset = x_offset;
+          for (auto &y_inc: tester.kIncrements) { args.y_inc = y_inc;
+            for (auto &y_offset: tester.kOffsets) { args.y_offset = y_offset;
+              args.x_size = TestXrotm<T>::GetSizeX(args);
+              args.y_size = TestXrotm<T>::GetSizeY(args);
+              args.scalar_size = 5;
+              if (args.x_size<1 || args.y_size<1) { continue; }
+              regular_test_vector.push_back(args);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // Creates the arguments vector for the invalid-buffer tests
+  auto invalid_test_vector = std::vector<Arguments<T>>{};
+  args.n = tester.kBufferSize;
+  args.x_inc = args.y_inc = 1;
+  args.x_offset = args.y_offset = 0;
+  args.alpha = static_cast<T>(-1);
+  for (auto &x_size: tester.kVecSizes) { args.x_size = x_size;
+    for (auto &y_size: tester.kVecSizes) { args.y_size = y_size;
+      for (auto &scalar_size: tester.kVecSizes) { args.scalar_size = scalar_size;
+        invalid_test_vector.push_back(args);
+      }
+    }
+  }
+
+  // Runs the tests
+  const auto case_name = "default";
+  tester.TestRegular(regular_test_vector, case_name);
+  tester.TestInvalid(invalid_test_vector, case_name);
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  clblast::RunTest<float>(argc, argv, false, "SROTM");
+  clblast::RunTest<double>(argc, argv, true, "DROTM");
+  return 0;
+}
+
+// =================================================================================================
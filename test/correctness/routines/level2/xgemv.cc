@@ -93,6 +93,7 @@ int main(int argc, char *argv[]) {
   clblast::RunTest<double>(argc, argv, true, "DGEMV");
   clblast::RunTest<clblast::float2>(argc, argv, true, "CGEMV");
   clblast::RunTest<clblast::double2>(argc, argv, true, "ZGEMV");
+  clblast::RunTest<clblast::half>(argc, argv, true, "HGEMV");
   return 0;
 }
 
@@ -0,0 +1,101 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the tests for the Xtrsv routine.
+//
+// =================================================================================================
+
+#include "correctness/testblas.h"
+#include "routines/level2/xtrsv.h"
+
+namespace clblast {
+// =================================================================================================
+
+// The correctness tester
+template <typename T>
+void RunTest(int argc, char *argv[], const bool silent, const std::string &name) {
+
+  // Makes the triangular matrix well-conditioned before running the routines
+  auto run_routine = [](const Arguments<T> &args, const Buffers &buffers, CommandQueue &queue) {
+    TestXtrsv<T>::PrepareData(args, buffers, queue);
+    return TestXtrsv<T>::RunRoutine(args, buffers, queue);
+  };
+  auto run_reference = [](const Arguments<T> &args, const Buffers &buffers, CommandQueue &queue) {
+    TestXtrsv<T>::PrepareData(args, buffers, queue);
+    return TestXtrsv<T>::RunReference(args, buffers, queue);
+  };
+
+  // Creates a tester
+  TestBlas<T,T> tester{argc, argv, silent, name, TestXtrsv<T>::GetOptions(),
+                       run_routine, run_reference,
+                       TestXtrsv<T>::DownloadResult, TestXtrsv<T>::GetResultIndex,
+                       TestXtrsv<T>::ResultID1, TestXtrsv<T>::ResultID2};
+
+  // This variable holds the arguments relevant for this routine
+  auto args = Arguments<T>{};
+
+  // Loops over the test-cases from a data-layout point of view
+  for (auto &layout: tester.kLayouts) { args.layout = layout;
+    for (auto &triangle: tester.kTriangles) { args.triangle = triangle;
+      for (auto &a_transpose: tester.kTransposes) { args.a_transpose = a_transpose;
+        for (auto &diagonal: tester.kDiagonals) { args.diagonal = diagonal;
+
+          // Creates the arguments vector for the regular tests
+          auto regular_test_vector = std::vector<Arguments<T>>{};
+          for (auto &n: tester.kMatrixVectorDims) { args.n = n;
+            for (auto &a_ld: tester.kMatrixVectorDims) { args.a_ld = a_ld;
+              for (auto &a_offset: tester.kOffsets) { args.a_offset = a_offset;
+                for (auto &x_inc: tester.kIncrements) { args.x_inc = x_inc;
+                  for (auto &x_offset: tester.kOffsets) { args.x_offset = x_offset;
+                    args.a_size = TestXtrsv<T>::GetSizeA(args);
+                    args.x_size = TestXtrsv<T>::GetSizeX(args);
+                    if (args.a_size<1 || args.x_size<1) { continue; }
+                    regular_test_vector.push_back(args);
+                  }
+                }
+              }
+            }
+          }
+
+          // Creates the arguments vector for the invalid-buffer tests
+          auto invalid_test_vector = std::vector<Arguments<T>>{};
+          args.n = tester.kBufferSize;
+          args.a_ld = tester.kBufferSize;
+          args.x_inc = 1;
+          args.a_offset = args.x_offset = 0;
+          for (auto &a_size: tester.kMatSizes) { args.a_size = a_size;
+            for (auto &x_size: tester.kVecSizes) { args.x_size = x_size;
+              invalid_test_vector.push_back(args);
+            }
+          }
+
+          // Runs the tests
+          const auto case_name = ToString(layout)+" "+ToString(triangle)+" "+
+                                 ToString(a_transpose)+" "+ToString(diagonal);
+          tester.TestRegular(regular_test_vector, case_name);
+          tester.TestInvalid(invalid_test_vector, case_name);
+        }
+      }
+    }
+  }
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  clblast::RunTest<float>(argc, argv, false, "STRSV");
+  clblast::RunTest<double>(argc, argv, true, "DTRSV");
+  clblast::RunTest<clblast::float2>(argc, argv, true, "CTRSV");
+  clblast::RunTest<clblast::double2>(argc, argv, true, "ZTRSV");
+  return 0;
+}
+
+// =================================================================================================
@@ -78,6 +78,16 @@ void RunTest(int argc, char *argv[], const bool silent, const std::string &name)
           }
         }
 
+        // As above, but with padded leading dimensions and buffers of (almost) the minimal size
+        args.a_ld = args.b_ld = args.c_ld = tester.kPaddedLeadDim;
+        for (auto &a_size: tester.kPaddedMatSizes) { args.a_size = a_size;
+          for (auto &b_size: tester.kPaddedMatSizes) { args.b_size = b_size;
+            for (auto &c_size: tester.kPaddedMatSizes) { args.c_size = c_size;
+              invalid_test_vector.push_back(args);
+            }
+          }
+        }
+
         // Runs the tests
         const auto case_name = ToString(layout)+" "+ToString(a_transpose)+" "+ToString(b_transpose);
         tester.TestRegular(regular_test_vector, case_name);
@@ -96,6 +106,7 @@ int main(int argc, char *argv[]) {
   clblast::RunTest<double>(argc, argv, true, "DGEMM");
   clblast::RunTest<clblast::float2>(argc, argv, true, "CGEMM");
   clblast::RunTest<clblast::double2>(argc, argv, true, "ZGEMM");
+  clblast::RunTest<clblast::half>(argc, argv, true, "HGEMM");
   return 0;
 }
 
@@ -0,0 +1,121 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the tests for the Xgemm routine with a fused epilogue. The matrix sizes
+// include values which are not a multiple of the kernel's tile sizes, such that the padded parts
+// of C are computed but should not read outside of the scale and bias vectors.
+//
+// =================================================================================================
+
+#include "correctness/testblas.h"
+#include "routines/level3/xgemmepilogue.h"
+
+namespace clblast {
+// =================================================================================================
+
+// Creates an epilogue with the given options. The clamp is only enabled if its range is non-empty.
+Epilogue MakeEpilogue(const EpilogueVector scale, const EpilogueVector bias,
+                      const Activation activation, const double clamp_min, const double clamp_max) {
+  auto epilogue = Epilogue{};
+  epilogue.scale = scale;
+  epilogue.bias = bias;
+  epilogue.activation = activation;
+  epilogue.clamp = (clamp_min < clamp_max);
+  epilogue.clamp_min = clamp_min;
+  epilogue.clamp_max = clamp_max;
+  return epilogue;
+}
+
+// The correctness tester
+template <typename T>
+void RunTest(int argc, char *argv[], const bool silent, const std::string &name) {
+
+  // Creates a tester
+  TestBlas<T,T> tester{argc, argv, silent, name, TestXgemmEpilogue<T>::GetOptions(),
+                       TestXgemmEpilogue<T>::RunRoutine, TestXgemmEpilogue<T>::RunReference,
+                       TestXgemmEpilogue<T>::DownloadResult, TestXgemmEpilogue<T>::GetResultIndex,
+                       TestXgemmEpilogue<T>::ResultID1, TestXgemmEpilogue<T>::ResultID2};
+
+  // The epilogues to test with, covering each option at least once
+  const auto kNone = EpilogueVector::kNone;
+  const auto kPerRow = EpilogueVector::kPerRow;
+  const auto kPerColumn = EpilogueVector::kPerColumn;
+  const auto epilogues = std::vector<std::pair<std::string, Epilogue>>{
+    {"scale-row", MakeEpilogue(kPerRow, kNone, Activation::kNone, 0.0, 0.0)},
+    {"scale-col", MakeEpilogue(kPerColumn, kNone, Activation::kNone, 0.0, 0.0)},
+    {"bias-row relu", MakeEpilogue(kNone, kPerRow, Activation::kReLU, 0.0, 0.0)},
+    {"bias-col gelu", MakeEpilogue(kNone, kPerColumn, Activation::kGELU, 0.0, 0.0)},
+    {"clamp", MakeEpilogue(kNone, kNone, Activation::kNone, -20.0, 20.0)},
+    {"all-row", MakeEpilogue(kPerRow, kPerRow, Activation::kGELU, -20.0, 20.0)},
+    {"all-mixed", MakeEpilogue(kPerColumn, kPerRow, Activation::kReLU, -20.0, 20.0)}
+  };
+
+  // Matrix sizes which are and are not a multiple of the tile sizes, and offsets for the vectors
+  const auto kEpilogueDims = std::vector<size_t>{7, 64, 65};
+  const auto kEpilogueInnerDims = std::vector<size_t>{7, 64};
+  const auto kEpilogueLeadingDim = size_t{70};
+  const auto kEpilogueVectorOffsets = std::vector<size_t>{0, 3};
+
+  // This variable holds the arguments relevant for this routine
+  auto args = Arguments<T>{};
+  args.a_ld = args.b_ld = args.c_ld = kEpilogueLeadingDim;
+
+  // Loops over the test-cases from an epilogue and data-layout point of view
+  for (auto &epilogue: epilogues) { TestXgemmEpilogue<T>::CurrentEpilogue() = epilogue.second;
+    for (auto &layout: tester.kLayouts) { args.layout = layout;
+      for (auto &a_transpose: tester.kTransposes) { args.a_transpose = a_transpose;
+        for (auto &b_transpose: tester.kTransposes) { args.b_transpose = b_transpose;
+
+          // Creates the arguments vector for the regular tests
+          auto regular_test_vector = std::vector<Arguments<T>>{};
+          for (auto &m: kEpilogueDims) { args.m = m;
+            for (auto &n: kEpilogueDims) { args.n = n;
+              for (auto &k: kEpilogueInnerDims) { args.k = k;
+                for (auto &c_offset: tester.kOffsets) { args.c_offset = c_offset;
+                  for (auto &vector_offset: kEpilogueVectorOffsets) {
+                    args.x_offset = vector_offset;
+                    args.y_offset = vector_offset;
+                    for (auto &alpha: tester.kAlphaValues) { args.alpha = alpha;
+                      for (auto &beta: tester.kBetaValues) { args.beta = beta;
+                        args.a_size = TestXgemmEpilogue<T>::GetSizeA(args);
+                        args.b_size = TestXgemmEpilogue<T>::GetSizeB(args);
+                        args.c_size = TestXgemmEpilogue<T>::GetSizeC(args);
+                        args.x_size = TestXgemmEpilogue<T>::GetSizeX(args);
+                        args.y_size = TestXgemmEpilogue<T>::GetSizeY(args);
+                        if (args.a_size<1 || args.b_size<1 || args.c_size<1) { continue; }
+                        regular_test_vector.push_back(args);
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+
+          // Runs the tests
+          const auto case_name = epilogue.first+" "+ToString(layout)+" "+
+                                 ToString(a_transpose)+" "+ToString(b_transpose);
+          tester.TestRegular(regular_test_vector, case_name);
+        }
+      }
+    }
+  }
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  clblast::RunTest<float>(argc, argv, false, "SGEMM-EPILOGUE");
+  clblast::RunTest<double>(argc, argv, true, "DGEMM-EPILOGUE");
+  clblast::RunTest<clblast::half>(argc, argv, true, "HGEMM-EPILOGUE");
+  return 0;
+}
+
+// =================================================================================================
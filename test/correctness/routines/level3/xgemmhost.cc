@@ -0,0 +1,110 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the tests for the host-memory version of the Xgemm routine. The public
+// routine is tested, as well as each of its versions separately: the zero-copy and the pipelined
+// versions and the host backend. The matrix sizes are chosen such that the pipelined version splits
+// the work into more than two chunks along either M or N. Only regular tests are run: the
+// invalid-buffer tests do not apply, since the routine operates on host memory.
+//
+// =================================================================================================
+
+#include <utility>
+
+#include "correctness/testblas.h"
+#include "routines/level3/xgemmhost.h"
+
+namespace clblast {
+// =================================================================================================
+
+// The correctness tester for one version of the routine
+template <typename T>
+void RunTest(int argc, char *argv[], const bool silent, const std::string &name,
+             const typename TestBlas<T,T>::Routine run_routine) {
+
+  // Creates a tester
+  TestBlas<T,T> tester{argc, argv, silent, name, TestXgemmHost<T>::GetOptions(),
+                       run_routine, TestXgemmHost<T>::RunReference,
+                       TestXgemmHost<T>::DownloadResult, TestXgemmHost<T>::GetResultIndex,
+                       TestXgemmHost<T>::ResultID1, TestXgemmHost<T>::ResultID2};
+
+  // Sizes of M and N giving a single chunk and three chunks (of at least 256 rows or columns each)
+  // along either dimension. Only one of them is large and the leading dimensions are only slightly
+  // larger than the matrices, such that all matrices fit in the tester's input data.
+  const auto kHostSizes = std::vector<std::pair<size_t,size_t>>{{7, 7}, {520, 7}, {7, 520}};
+  const auto kHostInnerDims = std::vector<size_t>{7, 64};
+  const auto kHostLeadingDimPadding = size_t{3};
+
+  // This variable holds the arguments relevant for this routine
+  auto args = Arguments<T>{};
+
+  // Loops over the test-cases from a data-layout point of view
+  for (auto &layout: tester.kLayouts) { args.layout = layout;
+    for (auto &a_transpose: tester.kTransposes) { args.a_transpose = a_transpose;
+      for (auto &b_transpose: tester.kTransposes) { args.b_transpose = b_transpose;
+
+        // Creates the arguments vector for the regular tests
+        auto regular_test_vector = std::vector<Arguments<T>>{};
+        for (auto &sizes: kHostSizes) { args.m = sizes.first; args.n = sizes.second;
+          for (auto &k: kHostInnerDims) { args.k = k;
+            auto a_rotated = (layout == Layout::kColMajor && a_transpose != Transpose::kNo) ||
+                             (layout == Layout::kRowMajor && a_transpose == Transpose::kNo);
+            auto b_rotated = (layout == Layout::kColMajor && b_transpose != Transpose::kNo) ||
+                             (layout == Layout::kRowMajor && b_transpose == Transpose::kNo);
+            auto c_rotated = (layout == Layout::kRowMajor);
+            args.a_ld = ((a_rotated) ? k : args.m) + kHostLeadingDimPadding;
+            args.b_ld = ((b_rotated) ? args.n : k) + kHostLeadingDimPadding;
+            args.c_ld = ((c_rotated) ? args.n : args.m) + kHostLeadingDimPadding;
+            for (auto &a_offset: tester.kOffsets) { args.a_offset = a_offset;
+              for (auto &b_offset: tester.kOffsets) { args.b_offset = b_offset;
+                for (auto &c_offset: tester.kOffsets) { args.c_offset = c_offset;
+                  for (auto &alpha: tester.kAlphaValues) { args.alpha = alpha;
+                    for (auto &beta: tester.kBetaValues) { args.beta = beta;
+                      args.a_size = TestXgemmHost<T>::GetSizeA(args);
+                      args.b_size = TestXgemmHost<T>::GetSizeB(args);
+                      args.c_size = TestXgemmHost<T>::GetSizeC(args);
+                      if (args.a_size<1 || args.b_size<1 || args.c_size<1) { continue; }
+                      regular_test_vector.push_back(args);
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+
+        // Runs the tests
+        const auto case_name = ToString(layout)+" "+ToString(a_transpose)+" "+ToString(b_transpose);
+        tester.TestRegular(regular_test_vector, case_name);
+      }
+    }
+  }
+}
+
+// Tests the public routine and each of its versions
+template <typename T>
+void RunTests(int argc, char *argv[], const bool silent, const std::string &name) {
+  RunTest<T>(argc, argv, silent, name, TestXgemmHost<T>::RunRoutine);
+  RunTest<T>(argc, argv, true, name+"-ZEROCOPY", TestXgemmHost<T>::RunRoutineZeroCopy);
+  RunTest<T>(argc, argv, true, name+"-PIPELINED", TestXgemmHost<T>::RunRoutinePipelined);
+  RunTest<T>(argc, argv, true, name+"-NODEVICE", TestXgemmHost<T>::RunRoutineWithoutDevice);
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  clblast::RunTests<float>(argc, argv, false, "SGEMMHOST");
+  clblast::RunTests<double>(argc, argv, true, "DGEMMHOST");
+  clblast::RunTests<clblast::float2>(argc, argv, true, "CGEMMHOST");
+  clblast::RunTests<clblast::double2>(argc, argv, true, "ZGEMMHOST");
+  return 0;
+}
+
+// =================================================================================================
@@ -0,0 +1,91 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the tests for the multi-device version of the Xgemm routine. The matrix
+// sizes are chosen such that the columns of C are split unevenly over the devices. Only regular
+// tests are run: the invalid-buffer tests check error codes, which are found in a different order
+// than by the single-device reference.
+//
+// =================================================================================================
+
+#include "correctness/testblas.h"
+#include "routines/level3/xgemmmultidevice.h"
+
+namespace clblast {
+// =================================================================================================
+
+// The correctness tester
+template <typename T>
+void RunTest(int argc, char *argv[], const bool silent, const std::string &name) {
+
+  // Creates a tester
+  TestBlas<T,T> tester{argc, argv, silent, name, TestXgemmMultiDevice<T>::GetOptions(),
+                       TestXgemmMultiDevice<T>::RunRoutine, TestXgemmMultiDevice<T>::RunReference,
+                       TestXgemmMultiDevice<T>::DownloadResult,
+                       TestXgemmMultiDevice<T>::GetResultIndex,
+                       TestXgemmMultiDevice<T>::ResultID1, TestXgemmMultiDevice<T>::ResultID2};
+
+  // Matrix sizes below, at, and above multiples of the partitioning granularity (64)
+  const auto kMultiDeviceDims = std::vector<size_t>{7, 130, 200};
+  const auto kMultiDeviceInnerDims = std::vector<size_t>{7, 64};
+  const auto kMultiDeviceLeadingDim = size_t{210};
+
+  // This variable holds the arguments relevant for this routine
+  auto args = Arguments<T>{};
+  args.a_ld = args.b_ld = args.c_ld = kMultiDeviceLeadingDim;
+
+  // Loops over the test-cases from a data-layout point of view
+  for (auto &layout: tester.kLayouts) { args.layout = layout;
+    for (auto &a_transpose: tester.kTransposes) { args.a_transpose = a_transpose;
+      for (auto &b_transpose: tester.kTransposes) { args.b_transpose = b_transpose;
+
+        // Creates the arguments vector for the regular tests
+        auto regular_test_vector = std::vector<Arguments<T>>{};
+        for (auto &m: kMultiDeviceDims) { args.m = m;
+          for (auto &n: kMultiDeviceDims) { args.n = n;
+            for (auto &k: kMultiDeviceInnerDims) { args.k = k;
+              for (auto &a_offset: tester.kOffsets) { args.a_offset = a_offset;
+                for (auto &b_offset: tester.kOffsets) { args.b_offset = b_offset;
+                  for (auto &c_offset: tester.kOffsets) { args.c_offset = c_offset;
+                    for (auto &alpha: tester.kAlphaValues) { args.alpha = alpha;
+                      for (auto &beta: tester.kBetaValues) { args.beta = beta;
+                        args.a_size = TestXgemmMultiDevice<T>::GetSizeA(args);
+                        args.b_size = TestXgemmMultiDevice<T>::GetSizeB(args);
+                        args.c_size = TestXgemmMultiDevice<T>::GetSizeC(args);
+                        if (args.a_size<1 || args.b_size<1 || args.c_size<1) { continue; }
+                        regular_test_vector.push_back(args);
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+
+        // Runs the tests
+        const auto case_name = ToString(layout)+" "+ToString(a_transpose)+" "+ToString(b_transpose);
+        tester.TestRegular(regular_test_vector, case_name);
+      }
+    }
+  }
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  clblast::RunTest<float>(argc, argv, false, "SGEMM-MULTIDEVICE");
+  clblast::RunTest<double>(argc, argv, true, "DGEMM-MULTIDEVICE");
+  clblast::RunTest<clblast::float2>(argc, argv, true, "CGEMM-MULTIDEVICE");
+  clblast::RunTest<clblast::double2>(argc, argv, true, "ZGEMM-MULTIDEVICE");
+  return 0;
+}
+
+// =================================================================================================
@@ -19,6 +19,7 @@ namespace clblast {
 // =================================================================================================
 
 // The transpose-options to test with (data-type dependent)
+template <> const std::vector<Transpose> TestBlas<half,half>::kTransposes = {Transpose::kNo, Transpose::kYes};
 template <> const std::vector<Transpose> TestBlas<float,float>::kTransposes = {Transpose::kNo, Transpose::kYes};
 template <> const std::vector<Transpose> TestBlas<double,double>::kTransposes = {Transpose::kNo, Transpose::kYes};
 template <> const std::vector<Transpose> TestBlas<float2,float2>::kTransposes = {Transpose::kNo, Transpose::kYes, Transpose::kConjugate};
@@ -57,11 +58,13 @@ TestBlas<T,U>::TestBlas(int argc, char *argv[], const bool silent,
   a_source_.resize(std::max(max_mat, max_matvec)*std::max(max_ld, max_matvec) + max_offset);
   b_source_.resize(std::max(max_mat, max_matvec)*std::max(max_ld, max_matvec) + max_offset);
   c_source_.resize(std::max(max_mat, max_matvec)*std::max(max_ld, max_matvec) + max_offset);
+  scalar_source_.resize(max_offset + kMaxScalars);
   PopulateVector(x_source_);
   PopulateVector(y_source_);
   PopulateVector(a_source_);
   PopulateVector(b_source_);
   PopulateVector(c_source_);
+  PopulateVector(scalar_source_);
 }
 
 // ===============================================================================================
@@ -81,12 +84,14 @@ void TestBlas<T,U>::TestRegular(std::vector<Arguments<U>> &test_vector, const st
     auto a_mat1 = Buffer(context_, CL_MEM_READ_WRITE, args.a_size*sizeof(T));
     auto b_mat1 = Buffer(context_, CL_MEM_READ_WRITE, args.b_size*sizeof(T));
     auto c_mat1 = Buffer(context_, CL_MEM_READ_WRITE, args.c_size*sizeof(T));
+    auto scalar1 = Buffer(context_, CL_MEM_READ_WRITE, args.scalar_size*sizeof(T));
     x_vec1.WriteBuffer(queue_, args.x_size*sizeof(T), x_source_);
     y_vec1.WriteBuffer(queue_, args.y_size*sizeof(T), y_source_);
     a_mat1.WriteBuffer(queue_, args.a_size*sizeof(T), a_source_);
     b_mat1.WriteBuffer(queue_, args.b_size*sizeof(T), b_source_);
     c_mat1.WriteBuffer(queue_, args.c_size*sizeof(T), c_source_);
-    auto buffers1 = Buffers{x_vec1, y_vec1, a_mat1, b_mat1, c_mat1};
+    scalar1.WriteBuffer(queue_, args.scalar_size*sizeof(T), scalar_source_);
+    auto buffers1 = Buffers{x_vec1, y_vec1, a_mat1, b_mat1, c_mat1, scalar1};
     auto status1 = run_reference_(args, buffers1, queue_);
 
     // Runs the CLBlast code
@@ -95,12 +100,14 @@ void TestBlas<T,U>::TestRegular(std::vector<Arguments<U>> &test_vector, const st
     auto a_mat2 = Buffer(context_, CL_MEM_READ_WRITE, args.a_size*sizeof(T));
     auto b_mat2 = Buffer(context_, CL_MEM_READ_WRITE, args.b_size*sizeof(T));
     auto c_mat2 = Buffer(context_, CL_MEM_READ_WRITE, args.c_size*sizeof(T));
+    auto scalar2 = Buffer(context_, CL_MEM_READ_WRITE, args.scalar_size*sizeof(T));
     x_vec2.WriteBuffer(queue_, args.x_size*sizeof(T), x_source_);
     y_vec2.WriteBuffer(queue_, args.y_size*sizeof(T), y_source_);
     a_mat2.WriteBuffer(queue_, args.a_size*sizeof(T), a_source_);
     b_mat2.WriteBuffer(queue_, args.b_size*sizeof(T), b_source_);
     c_mat2.WriteBuffer(queue_, args.c_size*sizeof(T), c_source_);
-    auto buffers2 = Buffers{x_vec2, y_vec2, a_mat2, b_mat2, c_mat2};
+    scalar2.WriteBuffer(queue_, args.scalar_size*sizeof(T), scalar_source_);
+    auto buffers2 = Buffers{x_vec2, y_vec2, a_mat2, b_mat2, c_mat2, scalar2};
     auto status2 = run_routine_(args, buffers2, queue_);
 
     // Tests for equality of the two status codes
@@ -149,25 +156,33 @@ void TestBlas<T,U>::TestInvalid(std::vector<Arguments<U>> &test_vector, const st
     auto a1 = clCreateBuffer(context_(), CL_MEM_READ_WRITE, args.a_size*sizeof(T), nullptr,nullptr);
     auto b1 = clCreateBuffer(context_(), CL_MEM_READ_WRITE, args.b_size*sizeof(T), nullptr,nullptr);
     auto c1 = clCreateBuffer(context_(), CL_MEM_READ_WRITE, args.c_size*sizeof(T), nullptr,nullptr);
+    auto s1 = clCreateBuffer(context_(), CL_MEM_READ_WRITE, args.scalar_size*sizeof(T), nullptr,
+                             nullptr);
     auto x_vec1 = Buffer(x1);
     auto y_vec1 = Buffer(y1);
     auto a_mat1 = Buffer(a1);
     auto b_mat1 = Buffer(b1);
     auto c_mat1 = Buffer(c1);
+    auto scalar1 = Buffer(s1);
     auto x2 = clCreateBuffer(context_(), CL_MEM_READ_WRITE, args.x_size*sizeof(T), nullptr,nullptr);
     auto y2 = clCreateBuffer(context_(), CL_MEM_READ_WRITE, args.y_size*sizeof(T), nullptr,nullptr);
     auto a2 = clCreateBuffer(context_(), CL_MEM_READ_WRITE, args.a_size*sizeof(T), nullptr,nullptr);
     auto b2 = clCreateBuffer(context_(), CL_MEM_READ_WRITE, args.b_size*sizeof(T), nullptr,nullptr);
     auto c2 = clCreateBuffer(context_(), CL_MEM_READ_WRITE, args.c_size*sizeof(T), nullptr,nullptr);
+    auto s2 = clCreateBuffer(context_(), CL_MEM_READ_WRITE, args.scalar_size*sizeof(T), nullptr,
+                             nullptr);
     auto x_vec2 = Buffer(x2);
     auto y_vec2 = Buffer(y2);
     auto a_mat2 = Buffer(a2);
     auto b_mat2 = Buffer(b2);
     auto c_mat2 = Buffer(c2);
+    auto scalar2 = Buffer(s2);
 
     // Runs the two routines
-    auto status1 = run_reference_(args, Buffers{x_vec1, y_vec1, a_mat1, b_mat1, c_mat1}, queue_);
-    auto status2 = run_routine_(args, Buffers{x_vec2, y_vec2, a_mat2, b_mat2, c_mat2}, queue_);
+    auto buffers1 = Buffers{x_vec1, y_vec1, a_mat1, b_mat1, c_mat1, scalar1};
+    auto buffers2 = Buffers{x_vec2, y_vec2, a_mat2, b_mat2, c_mat2, scalar2};
+    auto status1 = run_reference_(args, buffers1, queue_);
+    auto status2 = run_routine_(args, buffers2, queue_);
 
     // Tests for equality of the two status codes
     TestErrorCodes(status1, status2, args);
@@ -178,6 +193,7 @@ void TestBlas<T,U>::TestInvalid(std::vector<Arguments<U>> &test_vector, const st
 // =================================================================================================
 
 // Compiles the templated class
+template class TestBlas<half, half>;
 template class TestBlas<float, float>;
 template class TestBlas<double, double>;
 template class TestBlas<float2, float2>;
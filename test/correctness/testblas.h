@@ -48,9 +48,11 @@ class TestBlas: public Tester<T,U> {
   const std::vector<size_t> kIncrements = { 1, 2, 7 };
   const std::vector<size_t> kMatrixDims = { 7, 64 };
   const std::vector<size_t> kMatrixVectorDims = { 61, 512 };
+  const std::vector<size_t> kBandWidths = { 0, 17, 70 };
   const std::vector<size_t> kOffsets = GetOffsets();
   const std::vector<U> kAlphaValues = GetExampleScalars<U>(full_test_);
   const std::vector<U> kBetaValues = GetExampleScalars<U>(full_test_);
+  const size_t kMaxScalars = 9; // The maximum number of scalars in the scalar buffer (e.g. ROTMG)
 
   // Test settings for the invalid tests
   const std::vector<size_t> kInvalidIncrements = { 0, 1 };
@@ -58,6 +60,13 @@ class TestBlas: public Tester<T,U> {
   const std::vector<size_t> kMatSizes = {0, kBufferSize*kBufferSize-1, kBufferSize*kBufferSize};
   const std::vector<size_t> kVecSizes = {0, kBufferSize - 1, kBufferSize};
 
+  // Test settings for the invalid tests with a padded leading dimension: the last column (or row)
+  // of a minimal buffer only holds the kBufferSize elements of the matrix, not a full leading
+  // dimension
+  const size_t kPaddedLeadDim = 2*kBufferSize;
+  const size_t kMinPaddedSize = kPaddedLeadDim*(kBufferSize - 1) + kBufferSize;
+  const std::vector<size_t> kPaddedMatSizes = {kMinPaddedSize - 1, kMinPaddedSize};
+
   // The layout/transpose/triangle options to test with
   const std::vector<Layout> kLayouts = {Layout::kRowMajor, Layout::kColMajor};
   const std::vector<Triangle> kTriangles = {Triangle::kUpper, Triangle::kLower};
@@ -89,6 +98,7 @@ class TestBlas: public Tester<T,U> {
   std::vector<T> a_source_;
   std::vector<T> b_source_;
   std::vector<T> c_source_;
+  std::vector<T> scalar_source_;
   
   // The routine-specific functions passed to the tester
   Routine run_routine_;
@@ -17,6 +17,7 @@
 #include <vector>
 #include <iostream>
 #include <cmath>
+#include <cstdlib>
 
 namespace clblast {
 // =================================================================================================
@@ -42,11 +43,26 @@ Tester<T,U>::Tester(int argc, char *argv[], const bool silent,
     tests_failed_{0},
     options_{options} {
 
+  // Disables the host backend by default, such that small problems also run the OpenCL kernels on
+  // CPUs and integrated GPUs. In host-backend mode it is used instead for all problem sizes, such
+  // that the host implementations are tested against the reference. This requires a device on
+  // which the host backend is used: a CPU or a device with host-unified memory.
+  auto host_backend = CheckArgument(argc, argv, help_, kArgHostBackend);
+  if (host_backend) { setenv("CLBLAST_HOST_THRESHOLD", "1000000000000", 1); }
+  else { setenv("CLBLAST_HOST_THRESHOLD", "0", 0); }
+
   // Prints the help message (command-line arguments)
   if (!silent) { fprintf(stdout, "\n* %s\n", help_.c_str()); }
 
   // Prints the header
   fprintf(stdout, "* Running on OpenCL device '%s'.\n", device_.Name().c_str());
+  if (host_backend) {
+    auto host_device = (device_.Type() == CL_DEVICE_TYPE_CPU) || device_.HostUnifiedMemory();
+    fprintf(stdout, "* %s%s%s\n", (host_device) ? kPrintMessage.c_str() : kPrintWarning.c_str(),
+            (host_device) ? "Testing the host backend" :
+                            "Host backend not used on this device: testing the kernels instead",
+            kPrintEnd.c_str());
+  }
   fprintf(stdout, "* Starting tests for the %s'%s'%s routine.",
           kPrintMessage.c_str(), name.c_str(), kPrintEnd.c_str());
 
@@ -132,6 +148,8 @@ void Tester<T,U>::TestEnd() {
       if (o == kArgM)        { fprintf(stdout, "%s=%lu ", kArgM, entry.args.m); }
       if (o == kArgN)        { fprintf(stdout, "%s=%lu ", kArgN, entry.args.n); }
       if (o == kArgK)        { fprintf(stdout, "%s=%lu ", kArgK, entry.args.k); }
+      if (o == kArgKL)       { fprintf(stdout, "%s=%lu ", kArgKL, entry.args.kl); }
+      if (o == kArgKU)       { fprintf(stdout, "%s=%lu ", kArgKU, entry.args.ku); }
       if (o == kArgLayout)   { fprintf(stdout, "%s=%d ", kArgLayout, entry.args.layout);}
       if (o == kArgATransp)  { fprintf(stdout, "%s=%d ", kArgATransp, entry.args.a_transpose);}
       if (o == kArgBTransp)  { fprintf(stdout, "%s=%d ", kArgBTransp, entry.args.b_transpose);}
@@ -148,6 +166,10 @@ void Tester<T,U>::TestEnd() {
       if (o == kArgAOffset)  { fprintf(stdout, "%s=%lu ", kArgAOffset, entry.args.a_offset);}
       if (o == kArgBOffset)  { fprintf(stdout, "%s=%lu ", kArgBOffset, entry.args.b_offset);}
       if (o == kArgCOffset)  { fprintf(stdout, "%s=%lu ", kArgCOffset, entry.args.c_offset);}
+      if (o == kArgDotOffset) { fprintf(stdout, "%s=%lu ", kArgDotOffset, entry.args.dot_offset);}
+      if (o == kArgNrm2Offset) { fprintf(stdout, "%s=%lu ", kArgNrm2Offset, entry.args.nrm2_offset);}
+      if (o == kArgAsumOffset) { fprintf(stdout, "%s=%lu ", kArgAsumOffset, entry.args.asum_offset);}
+      if (o == kArgImaxOffset) { fprintf(stdout, "%s=%lu ", kArgImaxOffset, entry.args.imax_offset);}
     }
     fprintf(stdout, "\n");
   }
@@ -312,10 +334,41 @@ bool TestSimilarity(const double2 val1, const double2 val2) {
   return (real && imag);
 }
 
+// Specialisation for the half-precision data-type, compared in single-precision. Both the rounding
+// of the data itself and the accumulation in half-precision require larger error margins.
+template <>
+bool TestSimilarity(const half val1, const half val2) {
+  const auto value1 = HalfToFloat(val1);
+  const auto value2 = HalfToFloat(val2);
+  const auto difference = std::fabs(value1 - value2);
+
+  // Set the allowed error margin for half-precision comparisons
+  constexpr auto kErrorMarginRelative = 0.08f;
+  constexpr auto kErrorMarginAbsolute = 0.15f;
+
+  // Shortcut, handles infinities
+  if (value1 == value2) {
+    return true;
+  }
+  // The values are zero or very small: the relative error is less meaningful
+  else if (value1 == 0 || value2 == 0 || difference < kErrorMarginAbsolute) {
+    return (difference < kErrorMarginAbsolute);
+  }
+  // Use relative error
+  else {
+    const auto absolute_sum = std::fabs(value1) + std::fabs(value2);
+    return (difference / absolute_sum) < kErrorMarginRelative;
+  }
+}
+
 // =================================================================================================
 
 // Retrieves a list of example scalar values, used for the alpha and beta arguments for the various
 // routines. This function is specialised for the different data-types.
+template <> const std::vector<half> GetExampleScalars(const bool full_test) {
+  if (full_test) { return {FloatToHalf(0.0f), FloatToHalf(1.0f), FloatToHalf(3.14f)}; }
+  else { return {FloatToHalf(3.14f)}; }
+}
 template <> const std::vector<float> GetExampleScalars(const bool full_test) {
   if (full_test) { return {0.0f, 1.0f, 3.14f}; }
   else { return {3.14f}; }
@@ -336,6 +389,10 @@ template <> const std::vector<double2> GetExampleScalars(const bool full_test) {
 // =================================================================================================
 
 // Returns false is this precision is not supported by the device
+template <> bool PrecisionSupported<half>(const Device &device) {
+  auto extensions = device.Extensions();
+  return (extensions.find(kKhronosHalfPrecision) == std::string::npos) ? false : true;
+}
 template <> bool PrecisionSupported<float>(const Device &) { return true; }
 template <> bool PrecisionSupported<float2>(const Device &) { return true; }
 template <> bool PrecisionSupported<double>(const Device &device) {
@@ -350,6 +407,7 @@ template <> bool PrecisionSupported<double2>(const Device &device) {
 // =================================================================================================
 
 // Compiles the templated class
+template class Tester<half, half>;
 template class Tester<float, float>;
 template class Tester<double, double>;
 template class Tester<float2, float2>;
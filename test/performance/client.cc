@@ -51,6 +51,8 @@ Arguments<U> Client<T,U>::ParseArguments(int argc, char *argv[], const GetMetric
     if (o == kArgM) { args.m  = GetArgument(argc, argv, help, kArgM, 512UL); }
     if (o == kArgN) { args.n  = GetArgument(argc, argv, help, kArgN, 512UL); }
     if (o == kArgK) { args.k  = GetArgument(argc, argv, help, kArgK, 512UL); }
+    if (o == kArgKL) { args.kl = GetArgument(argc, argv, help, kArgKL, 32UL); }
+    if (o == kArgKU) { args.ku = GetArgument(argc, argv, help, kArgKU, 32UL); }
 
     // Data-layouts
     if (o == kArgLayout)   { args.layout      = GetArgument(argc, argv, help, kArgLayout, Layout::kRowMajor); }
@@ -74,6 +76,12 @@ Arguments<U> Client<T,U>::ParseArguments(int argc, char *argv[], const GetMetric
     if (o == kArgBOffset)  { args.b_offset = GetArgument(argc, argv, help, kArgBOffset, size_t{0}); }
     if (o == kArgCOffset)  { args.c_offset = GetArgument(argc, argv, help, kArgCOffset, size_t{0}); }
 
+    // Scalar result arguments
+    if (o == kArgDotOffset) { args.dot_offset = GetArgument(argc, argv, help, kArgDotOffset, size_t{0}); }
+    if (o == kArgNrm2Offset) { args.nrm2_offset = GetArgument(argc, argv, help, kArgNrm2Offset, size_t{0}); }
+    if (o == kArgAsumOffset) { args.asum_offset = GetArgument(argc, argv, help, kArgAsumOffset, size_t{0}); }
+    if (o == kArgImaxOffset) { args.imax_offset = GetArgument(argc, argv, help, kArgImaxOffset, size_t{0}); }
+
     // Scalar values 
     if (o == kArgAlpha) { args.alpha = GetArgument(argc, argv, help, kArgAlpha, GetScalar<U>()); }
     if (o == kArgBeta)  { args.beta  = GetArgument(argc, argv, help, kArgBeta, GetScalar<U>()); }
@@ -128,11 +136,13 @@ void Client<T,U>::PerformanceTest(Arguments<U> &args, const SetMetric set_sizes)
     std::vector<T> a_source(args.a_size);
     std::vector<T> b_source(args.b_size);
     std::vector<T> c_source(args.c_size);
+    std::vector<T> scalar_source(args.scalar_size);
     PopulateVector(x_source);
     PopulateVector(y_source);
     PopulateVector(a_source);
     PopulateVector(b_source);
     PopulateVector(c_source);
+    PopulateVector(scalar_source);
 
     // Creates the matrices on the device
     auto x_vec = Buffer(context, CL_MEM_READ_WRITE, args.x_size*sizeof(T));
@@ -140,12 +150,14 @@ void Client<T,U>::PerformanceTest(Arguments<U> &args, const SetMetric set_sizes)
     auto a_mat = Buffer(context, CL_MEM_READ_WRITE, args.a_size*sizeof(T));
     auto b_mat = Buffer(context, CL_MEM_READ_WRITE, args.b_size*sizeof(T));
     auto c_mat = Buffer(context, CL_MEM_READ_WRITE, args.c_size*sizeof(T));
+    auto scalar = Buffer(context, CL_MEM_READ_WRITE, args.scalar_size*sizeof(T));
     x_vec.WriteBuffer(queue, args.x_size*sizeof(T), x_source);
     y_vec.WriteBuffer(queue, args.y_size*sizeof(T), y_source);
     a_mat.WriteBuffer(queue, args.a_size*sizeof(T), a_source);
     b_mat.WriteBuffer(queue, args.b_size*sizeof(T), b_source);
     c_mat.WriteBuffer(queue, args.c_size*sizeof(T), c_source);
-    auto buffers = Buffers{x_vec, y_vec, a_mat, b_mat, c_mat};
+    scalar.WriteBuffer(queue, args.scalar_size*sizeof(T), scalar_source);
+    auto buffers = Buffers{x_vec, y_vec, a_mat, b_mat, c_mat, scalar};
 
     // Runs the routines and collects the timings
     auto ms_clblast = TimedExecution(args.num_runs, args, buffers, queue, run_routine_, "CLBlast");
@@ -220,6 +232,8 @@ void Client<T,U>::PrintTableRow(const Arguments<U>& args, const double ms_clblas
     if      (o == kArgM) {        integers.push_back(args.m); }
     if      (o == kArgN) {        integers.push_back(args.n); }
     else if (o == kArgK) {        integers.push_back(args.k); }
+    else if (o == kArgKL) {       integers.push_back(args.kl); }
+    else if (o == kArgKU) {       integers.push_back(args.ku); }
     else if (o == kArgLayout) {   integers.push_back(static_cast<size_t>(args.layout)); }
     else if (o == kArgSide) {     integers.push_back(static_cast<size_t>(args.side)); }
     else if (o == kArgTriangle) { integers.push_back(static_cast<size_t>(args.triangle)); }
@@ -236,6 +250,10 @@ void Client<T,U>::PrintTableRow(const Arguments<U>& args, const double ms_clblas
     else if (o == kArgAOffset) {  integers.push_back(args.a_offset); }
     else if (o == kArgBOffset) {  integers.push_back(args.b_offset); }
     else if (o == kArgCOffset) {  integers.push_back(args.c_offset); }
+    else if (o == kArgDotOffset) { integers.push_back(args.dot_offset); }
+    else if (o == kArgNrm2Offset) { integers.push_back(args.nrm2_offset); }
+    else if (o == kArgAsumOffset) { integers.push_back(args.asum_offset); }
+    else if (o == kArgImaxOffset) { integers.push_back(args.imax_offset); }
   }
   auto strings = std::vector<std::string>{};
   for (auto &o: options_) {
@@ -276,6 +294,7 @@ void Client<T,U>::PrintTableRow(const Arguments<U>& args, const double ms_clblas
 // =================================================================================================
 
 // Compiles the templated class
+template class Client<half,half>;
 template class Client<float,float>;
 template class Client<double,double>;
 template class Client<float2,float2>;
@@ -0,0 +1,93 @@
+
+# ==================================================================================================
+# This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+# project uses a tab-size of two spaces and a max-width of 100 characters per line.
+#
+# Author(s):
+#   Cedric Nugteren <www.cedricnugteren.nl>
+#
+# This file implements the performance script for the Xtbmv routine
+#
+# ==================================================================================================
+
+# Includes the common functions
+args <- commandArgs(trailingOnly = FALSE)
+thisfile <- (normalizePath(sub("--file=", "", args[grep("--file=", args)])))
+source(file.path(dirname(thisfile), "common.r"))
+
+# ==================================================================================================
+
+# Settings
+routine_name <- "xtbmv"
+parameters <- c("-n","-k","-incx","-layout","-triangle","-transA",
+                "-num_steps","-step","-runs","-precision")
+precision <- 32
+
+# Sets the names of the test-cases
+test_names <- list(
+  "multiples of 256",
+  "multiples of 256 (+1)",
+  "around n=2K",
+  "layouts, triangles and transposes (n=2K)",
+  "strides (n=2K)",
+  "band widths (n=2K)"
+)
+
+# Defines the test-cases
+test_values <- list(
+  list(c(256, 32, 1, 1, 0, 0, 16, 256, num_runs, precision)),
+  list(c(256+1, 32, 1, 1, 0, 0, 16, 256, num_runs, precision)),
+  list(c(2*kilo, 32, 1, 1, 0, 0, 16, 1, num_runs, precision)),
+  list(
+    c(2*kilo, 32, 1, 0, 0, 0, 1, 0, num_runs, precision),
+    c(2*kilo, 32, 1, 0, 0, 1, 1, 0, num_runs, precision),
+    c(2*kilo, 32, 1, 0, 1, 0, 1, 0, num_runs, precision),
+    c(2*kilo, 32, 1, 0, 1, 1, 1, 0, num_runs, precision),
+    c(2*kilo, 32, 1, 1, 0, 0, 1, 0, num_runs, precision),
+    c(2*kilo, 32, 1, 1, 0, 1, 1, 0, num_runs, precision),
+    c(2*kilo, 32, 1, 1, 1, 0, 1, 0, num_runs, precision),
+    c(2*kilo, 32, 1, 1, 1, 1, 1, 0, num_runs, precision)
+  ),
+  list(
+    c(2*kilo, 32, 1, 1, 0, 0, 1, 0, num_runs, precision),
+    c(2*kilo, 32, 2, 1, 0, 0, 1, 0, num_runs, precision),
+    c(2*kilo, 32, 4, 1, 0, 0, 1, 0, num_runs, precision),
+    c(2*kilo, 32, 8, 1, 0, 0, 1, 0, num_runs, precision)
+  ),
+  list(
+    c(2*kilo, 1, 1, 1, 0, 0, 1, 0, num_runs, precision),
+    c(2*kilo, 8, 1, 1, 0, 0, 1, 0, num_runs, precision),
+    c(2*kilo, 32, 1, 1, 0, 0, 1, 0, num_runs, precision),
+    c(2*kilo, 128, 1, 1, 0, 0, 1, 0, num_runs, precision),
+    c(2*kilo, 512, 1, 1, 0, 0, 1, 0, num_runs, precision)
+  )
+)
+
+# Defines the x-labels corresponding to the test-cases
+test_xlabels <- list(
+  "vector sizes (n)",
+  "vector sizes (n)",
+  "vector sizes (n)",
+  "layout (row/col), triangle (up/lo), transpose (n/t)",
+  "increments/strides for x",
+  "band width (k)"
+)
+
+# Defines the x-axis of the test-cases
+test_xaxis <- list(
+  c("n", ""),
+  c("n", ""),
+  c("n", ""),
+  list(1:8, c("row,up,n", "row,up,t", "row,lo,n", "row,lo,t",
+              "col,up,n", "col,up,t", "col,lo,n", "col,lo,t")),
+  list(1:4, c("x1", "x2", "x4", "x8")),
+  list(1:5, c("1", "8", "32", "128", "512"))
+)
+
+# ==================================================================================================
+
+# Start the script
+main(routine_name=routine_name, precision=precision, test_names=test_names, test_values=test_values,
+     test_xlabels=test_xlabels, test_xaxis=test_xaxis, metric_gflops=FALSE)
+
+# ==================================================================================================
\ No newline at end of file
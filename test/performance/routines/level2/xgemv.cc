@@ -19,12 +19,13 @@
 // Shortcuts to the clblast namespace
 using float2 = clblast::float2;
 using double2 = clblast::double2;
+using half = clblast::half;
 
 // Main function (not within the clblast namespace)
 int main(int argc, char *argv[]) {
   switch(clblast::GetPrecision(argc, argv)) {
     case clblast::Precision::kHalf:
-      throw std::runtime_error("Unsupported precision mode");
+      clblast::RunClient<clblast::TestXgemv<half>, half, half>(argc, argv); break;
     case clblast::Precision::kSingle:
       clblast::RunClient<clblast::TestXgemv<float>, float, float>(argc, argv); break;
     case clblast::Precision::kDouble:
@@ -0,0 +1,137 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the multi-device version of the
+// Xaxpy routine. The buffers, results and dimensions are the same as those of the regular Xaxpy
+// routine, which also serves as the reference here. If the test-device can be partitioned, the
+// work is spread over its sub-devices. Otherwise, multiple devices are emulated by several
+// command-queues on the test-device.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XAXPYMULTIDEVICE_H_
+#define CLBLAST_TEST_ROUTINES_XAXPYMULTIDEVICE_H_
+
+#include <vector>
+#include <string>
+
+#include "routines/level1/xaxpy.h"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXaxpyMultiDevice: public TestXaxpy<T> {
+ public:
+
+  // The number of command-queues the work is spread over in case the device can't be partitioned
+  static constexpr size_t kNumQueues = 3;
+
+  // Describes how to run the CLBlast routine
+  static StatusCode RunRoutine(const Arguments<T> &args, const Buffers &buffers,
+                               CommandQueue &queue) {
+    auto sub_devices = PartitionTestDevice(queue.GetDevice());
+    auto status = (sub_devices.size() > 1) ? RunOnSubDevices(args, buffers, queue, sub_devices)
+                                           : RunOnQueues(args, buffers, queue);
+    for (auto &sub_device: sub_devices) { clReleaseDevice(sub_device); }
+    return status;
+  }
+
+  // Describes how to run the reference routine: the regular single-device version of CLBlast
+  static StatusCode RunReference(const Arguments<T> &args, const Buffers &buffers,
+                                 CommandQueue &queue) {
+    return TestXaxpy<T>::RunRoutine(args, buffers, queue);
+  }
+
+ private:
+
+  // Partitions the device through the CLBlast API. Returns an empty list if this is unsupported.
+  static std::vector<cl_device_id> PartitionTestDevice(const Device &device) {
+    auto max_sub_devices = cl_uint{0};
+    clGetDeviceInfo(device(), CL_DEVICE_PARTITION_MAX_SUB_DEVICES, sizeof(cl_uint),
+                    &max_sub_devices, nullptr);
+    if (max_sub_devices < 2) { return {}; }
+
+    // Queries the number of sub-devices first, then retrieves them into an array of that size
+    auto num_sub_devices = size_t{0};
+    auto status = PartitionDevice(device(), nullptr, &num_sub_devices);
+    if (status != StatusCode::kSuccess || num_sub_devices < 2) { return {}; }
+    auto sub_devices = std::vector<cl_device_id>(num_sub_devices);
+    status = PartitionDevice(device(), sub_devices.data(), &num_sub_devices);
+    if (status != StatusCode::kSuccess) { return {}; }
+    return sub_devices;
+  }
+
+  // Runs the routine on several command-queues on the test-device itself
+  static StatusCode RunOnQueues(const Arguments<T> &args, const Buffers &buffers,
+                                CommandQueue &queue) {
+    auto context = queue.GetContext();
+    auto device = queue.GetDevice();
+    auto queues_plain = std::vector<cl_command_queue>{queue()};
+    auto queues = std::vector<CommandQueue>();
+    for (auto i=size_t{1}; i<kNumQueues; ++i) {
+      queues.push_back(CommandQueue(context, device));
+      queues_plain.push_back(queues.back()());
+    }
+    return RunMultiDevice(args, buffers.x_vec(), buffers.y_vec(), queues_plain);
+  }
+
+  // Runs the routine on a queue per sub-device. The sub-devices require a context of their own,
+  // so the vectors are copied to and from that context through the host.
+  static StatusCode RunOnSubDevices(const Arguments<T> &args, const Buffers &buffers,
+                                    CommandQueue &queue,
+                                    const std::vector<cl_device_id> &sub_devices) {
+    auto devices = std::vector<Device>();
+    for (auto &sub_device: sub_devices) { devices.push_back(Device(sub_device)); }
+    auto context = Context(devices);
+    auto queues = std::vector<CommandQueue>();
+    auto queues_plain = std::vector<cl_command_queue>();
+    for (auto &device: devices) {
+      queues.push_back(CommandQueue(context, device));
+      queues_plain.push_back(queues.back()());
+    }
+
+    // Copies the vectors to the context of the sub-devices
+    auto x_source = buffers.x_vec;
+    auto y_source = buffers.y_vec;
+    auto x_host = std::vector<T>(args.x_size);
+    auto y_host = std::vector<T>(args.y_size);
+    auto x_vec = Buffer(context, CL_MEM_READ_WRITE, args.x_size*sizeof(T));
+    auto y_vec = Buffer(context, CL_MEM_READ_WRITE, args.y_size*sizeof(T));
+    x_source.ReadBuffer(queue, args.x_size*sizeof(T), x_host);
+    y_source.ReadBuffer(queue, args.y_size*sizeof(T), y_host);
+    x_vec.WriteBuffer(queues[0], args.x_size*sizeof(T), x_host);
+    y_vec.WriteBuffer(queues[0], args.y_size*sizeof(T), y_host);
+
+    // Runs the routine and copies the result back
+    auto status = RunMultiDevice(args, x_vec(), y_vec(), queues_plain);
+    y_vec.ReadBuffer(queues[0], args.y_size*sizeof(T), y_host);
+    y_source.WriteBuffer(queue, args.y_size*sizeof(T), y_host);
+    return status;
+  }
+
+  // Runs the multi-device routine itself on a list of queues
+  static StatusCode RunMultiDevice(const Arguments<T> &args, const cl_mem x_vec,
+                                   const cl_mem y_vec, std::vector<cl_command_queue> &queues) {
+    auto event = cl_event{};
+    auto status = AxpyMultiDevice(args.n, args.alpha,
+                                  x_vec, args.x_offset, args.x_inc,
+                                  y_vec, args.y_offset, args.y_inc,
+                                  queues.data(), queues.size(), &event);
+    clWaitForEvents(1, &event);
+    return status;
+  }
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XAXPYMULTIDEVICE_H_
+#endif
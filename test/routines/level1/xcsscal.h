@@ -0,0 +1,127 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the Xcsscal routine: SCAL of a
+// complex vector with a real scalar (CSSCAL and ZDSCAL). These are only part of the C API, which
+// forwards the scalar to the complex Xscal routine with a zero imaginary part. Examples of such
+// 'descriptions' are how to calculate the size a of buffer or how to run the routine. These static
+// methods are used by the correctness tester.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XCSSCAL_H_
+#define CLBLAST_TEST_ROUTINES_XCSSCAL_H_
+
+#include <vector>
+#include <string>
+
+#include "clblast_c.h"
+#include "wrapper_clblas.h"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T, typename U>
+class TestXcsscal {
+ public:
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() {
+    return {kArgN,
+            kArgXInc,
+            kArgXOffset,
+            kArgAlpha};
+  }
+
+  // Describes how to obtain the sizes of the buffers
+  static size_t GetSizeX(const Arguments<U> &args) {
+    return args.n * args.x_inc + args.x_offset;
+  }
+
+  // Describes how to set the sizes of all the buffers
+  static void SetSizes(Arguments<U> &args) {
+    args.x_size = GetSizeX(args);
+  }
+
+  // Describes what the default values of the leading dimensions of the matrices are
+  static size_t DefaultLDA(const Arguments<U> &) { return 1; } // N/A for this routine
+  static size_t DefaultLDB(const Arguments<U> &) { return 1; } // N/A for this routine
+  static size_t DefaultLDC(const Arguments<U> &) { return 1; } // N/A for this routine
+
+  // Describes how to run the CLBlast routine
+  static StatusCode RunRoutine(const Arguments<U> &args, const Buffers &buffers,
+                               CommandQueue &queue) {
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    auto status = RunCsscal(args.n, args.alpha,
+                            buffers.x_vec(), args.x_offset, args.x_inc,
+                            &queue_plain, &event);
+    clWaitForEvents(1, &event);
+    return status;
+  }
+
+  // Describes how to run the clBLAS routine (for correctness/performance comparison)
+  static StatusCode RunReference(const Arguments<U> &args, const Buffers &buffers,
+                                 CommandQueue &queue) {
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    auto status = clblasXsscal(args.n, args.alpha,
+                               buffers.x_vec(), args.x_offset, args.x_inc,
+                               1, &queue_plain, 0, nullptr, &event);
+    clWaitForEvents(1, &event);
+    return static_cast<StatusCode>(status);
+  }
+
+  // Describes how to download the results of the computation (more importantly: which buffer)
+  static std::vector<T> DownloadResult(const Arguments<U> &args, Buffers &buffers,
+                                       CommandQueue &queue) {
+    std::vector<T> result(args.x_size, static_cast<T>(0));
+    buffers.x_vec.ReadBuffer(queue, args.x_size*sizeof(T), result);
+    return result;
+  }
+
+  // Describes how to compute the indices of the result buffer
+  static size_t ResultID1(const Arguments<U> &args) { return args.n; }
+  static size_t ResultID2(const Arguments<U> &) { return 1; } // N/A for this routine
+  static size_t GetResultIndex(const Arguments<U> &args, const size_t id1, const size_t) {
+    return id1*args.x_inc + args.x_offset;
+  }
+
+  // Describes how to compute performance metrics
+  static size_t GetFlops(const Arguments<U> &args) {
+    return args.n;
+  }
+  static size_t GetBytes(const Arguments<U> &args) {
+    return (2 * args.n) * sizeof(T);
+  }
+
+ private:
+
+  // Calls {clblastCsscal, clblastZdscal} of the C API, of which the precision is determined by the
+  // real scalar argument
+  static StatusCode RunCsscal(const size_t n, const float alpha,
+                              cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                              cl_command_queue* queue, cl_event* event) {
+    return static_cast<StatusCode>(clblastCsscal(n, alpha, x_buffer, x_offset, x_inc,
+                                                 queue, event));
+  }
+  static StatusCode RunCsscal(const size_t n, const double alpha,
+                              cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                              cl_command_queue* queue, cl_event* event) {
+    return static_cast<StatusCode>(clblastZdscal(n, alpha, x_buffer, x_offset, x_inc,
+                                                 queue, event));
+  }
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XCSSCAL_H_
+#endif
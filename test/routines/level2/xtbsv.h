@@ -0,0 +1,142 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the Xtbsv routine. Examples of
+// such 'descriptions' are how to calculate the size a of buffer or how to run the routine. These
+// static methods are used by the correctness tester and the performance tester. Since the routine
+// solves a triangular system of equations, the correctness tester first makes the triangular band
+// matrix well-conditioned (see 'PrepareData' below).
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XTBSV_H_
+#define CLBLAST_TEST_ROUTINES_XTBSV_H_
+
+#include <vector>
+#include <string>
+
+#include "wrapper_clblas.h"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXtbsv {
+ public:
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() {
+    return {kArgN, kArgK,
+            kArgLayout, kArgTriangle, kArgATransp, kArgDiagonal,
+            kArgALeadDim, kArgXInc,
+            kArgAOffset, kArgXOffset};
+  }
+
+  // Describes how to obtain the sizes of the buffers
+  static size_t GetSizeA(const Arguments<T> &args) {
+    return args.n * args.a_ld + args.a_offset;
+  }
+  static size_t GetSizeX(const Arguments<T> &args) {
+    return args.n * args.x_inc + args.x_offset;
+  }
+
+  // Describes how to set the sizes of all the buffers
+  static void SetSizes(Arguments<T> &args) {
+    args.a_size = GetSizeA(args);
+    args.x_size = GetSizeX(args);
+  }
+
+  // Describes what the default values of the leading dimensions of the matrices are
+  static size_t DefaultLDA(const Arguments<T> &args) { return args.k + 1; }
+  static size_t DefaultLDB(const Arguments<T> &) { return 1; } // N/A for this routine
+  static size_t DefaultLDC(const Arguments<T> &) { return 1; } // N/A for this routine
+
+  // Makes the triangular band matrix A diagonally dominant, such that the system of equations is
+  // well-conditioned and the solutions of CLBlast and the reference can be compared. This is done
+  // by scaling down the off-diagonal elements and by adding a constant to the diagonal. In the band
+  // format, the diagonal is the first or the last element of each column (or row).
+  static void PrepareData(const Arguments<T> &args, const Buffers &buffers, CommandQueue &queue) {
+    auto a_mat = buffers.a_mat;
+    auto a_host = std::vector<T>(args.a_size);
+    if (a_mat.ReadBuffer(queue, args.a_size*sizeof(T), a_host) != CL_SUCCESS) { return; }
+    auto diagonal_first = ((args.triangle == Triangle::kUpper) ==
+                           (args.layout == Layout::kRowMajor));
+    auto diagonal_id = (diagonal_first) ? size_t{0} : args.k;
+    for (auto i=size_t{0}; i<args.n; ++i) {
+      for (auto j=size_t{0}; j<=args.k; ++j) {
+        auto index = i*args.a_ld + j + args.a_offset;
+        if (index >= args.a_size) { continue; }
+        a_host[index] = (j == diagonal_id) ? a_host[index] + static_cast<T>(2.0) :
+                                             a_host[index] / static_cast<T>(args.k + 1);
+      }
+    }
+    a_mat.WriteBuffer(queue, args.a_size*sizeof(T), a_host);
+  }
+
+  // Describes how to run the CLBlast routine
+  static StatusCode RunRoutine(const Arguments<T> &args, const Buffers &buffers,
+                               CommandQueue &queue) {
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    auto status = Tbsv<T>(args.layout, args.triangle, args.a_transpose, args.diagonal,
+                          args.n, args.k,
+                          buffers.a_mat(), args.a_offset, args.a_ld,
+                          buffers.x_vec(), args.x_offset, args.x_inc,
+                          &queue_plain, &event);
+    clWaitForEvents(1, &event);
+    return status;
+  }
+
+  // Describes how to run the clBLAS routine (for correctness/performance comparison)
+  static StatusCode RunReference(const Arguments<T> &args, const Buffers &buffers,
+                                 CommandQueue &queue) {
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    auto status = clblasXtbsv<T>(static_cast<clblasOrder>(args.layout),
+                                  static_cast<clblasUplo>(args.triangle),
+                                  static_cast<clblasTranspose>(args.a_transpose),
+                                  static_cast<clblasDiag>(args.diagonal),
+                                  args.n, args.k,
+                                  buffers.a_mat(), args.a_offset, args.a_ld,
+                                  buffers.x_vec(), args.x_offset, args.x_inc,
+                                  1, &queue_plain, 0, nullptr, &event);
+    clWaitForEvents(1, &event);
+    return static_cast<StatusCode>(status);
+  }
+
+  // Describes how to download the results of the computation (more importantly: which buffer)
+  static std::vector<T> DownloadResult(const Arguments<T> &args, Buffers &buffers,
+                                       CommandQueue &queue) {
+    std::vector<T> result(args.x_size, static_cast<T>(0));
+    buffers.x_vec.ReadBuffer(queue, args.x_size*sizeof(T), result);
+    return result;
+  }
+
+  // Describes how to compute the indices of the result buffer
+  static size_t ResultID1(const Arguments<T> &args) { return args.n; }
+  static size_t ResultID2(const Arguments<T> &) { return 1; } // N/A for this routine
+  static size_t GetResultIndex(const Arguments<T> &args, const size_t id1, const size_t) {
+    return id1*args.x_inc + args.x_offset;
+  }
+
+  // Describes how to compute performance metrics
+  static size_t GetFlops(const Arguments<T> &args) {
+    return 2 * args.n * (args.k + 1);
+  }
+  static size_t GetBytes(const Arguments<T> &args) {
+    return (args.n*(args.k + 1) + 2*args.n) * sizeof(T);
+  }
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XTBSV_H_
+#endif
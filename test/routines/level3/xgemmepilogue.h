@@ -0,0 +1,147 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the Xgemm routine with a fused
+// epilogue. The matrices are the same as those of the regular Xgemm routine, the scale vector is
+// stored in the X buffer and the bias vector in the Y buffer. The reference is the regular clBLAS
+// GEMM, followed by the epilogue computed on the host.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XGEMMEPILOGUE_H_
+#define CLBLAST_TEST_ROUTINES_XGEMMEPILOGUE_H_
+
+#include <vector>
+#include <string>
+#include <cmath>
+#include <algorithm>
+
+#include "routines/level3/xgemm.h"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXgemmEpilogue: public TestXgemm<T> {
+ public:
+
+  // The epilogue to test with. The scale and bias buffers are filled in when running the routine.
+  static Epilogue& CurrentEpilogue() {
+    static auto epilogue = Epilogue{};
+    return epilogue;
+  }
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() {
+    return {kArgM, kArgN, kArgK,
+            kArgLayout, kArgATransp, kArgBTransp,
+            kArgALeadDim, kArgBLeadDim, kArgCLeadDim,
+            kArgAOffset, kArgBOffset, kArgCOffset,
+            kArgXOffset, kArgYOffset,
+            kArgAlpha, kArgBeta};
+  }
+
+  // Describes how to obtain the sizes of the scale and bias vectors (per row or per column of C)
+  static size_t GetSizeX(const Arguments<T> &args) {
+    return std::max(args.m, args.n) + args.x_offset;
+  }
+  static size_t GetSizeY(const Arguments<T> &args) {
+    return std::max(args.m, args.n) + args.y_offset;
+  }
+
+  // Describes how to run the CLBlast routine
+  static StatusCode RunRoutine(const Arguments<T> &args, const Buffers &buffers,
+                               CommandQueue &queue) {
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    auto epilogue = CurrentEpilogue();
+    epilogue.scale_buffer = buffers.x_vec();
+    epilogue.scale_offset = args.x_offset;
+    epilogue.bias_buffer = buffers.y_vec();
+    epilogue.bias_offset = args.y_offset;
+    auto status = GemmEpilogue(args.layout, args.a_transpose, args.b_transpose,
+                               args.m, args.n, args.k, args.alpha,
+                               buffers.a_mat(), args.a_offset, args.a_ld,
+                               buffers.b_mat(), args.b_offset, args.b_ld, args.beta,
+                               buffers.c_mat(), args.c_offset, args.c_ld,
+                               epilogue, &queue_plain, &event);
+    clWaitForEvents(1, &event);
+    return status;
+  }
+
+  // Describes how to run the clBLAS routine (for correctness/performance comparison), after which
+  // the epilogue is applied to the result on the host
+  static StatusCode RunReference(const Arguments<T> &args, const Buffers &buffers,
+                                 CommandQueue &queue) {
+    auto status = TestXgemm<T>::RunReference(args, buffers, queue);
+    if (status != StatusCode::kSuccess) { return status; }
+    auto c_mat = buffers.c_mat;
+    auto x_vec = buffers.x_vec;
+    auto y_vec = buffers.y_vec;
+    auto c_host = std::vector<T>(args.c_size);
+    auto scale = std::vector<T>(args.x_size);
+    auto bias = std::vector<T>(args.y_size);
+    c_mat.ReadBuffer(queue, args.c_size*sizeof(T), c_host);
+    x_vec.ReadBuffer(queue, args.x_size*sizeof(T), scale);
+    y_vec.ReadBuffer(queue, args.y_size*sizeof(T), bias);
+    for (auto m=size_t{0}; m<args.m; ++m) {
+      for (auto n=size_t{0}; n<args.n; ++n) {
+        auto index = (args.layout == Layout::kRowMajor) ? m*args.c_ld + n : n*args.c_ld + m;
+        auto &value = c_host[index + args.c_offset];
+        value = FromDouble<T>(ApplyEpilogue(ToDouble(value), m, n, args, scale, bias));
+      }
+    }
+    c_mat.WriteBuffer(queue, args.c_size*sizeof(T), c_host);
+    return StatusCode::kSuccess;
+  }
+
+ private:
+
+  // Converts the (real) data-types to double-precision, to compute the epilogue on the host
+  static double ToDouble(const float value) { return static_cast<double>(value); }
+  static double ToDouble(const double value) { return value; }
+  static double ToDouble(const half value) { return static_cast<double>(HalfToFloat(value)); }
+
+  // Applies the epilogue to a single element of C at row 'm' and column 'n'
+  static double ApplyEpilogue(double value, const size_t m, const size_t n,
+                              const Arguments<T> &args,
+                              const std::vector<T> &scale, const std::vector<T> &bias) {
+    const auto &epilogue = CurrentEpilogue();
+    if (epilogue.scale == EpilogueVector::kPerRow) {
+      value *= ToDouble(scale[args.x_offset + m]);
+    }
+    if (epilogue.scale == EpilogueVector::kPerColumn) {
+      value *= ToDouble(scale[args.x_offset + n]);
+    }
+    if (epilogue.bias == EpilogueVector::kPerRow) {
+      value += ToDouble(bias[args.y_offset + m]);
+    }
+    if (epilogue.bias == EpilogueVector::kPerColumn) {
+      value += ToDouble(bias[args.y_offset + n]);
+    }
+    if (epilogue.activation == Activation::kReLU) {
+      value = std::max(value, 0.0);
+    }
+    if (epilogue.activation == Activation::kGELU) { // Equal to 0.5*x*(1 + tanh(inner))
+      auto inner = 0.7978845608028654 * (value + 0.044715 * value*value*value);
+      value = value / (1.0 + std::exp(-2.0 * inner));
+    }
+    if (epilogue.clamp) {
+      value = std::min(std::max(value, epilogue.clamp_min), epilogue.clamp_max);
+    }
+    return value;
+  }
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XGEMMEPILOGUE_H_
+#endif
@@ -0,0 +1,114 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the host-memory version of the
+// Xgemm routine. The buffers, results and dimensions are the same as those of the regular Xgemm
+// routine, which also provides the reference. The matrices are copied from the test buffers into
+// host memory and the result is copied back, which is included in the performance measurements.
+// Apart from the public routine, each of its versions can be run separately: the zero-copy and the
+// pipelined versions (on any device) and the host backend (without a device).
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XGEMMHOST_H_
+#define CLBLAST_TEST_ROUTINES_XGEMMHOST_H_
+
+#include <vector>
+#include <string>
+
+#include "internal/hostmemory.h"
+#include "routines/level3/xgemm.h"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXgemmHost: public TestXgemm<T> {
+ public:
+
+  // Describes how to run the CLBlast routine
+  static StatusCode RunRoutine(const Arguments<T> &args, const Buffers &buffers,
+                               CommandQueue &queue) {
+    return RunOnHost(args, buffers, queue, [&](const T* a, const T* b, T* c) {
+      auto queue_plain = queue();
+      auto event = cl_event{};
+      return GemmHost(args.layout, args.a_transpose, args.b_transpose,
+                      args.m, args.n, args.k, args.alpha, a, args.a_ld, b, args.b_ld, args.beta,
+                      c, args.c_ld, &queue_plain, &event);
+    });
+  }
+
+  // As above, but runs the zero-copy version
+  static StatusCode RunRoutineZeroCopy(const Arguments<T> &args, const Buffers &buffers,
+                                       CommandQueue &queue) {
+    return RunOnHost(args, buffers, queue, [&](const T* a, const T* b, T* c) {
+      auto event = Event();
+      auto routine = XgemmHost<T>(queue, event);
+      auto status = routine.SetUp();
+      if (status != StatusCode::kSuccess) { return status; }
+      return routine.DoGemmZeroCopy(args.layout, args.a_transpose, args.b_transpose,
+                                    args.m, args.n, args.k, args.alpha, a, args.a_ld,
+                                    b, args.b_ld, args.beta, c, args.c_ld);
+    });
+  }
+
+  // As above, but runs the pipelined version
+  static StatusCode RunRoutinePipelined(const Arguments<T> &args, const Buffers &buffers,
+                                        CommandQueue &queue) {
+    return RunOnHost(args, buffers, queue, [&](const T* a, const T* b, T* c) {
+      auto event = Event();
+      auto routine = XgemmHost<T>(queue, event);
+      auto status = routine.SetUp();
+      if (status != StatusCode::kSuccess) { return status; }
+      return routine.DoGemmPipelined(args.layout, args.a_transpose, args.b_transpose,
+                                     args.m, args.n, args.k, args.alpha, a, args.a_ld,
+                                     b, args.b_ld, args.beta, c, args.c_ld);
+    });
+  }
+
+  // As above, but runs the host backend: the public routine without a command-queue. This is the
+  // same computation as done by the public routine for small problems.
+  static StatusCode RunRoutineWithoutDevice(const Arguments<T> &args, const Buffers &buffers,
+                                            CommandQueue &queue) {
+    return RunOnHost(args, buffers, queue, [&](const T* a, const T* b, T* c) {
+      return GemmHost(args.layout, args.a_transpose, args.b_transpose,
+                      args.m, args.n, args.k, args.alpha, a, args.a_ld, b, args.b_ld, args.beta,
+                      c, args.c_ld, nullptr, nullptr);
+    });
+  }
+
+ private:
+
+  // Copies the matrices from the test buffers into host memory, runs the routine on the host
+  // pointers (taking the offsets into account), and copies matrix C back into its buffer
+  template <typename F>
+  static StatusCode RunOnHost(const Arguments<T> &args, const Buffers &buffers,
+                              CommandQueue &queue, F routine) {
+    auto a_mat = Buffer(buffers.a_mat());
+    auto b_mat = Buffer(buffers.b_mat());
+    auto c_mat = Buffer(buffers.c_mat());
+    auto a_host = std::vector<T>(args.a_size);
+    auto b_host = std::vector<T>(args.b_size);
+    auto c_host = std::vector<T>(args.c_size);
+    a_mat.ReadBuffer(queue, args.a_size*sizeof(T), a_host);
+    b_mat.ReadBuffer(queue, args.b_size*sizeof(T), b_host);
+    c_mat.ReadBuffer(queue, args.c_size*sizeof(T), c_host);
+    auto status = routine(a_host.data() + args.a_offset, b_host.data() + args.b_offset,
+                          c_host.data() + args.c_offset);
+    if (status != StatusCode::kSuccess) { return status; }
+    c_mat.WriteBuffer(queue, args.c_size*sizeof(T), c_host);
+    return StatusCode::kSuccess;
+  }
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XGEMMHOST_H_
+#endif
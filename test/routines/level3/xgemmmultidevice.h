@@ -0,0 +1,69 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the multi-device version of the
+// Xgemm routine. The buffers, results and dimensions are the same as those of the regular Xgemm
+// routine, which also serves as the reference here. The multiple devices are emulated by several
+// command-queues on the test-device.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XGEMMMULTIDEVICE_H_
+#define CLBLAST_TEST_ROUTINES_XGEMMMULTIDEVICE_H_
+
+#include <vector>
+#include <string>
+
+#include "routines/level3/xgemm.h"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXgemmMultiDevice: public TestXgemm<T> {
+ public:
+
+  // The number of command-queues the work is spread over
+  static constexpr size_t kNumQueues = 3;
+
+  // Describes how to run the CLBlast routine
+  static StatusCode RunRoutine(const Arguments<T> &args, const Buffers &buffers,
+                               CommandQueue &queue) {
+    auto context = queue.GetContext();
+    auto device = queue.GetDevice();
+    auto queues_plain = std::vector<cl_command_queue>{queue()};
+    auto queues = std::vector<CommandQueue>();
+    for (auto i=size_t{1}; i<kNumQueues; ++i) {
+      queues.push_back(CommandQueue(context, device));
+      queues_plain.push_back(queues.back()());
+    }
+    auto event = cl_event{};
+    auto status = GemmMultiDevice(args.layout, args.a_transpose, args.b_transpose,
+                                  args.m, args.n, args.k, args.alpha,
+                                  buffers.a_mat(), args.a_offset, args.a_ld,
+                                  buffers.b_mat(), args.b_offset, args.b_ld, args.beta,
+                                  buffers.c_mat(), args.c_offset, args.c_ld,
+                                  queues_plain.data(), queues_plain.size(), &event);
+    clWaitForEvents(1, &event);
+    return status;
+  }
+
+  // Describes how to run the reference routine: the regular single-device version of CLBlast
+  static StatusCode RunReference(const Arguments<T> &args, const Buffers &buffers,
+                                 CommandQueue &queue) {
+    return TestXgemm<T>::RunRoutine(args, buffers, queue);
+  }
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XGEMMMULTIDEVICE_H_
+#endif
@@ -20,115 +20,1823 @@
 #include "internal/utilities.h"
 
 namespace clblast {
+// =================================================================================================
+
+// The clBLAS library has no half-precision routines. These are emulated by converting the buffers
+// to single-precision, calling the single-precision routine, and converting the result back. The
+// element indices (and thus the offsets and leading dimensions) remain the same. Invalid (empty)
+// buffers are passed on as they are, such that clBLAS can report them.
+Buffer HalfToFloatBuffer(const cl_mem half_buffer, cl_command_queue queue_raw) {
+  if (half_buffer == nullptr) { return Buffer(half_buffer); }
+  auto queue = CommandQueue(queue_raw);
+  auto buffer = Buffer(half_buffer);
+  const auto size = buffer.GetSize() / sizeof(half);
+  auto half_data = std::vector<half>(size);
+  buffer.ReadBuffer(queue, size*sizeof(half), half_data);
+  auto float_data = std::vector<float>(size);
+  for (auto i=size_t{0}; i<size; ++i) { float_data[i] = HalfToFloat(half_data[i]); }
+  auto float_buffer = Buffer(queue.GetContext(), CL_MEM_READ_WRITE, size*sizeof(float));
+  float_buffer.WriteBuffer(queue, size*sizeof(float), float_data);
+  return float_buffer;
+}
+void FloatToHalfBuffer(const cl_mem half_buffer, Buffer &float_buffer, cl_command_queue queue_raw) {
+  auto queue = CommandQueue(queue_raw);
+  auto buffer = Buffer(half_buffer);
+  const auto size = buffer.GetSize() / sizeof(half);
+  auto float_data = std::vector<float>(size);
+  float_buffer.ReadBuffer(queue, size*sizeof(float), float_data);
+  auto half_data = std::vector<half>(size);
+  for (auto i=size_t{0}; i<size; ++i) { half_data[i] = FloatToHalf(float_data[i]); }
+  buffer.WriteBuffer(queue, size*sizeof(half), half_data);
+}
+
 // =================================================================================================
 // BLAS level-1 (vector-vector) routines
 
-// Calls {clblasSaxpy, clblasDaxpy, clblasCaxpy, clblasZaxpy} with the arguments forwarded.
-clblasStatus clblasXaxpy(
-  size_t n, float alpha,
+// Calls {clblasSrotg, clblasDrotg} with the arguments forwarded. The precision is given as template
+// argument, since there is no scalar argument to determine it.
+template <typename T>
+clblasStatus clblasXrotg(
+  cl_mem a_buffer, size_t a_offset,
+  cl_mem b_buffer, size_t b_offset,
+  cl_mem c_buffer, size_t c_offset,
+  cl_mem s_buffer, size_t s_offset,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events);
+template <> clblasStatus clblasXrotg<float>(
+  cl_mem a_buffer, size_t a_offset,
+  cl_mem b_buffer, size_t b_offset,
+  cl_mem c_buffer, size_t c_offset,
+  cl_mem s_buffer, size_t s_offset,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasSrotg(a_buffer, a_offset, b_buffer, b_offset,
+                       c_buffer, c_offset, s_buffer, s_offset,
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXrotg<double>(
+  cl_mem a_buffer, size_t a_offset,
+  cl_mem b_buffer, size_t b_offset,
+  cl_mem c_buffer, size_t c_offset,
+  cl_mem s_buffer, size_t s_offset,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasDrotg(a_buffer, a_offset, b_buffer, b_offset,
+                       c_buffer, c_offset, s_buffer, s_offset,
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasSrotmg, clblasDrotmg} with the arguments forwarded. The precision is given as
+// template argument, since there is no scalar argument to determine it.
+template <typename T>
+clblasStatus clblasXrotmg(
+  cl_mem d1_buffer, size_t d1_offset,
+  cl_mem d2_buffer, size_t d2_offset,
+  cl_mem x1_buffer, size_t x1_offset,
+  const cl_mem y1_buffer, size_t y1_offset,
+  cl_mem param_buffer, size_t param_offset,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events);
+template <> clblasStatus clblasXrotmg<float>(
+  cl_mem d1_buffer, size_t d1_offset,
+  cl_mem d2_buffer, size_t d2_offset,
+  cl_mem x1_buffer, size_t x1_offset,
+  const cl_mem y1_buffer, size_t y1_offset,
+  cl_mem param_buffer, size_t param_offset,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasSrotmg(d1_buffer, d1_offset, d2_buffer, d2_offset,
+                        x1_buffer, x1_offset, y1_buffer, y1_offset,
+                        param_buffer, param_offset,
+                        num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXrotmg<double>(
+  cl_mem d1_buffer, size_t d1_offset,
+  cl_mem d2_buffer, size_t d2_offset,
+  cl_mem x1_buffer, size_t x1_offset,
+  const cl_mem y1_buffer, size_t y1_offset,
+  cl_mem param_buffer, size_t param_offset,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasDrotmg(d1_buffer, d1_offset, d2_buffer, d2_offset,
+                        x1_buffer, x1_offset, y1_buffer, y1_offset,
+                        param_buffer, param_offset,
+                        num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasSrot, clblasDrot} with the arguments forwarded. The cosine and sine are read from
+// device memory first, since clBLAS takes them as host scalars.
+template <typename T>
+clblasStatus clblasXrot(
+  size_t n,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_mem y_vec, size_t y_offset, size_t y_inc,
+  const cl_mem c_buffer, size_t c_offset,
+  const cl_mem s_buffer, size_t s_offset,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events);
+template <> clblasStatus clblasXrot<float>(
+  size_t n,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_mem y_vec, size_t y_offset, size_t y_inc,
+  const cl_mem c_buffer, size_t c_offset,
+  const cl_mem s_buffer, size_t s_offset,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto c = float{0};
+    auto s = float{0};
+    clEnqueueReadBuffer(queues[0], c_buffer, CL_TRUE, c_offset*sizeof(float), sizeof(float), &c,
+                        0, nullptr, nullptr);
+    clEnqueueReadBuffer(queues[0], s_buffer, CL_TRUE, s_offset*sizeof(float), sizeof(float), &s,
+                        0, nullptr, nullptr);
+    return clblasSrot(n,
+                      x_vec, x_offset, static_cast<int>(x_inc),
+                      y_vec, y_offset, static_cast<int>(y_inc),
+                      c, s,
+                      num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXrot<double>(
+  size_t n,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_mem y_vec, size_t y_offset, size_t y_inc,
+  const cl_mem c_buffer, size_t c_offset,
+  const cl_mem s_buffer, size_t s_offset,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto c = double{0};
+    auto s = double{0};
+    clEnqueueReadBuffer(queues[0], c_buffer, CL_TRUE, c_offset*sizeof(double), sizeof(double), &c,
+                        0, nullptr, nullptr);
+    clEnqueueReadBuffer(queues[0], s_buffer, CL_TRUE, s_offset*sizeof(double), sizeof(double), &s,
+                        0, nullptr, nullptr);
+    return clblasDrot(n,
+                      x_vec, x_offset, static_cast<int>(x_inc),
+                      y_vec, y_offset, static_cast<int>(y_inc),
+                      c, s,
+                      num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasSrotm, clblasDrotm} with the arguments forwarded. The precision is given as
+// template argument, since there is no scalar argument to determine it.
+template <typename T>
+clblasStatus clblasXrotm(
+  size_t n,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_mem y_vec, size_t y_offset, size_t y_inc,
+  const cl_mem param_buffer, size_t param_offset,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events);
+template <> clblasStatus clblasXrotm<float>(
+  size_t n,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_mem y_vec, size_t y_offset, size_t y_inc,
+  const cl_mem param_buffer, size_t param_offset,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasSrotm(n,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       param_buffer, param_offset,
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXrotm<double>(
+  size_t n,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_mem y_vec, size_t y_offset, size_t y_inc,
+  const cl_mem param_buffer, size_t param_offset,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasDrotm(n,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       param_buffer, param_offset,
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasSswap, clblasDswap, clblasCswap, clblasZswap} with the arguments forwarded. The
+// precision is given as template argument, since there is no scalar argument to determine it.
+template <typename T>
+clblasStatus clblasXswap(
+  size_t n,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events);
+template <> clblasStatus clblasXswap<float>(
+  size_t n,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasSswap(n,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXswap<double>(
+  size_t n,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasDswap(n,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXswap<float2>(
+  size_t n,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasCswap(n,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXswap<double2>(
+  size_t n,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasZswap(n,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasSscal, clblasDscal, clblasCscal, clblasZscal} with the arguments forwarded.
+clblasStatus clblasXscal(
+  size_t n, float alpha,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasSscal(n, alpha,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+clblasStatus clblasXscal(
+  size_t n, double alpha,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasDscal(n, alpha,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+clblasStatus clblasXscal(
+  size_t n, float2 alpha,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto cl_alpha = cl_float2{{alpha.real(), alpha.imag()}};
+    return clblasCscal(n, cl_alpha,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+clblasStatus clblasXscal(
+  size_t n, double2 alpha,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto cl_alpha = cl_double2{{alpha.real(), alpha.imag()}};
+    return clblasZscal(n, cl_alpha,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasCsscal, clblasZdscal} with the arguments forwarded: SCAL of a complex vector with a
+// real scalar, of which the precision determines the routine.
+clblasStatus clblasXsscal(
+  size_t n, float alpha,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasCsscal(n, alpha,
+                        x_vec, x_offset, static_cast<int>(x_inc),
+                        num_queues, queues, num_wait_events, wait_events, events);
+}
+clblasStatus clblasXsscal(
+  size_t n, double alpha,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasZdscal(n, alpha,
+                        x_vec, x_offset, static_cast<int>(x_inc),
+                        num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasScopy, clblasDcopy, clblasCcopy, clblasZcopy} with the arguments forwarded. The
+// precision is given as template argument, since there is no scalar argument to determine it.
+template <typename T>
+clblasStatus clblasXcopy(
+  size_t n,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events);
+template <> clblasStatus clblasXcopy<float>(
+  size_t n,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasScopy(n,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXcopy<double>(
+  size_t n,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasDcopy(n,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXcopy<float2>(
+  size_t n,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasCcopy(n,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXcopy<double2>(
+  size_t n,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasZcopy(n,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasSaxpy, clblasDaxpy, clblasCaxpy, clblasZaxpy} with the arguments forwarded.
+clblasStatus clblasXaxpy(
+  size_t n, float alpha,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasSaxpy(n, alpha,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+clblasStatus clblasXaxpy(
+  size_t n, double alpha,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasDaxpy(n, alpha,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+clblasStatus clblasXaxpy(
+  size_t n, float2 alpha,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto cl_alpha = cl_float2{{alpha.real(), alpha.imag()}};
+    return clblasCaxpy(n, cl_alpha,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+clblasStatus clblasXaxpy(
+  size_t n, double2 alpha,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto cl_alpha = cl_double2{{alpha.real(), alpha.imag()}};
+    return clblasZaxpy(n, cl_alpha,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+clblasStatus clblasXaxpy(
+  size_t n, half alpha,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto x_float = HalfToFloatBuffer(x_vec, queues[0]);
+    auto y_float = HalfToFloatBuffer(y_vec, queues[0]);
+    auto status = clblasXaxpy(n, HalfToFloat(alpha),
+                              x_float(), x_offset, x_inc,
+                              y_float(), y_offset, y_inc,
+                              num_queues, queues, num_wait_events, wait_events, events);
+    if (status == clblasSuccess) { FloatToHalfBuffer(y_vec, y_float, queues[0]); }
+    return status;
+}
+
+// Calls {clblasSdot, clblasDdot} with the arguments forwarded. The precision is given as template
+// argument, since there is no scalar argument to determine it. A scratch buffer is created here.
+template <typename T>
+clblasStatus clblasXdot(
+  size_t n, cl_mem dot_buffer, size_t dot_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events);
+template <> clblasStatus clblasXdot<float>(
+  size_t n, cl_mem dot_buffer, size_t dot_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 n*sizeof(float));
+    return clblasSdot(n, dot_buffer, dot_offset,
+                      x_vec, x_offset, static_cast<int>(x_inc),
+                      y_vec, y_offset, static_cast<int>(y_inc),
+                      scratch_buffer(),
+                      num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXdot<double>(
+  size_t n, cl_mem dot_buffer, size_t dot_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 n*sizeof(double));
+    return clblasDdot(n, dot_buffer, dot_offset,
+                      x_vec, x_offset, static_cast<int>(x_inc),
+                      y_vec, y_offset, static_cast<int>(y_inc),
+                      scratch_buffer(),
+                      num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasCdotu, clblasZdotu} with the arguments forwarded.
+template <typename T>
+clblasStatus clblasXdotu(
+  size_t n, cl_mem dot_buffer, size_t dot_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events);
+template <> clblasStatus clblasXdotu<float2>(
+  size_t n, cl_mem dot_buffer, size_t dot_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 n*sizeof(float2));
+    return clblasCdotu(n, dot_buffer, dot_offset,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       scratch_buffer(),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXdotu<double2>(
+  size_t n, cl_mem dot_buffer, size_t dot_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 n*sizeof(double2));
+    return clblasZdotu(n, dot_buffer, dot_offset,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       scratch_buffer(),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasCdotc, clblasZdotc} with the arguments forwarded.
+template <typename T>
+clblasStatus clblasXdotc(
+  size_t n, cl_mem dot_buffer, size_t dot_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events);
+template <> clblasStatus clblasXdotc<float2>(
+  size_t n, cl_mem dot_buffer, size_t dot_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 n*sizeof(float2));
+    return clblasCdotc(n, dot_buffer, dot_offset,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       scratch_buffer(),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXdotc<double2>(
+  size_t n, cl_mem dot_buffer, size_t dot_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 n*sizeof(double2));
+    return clblasZdotc(n, dot_buffer, dot_offset,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       scratch_buffer(),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Emulates SDSDOT: clBLAS has no extended-precision dot-product, so this calls clblasSdot and adds
+// 'sb' to the result on the host. The single-precision accumulation suffices as a reference.
+template <typename T>
+clblasStatus clblasXsdsdot(
+  size_t n, const T sb, cl_mem dot_buffer, size_t dot_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events);
+template <> clblasStatus clblasXsdsdot<float>(
+  size_t n, const float sb, cl_mem dot_buffer, size_t dot_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto status = clblasXdot<float>(n, dot_buffer, dot_offset,
+                                    x_vec, x_offset, x_inc,
+                                    y_vec, y_offset, y_inc,
+                                    num_queues, queues, num_wait_events, wait_events, events);
+    if (status != clblasSuccess) { return status; }
+    clWaitForEvents(1, events);
+    auto dot = float{0};
+    clEnqueueReadBuffer(queues[0], dot_buffer, CL_TRUE, dot_offset*sizeof(float), sizeof(float),
+                        &dot, 0, nullptr, nullptr);
+    dot += sb;
+    clEnqueueWriteBuffer(queues[0], dot_buffer, CL_TRUE, dot_offset*sizeof(float), sizeof(float),
+                         &dot, 0, nullptr, nullptr);
+    return clblasSuccess;
+}
+
+// Emulates DSDOT: calls clblasSdot on a temporary buffer and stores the result as a double. The
+// template argument is the type of the result.
+template <typename T>
+clblasStatus clblasXdsdot(
+  size_t n, cl_mem dot_buffer, size_t dot_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events);
+template <> clblasStatus clblasXdsdot<double>(
+  size_t n, cl_mem dot_buffer, size_t dot_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto temp_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                              sizeof(float));
+    auto status = clblasXdot<float>(n, temp_buffer(), 0,
+                                    x_vec, x_offset, x_inc,
+                                    y_vec, y_offset, y_inc,
+                                    num_queues, queues, num_wait_events, wait_events, events);
+    if (status != clblasSuccess) { return status; }
+    clWaitForEvents(1, events);
+    auto dot = float{0};
+    clEnqueueReadBuffer(queues[0], temp_buffer(), CL_TRUE, 0, sizeof(float), &dot,
+                        0, nullptr, nullptr);
+    auto dot_double = static_cast<double>(dot);
+    clEnqueueWriteBuffer(queues[0], dot_buffer, CL_TRUE, dot_offset*sizeof(double), sizeof(double),
+                         &dot_double, 0, nullptr, nullptr);
+    return clblasSuccess;
+}
+
+// Calls {clblasSnrm2, clblasDnrm2, clblasScnrm2, clblasDznrm2} with the arguments forwarded. For
+// complex data-types, clBLAS stores a real value: the offset is converted accordingly.
+template <typename T>
+clblasStatus clblasXnrm2(
+  size_t n, cl_mem nrm2_buffer, size_t nrm2_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events);
+template <> clblasStatus clblasXnrm2<float>(
+  size_t n, cl_mem nrm2_buffer, size_t nrm2_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 2*n*sizeof(float));
+    return clblasSnrm2(n, nrm2_buffer, nrm2_offset,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       scratch_buffer(),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXnrm2<double>(
+  size_t n, cl_mem nrm2_buffer, size_t nrm2_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 2*n*sizeof(double));
+    return clblasDnrm2(n, nrm2_buffer, nrm2_offset,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       scratch_buffer(),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXnrm2<float2>(
+  size_t n, cl_mem nrm2_buffer, size_t nrm2_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 2*n*sizeof(float2));
+    return clblasScnrm2(n, nrm2_buffer, 2*nrm2_offset,
+                        x_vec, x_offset, static_cast<int>(x_inc),
+                        scratch_buffer(),
+                        num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXnrm2<double2>(
+  size_t n, cl_mem nrm2_buffer, size_t nrm2_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 2*n*sizeof(double2));
+    return clblasDznrm2(n, nrm2_buffer, 2*nrm2_offset,
+                        x_vec, x_offset, static_cast<int>(x_inc),
+                        scratch_buffer(),
+                        num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasSasum, clblasDasum, clblasScasum, clblasDzasum} with the arguments forwarded. For
+// complex data-types, clBLAS stores a real value: the offset is converted accordingly.
+template <typename T>
+clblasStatus clblasXasum(
+  size_t n, cl_mem asum_buffer, size_t asum_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events);
+template <> clblasStatus clblasXasum<float>(
+  size_t n, cl_mem asum_buffer, size_t asum_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 n*sizeof(float));
+    return clblasSasum(n, asum_buffer, asum_offset,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       scratch_buffer(),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXasum<double>(
+  size_t n, cl_mem asum_buffer, size_t asum_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 n*sizeof(double));
+    return clblasDasum(n, asum_buffer, asum_offset,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       scratch_buffer(),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXasum<float2>(
+  size_t n, cl_mem asum_buffer, size_t asum_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 n*sizeof(float2));
+    return clblasScasum(n, asum_buffer, 2*asum_offset,
+                        x_vec, x_offset, static_cast<int>(x_inc),
+                        scratch_buffer(),
+                        num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXasum<double2>(
+  size_t n, cl_mem asum_buffer, size_t asum_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 n*sizeof(double2));
+    return clblasDzasum(n, asum_buffer, 2*asum_offset,
+                        x_vec, x_offset, static_cast<int>(x_inc),
+                        scratch_buffer(),
+                        num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Converts an index as computed by clBLAS (one-based) into a zero-based index as used by CLBlast
+clblasStatus ConvertToZeroBasedIndex(cl_command_queue queue, cl_mem imax_buffer, size_t imax_offset,
+                                     cl_event *events) {
+  clWaitForEvents(1, events);
+  auto index = cl_uint{0};
+  auto offset = imax_offset*sizeof(cl_uint);
+  clEnqueueReadBuffer(queue, imax_buffer, CL_TRUE, offset, sizeof(cl_uint), &index,
+                      0, nullptr, nullptr);
+  if (index > 0) { index -= 1; }
+  auto status = clEnqueueWriteBuffer(queue, imax_buffer, CL_TRUE, offset, sizeof(cl_uint), &index,
+                                     0, nullptr, events);
+  return (status == CL_SUCCESS) ? clblasSuccess : clblasInvalidValue;
+}
+
+// Calls {clblasiSamax, clblasiDamax, clblasiCamax, clblasiZamax} with the arguments forwarded. The
+// resulting index is converted from one-based to zero-based.
+template <typename T>
+clblasStatus clblasXamax(
+  size_t n, cl_mem imax_buffer, size_t imax_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events);
+template <> clblasStatus clblasXamax<float>(
+  size_t n, cl_mem imax_buffer, size_t imax_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 2*n*sizeof(float));
+    auto status = clblasiSamax(n, imax_buffer, imax_offset,
+                               x_vec, x_offset, static_cast<int>(x_inc),
+                               scratch_buffer(),
+                               num_queues, queues, num_wait_events, wait_events, events);
+    if (status != clblasSuccess) { return status; }
+    return ConvertToZeroBasedIndex(queues[0], imax_buffer, imax_offset, events);
+}
+template <> clblasStatus clblasXamax<double>(
+  size_t n, cl_mem imax_buffer, size_t imax_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 2*n*sizeof(double));
+    auto status = clblasiDamax(n, imax_buffer, imax_offset,
+                               x_vec, x_offset, static_cast<int>(x_inc),
+                               scratch_buffer(),
+                               num_queues, queues, num_wait_events, wait_events, events);
+    if (status != clblasSuccess) { return status; }
+    return ConvertToZeroBasedIndex(queues[0], imax_buffer, imax_offset, events);
+}
+template <> clblasStatus clblasXamax<float2>(
+  size_t n, cl_mem imax_buffer, size_t imax_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 2*n*sizeof(float2));
+    auto status = clblasiCamax(n, imax_buffer, imax_offset,
+                               x_vec, x_offset, static_cast<int>(x_inc),
+                               scratch_buffer(),
+                               num_queues, queues, num_wait_events, wait_events, events);
+    if (status != clblasSuccess) { return status; }
+    return ConvertToZeroBasedIndex(queues[0], imax_buffer, imax_offset, events);
+}
+template <> clblasStatus clblasXamax<double2>(
+  size_t n, cl_mem imax_buffer, size_t imax_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 2*n*sizeof(double2));
+    auto status = clblasiZamax(n, imax_buffer, imax_offset,
+                               x_vec, x_offset, static_cast<int>(x_inc),
+                               scratch_buffer(),
+                               num_queues, queues, num_wait_events, wait_events, events);
+    if (status != clblasSuccess) { return status; }
+    return ConvertToZeroBasedIndex(queues[0], imax_buffer, imax_offset, events);
+}
+
+// clBLAS does not implement iAMIN: this computes the zero-based index of the minimum absolute value
+// on the host instead, breaking ties by taking the lowest index. The result is written to the
+// device buffer, of which the write serves as the completion event.
+template <typename T>
+clblasStatus clblasXamin(
+  size_t n, cl_mem imin_buffer, size_t imin_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    if (num_queues < 1) { return clblasInvalidValue; }
+    if (n == 0) { return static_cast<clblasStatus>(StatusCode::kInvalidDimension); }
+    clWaitForEvents(num_wait_events, wait_events);
+
+    // Tests the buffers for validity in the same way as CLBlast does
+    auto x_size = x_offset + n*x_inc;
+    auto x_bytes = size_t{0};
+    auto imin_bytes = size_t{0};
+    if (clGetMemObjectInfo(x_vec, CL_MEM_SIZE, sizeof(size_t), &x_bytes, nullptr) != CL_SUCCESS) {
+      return static_cast<clblasStatus>(StatusCode::kInvalidVectorX);
+    }
+    if (x_bytes < x_size*sizeof(T)) {
+      return static_cast<clblasStatus>(StatusCode::kInsufficientMemoryX);
+    }
+    if (clGetMemObjectInfo(imin_buffer, CL_MEM_SIZE, sizeof(size_t), &imin_bytes,
+                           nullptr) != CL_SUCCESS) {
+      return static_cast<clblasStatus>(StatusCode::kInvalidVectorScalar);
+    }
+    if (imin_bytes < (imin_offset + 1)*sizeof(cl_uint)) {
+      return static_cast<clblasStatus>(StatusCode::kInsufficientMemoryScalar);
+    }
+
+    // Computes the result on the host
+    auto x = std::vector<T>(x_size);
+    clEnqueueReadBuffer(queues[0], x_vec, CL_TRUE, 0, x_size*sizeof(T), x.data(),
+                        0, nullptr, nullptr);
+    auto absolute = [&](const size_t i) {
+      const auto value = x[x_offset + i*x_inc];
+      return std::abs(std::real(value)) + std::abs(std::imag(value));
+    };
+    auto index = cl_uint{0};
+    for (auto i=size_t{1}; i<n; ++i) {
+      if (absolute(i) < absolute(index)) { index = static_cast<cl_uint>(i); }
+    }
+    auto status = clEnqueueWriteBuffer(queues[0], imin_buffer, CL_TRUE, imin_offset*sizeof(cl_uint),
+                                       sizeof(cl_uint), &index, 0, nullptr, events);
+    return (status == CL_SUCCESS) ? clblasSuccess : clblasInvalidValue;
+}
+
+// =================================================================================================
+// BLAS level-2 (matrix-vector) routines
+
+// Calls {clblasSgemv, clblasDgemv, clblasCgemv, clblasZgemv} with the arguments forwarded.
+clblasStatus clblasXgemv(
+  clblasOrder layout, clblasTranspose a_transpose, size_t m, size_t n, float alpha,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc, float beta,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasSgemv(layout, a_transpose, m, n, alpha,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc), beta,
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+clblasStatus clblasXgemv(
+  clblasOrder layout, clblasTranspose a_transpose, size_t m, size_t n, double alpha,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc, double beta,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasDgemv(layout, a_transpose, m, n, alpha,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc), beta,
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+clblasStatus clblasXgemv(
+  clblasOrder layout, clblasTranspose a_transpose, size_t m, size_t n, float2 alpha,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc, float2 beta,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto cl_alpha = cl_float2{{alpha.real(), alpha.imag()}};
+    auto cl_beta = cl_float2{{beta.real(), beta.imag()}};
+    return clblasCgemv(layout, a_transpose, m, n, cl_alpha,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc), cl_beta,
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+clblasStatus clblasXgemv(
+  clblasOrder layout, clblasTranspose a_transpose, size_t m, size_t n, double2 alpha,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc, double2 beta,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto cl_alpha = cl_double2{{alpha.real(), alpha.imag()}};
+    auto cl_beta = cl_double2{{beta.real(), beta.imag()}};
+    return clblasZgemv(layout, a_transpose, m, n, cl_alpha,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc), cl_beta,
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+clblasStatus clblasXgemv(
+  clblasOrder layout, clblasTranspose a_transpose, size_t m, size_t n, half alpha,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc, half beta,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto a_float = HalfToFloatBuffer(a_mat, queues[0]);
+    auto x_float = HalfToFloatBuffer(x_vec, queues[0]);
+    auto y_float = HalfToFloatBuffer(y_vec, queues[0]);
+    auto status = clblasXgemv(layout, a_transpose, m, n, HalfToFloat(alpha),
+                              a_float(), a_offset, a_ld,
+                              x_float(), x_offset, x_inc, HalfToFloat(beta),
+                              y_float(), y_offset, y_inc,
+                              num_queues, queues, num_wait_events, wait_events, events);
+    if (status == clblasSuccess) { FloatToHalfBuffer(y_vec, y_float, queues[0]); }
+    return status;
+}
+
+// Calls {clblasSgbmv, clblasDgbmv, clblasCgbmv, clblasZgbmv} with the arguments forwarded.
+clblasStatus clblasXgbmv(
+  clblasOrder layout, clblasTranspose a_transpose,
+  size_t m, size_t n, size_t kl, size_t ku, float alpha,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc, float beta,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasSgbmv(layout, a_transpose, m, n, kl, ku, alpha,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc), beta,
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+clblasStatus clblasXgbmv(
+  clblasOrder layout, clblasTranspose a_transpose,
+  size_t m, size_t n, size_t kl, size_t ku, double alpha,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc, double beta,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasDgbmv(layout, a_transpose, m, n, kl, ku, alpha,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc), beta,
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+clblasStatus clblasXgbmv(
+  clblasOrder layout, clblasTranspose a_transpose,
+  size_t m, size_t n, size_t kl, size_t ku, float2 alpha,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc, float2 beta,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto cl_alpha = cl_float2{{alpha.real(), alpha.imag()}};
+    auto cl_beta = cl_float2{{beta.real(), beta.imag()}};
+    return clblasCgbmv(layout, a_transpose, m, n, kl, ku, cl_alpha,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc), cl_beta,
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+clblasStatus clblasXgbmv(
+  clblasOrder layout, clblasTranspose a_transpose,
+  size_t m, size_t n, size_t kl, size_t ku, double2 alpha,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc, double2 beta,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto cl_alpha = cl_double2{{alpha.real(), alpha.imag()}};
+    auto cl_beta = cl_double2{{beta.real(), beta.imag()}};
+    return clblasZgbmv(layout, a_transpose, m, n, kl, ku, cl_alpha,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc), cl_beta,
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasSsymv, clblasDsymv} with the arguments forwarded.
+clblasStatus clblasXsymv(
+  clblasOrder layout, clblasUplo triangle, size_t n, float alpha,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc, float beta,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasSsymv(layout, triangle, n, alpha,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc), beta,
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+clblasStatus clblasXsymv(
+  clblasOrder layout, clblasUplo triangle, size_t n, double alpha,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc, double beta,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasDsymv(layout, triangle, n, alpha,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc), beta,
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasChemv, clblasZhemv} with the arguments forwarded.
+clblasStatus clblasXhemv(
+  clblasOrder layout, clblasUplo triangle, size_t n, float2 alpha,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc, float2 beta,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto cl_alpha = cl_float2{{alpha.real(), alpha.imag()}};
+    auto cl_beta = cl_float2{{beta.real(), beta.imag()}};
+    return clblasChemv(layout, triangle, n, cl_alpha,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc), cl_beta,
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+clblasStatus clblasXhemv(
+  clblasOrder layout, clblasUplo triangle, size_t n, double2 alpha,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc, double2 beta,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto cl_alpha = cl_double2{{alpha.real(), alpha.imag()}};
+    auto cl_beta = cl_double2{{beta.real(), beta.imag()}};
+    return clblasZhemv(layout, triangle, n, cl_alpha,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc), cl_beta,
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasSsbmv, clblasDsbmv} with the arguments forwarded.
+clblasStatus clblasXsbmv(
+  clblasOrder layout, clblasUplo triangle, size_t n, size_t k, float alpha,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc, float beta,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasSsbmv(layout, triangle, n, k, alpha,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc), beta,
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+clblasStatus clblasXsbmv(
+  clblasOrder layout, clblasUplo triangle, size_t n, size_t k, double alpha,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc, double beta,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasDsbmv(layout, triangle, n, k, alpha,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc), beta,
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasChbmv, clblasZhbmv} with the arguments forwarded.
+clblasStatus clblasXhbmv(
+  clblasOrder layout, clblasUplo triangle, size_t n, size_t k, float2 alpha,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc, float2 beta,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto cl_alpha = cl_float2{{alpha.real(), alpha.imag()}};
+    auto cl_beta = cl_float2{{beta.real(), beta.imag()}};
+    return clblasChbmv(layout, triangle, n, k, cl_alpha,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc), cl_beta,
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+clblasStatus clblasXhbmv(
+  clblasOrder layout, clblasUplo triangle, size_t n, size_t k, double2 alpha,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc, double2 beta,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto cl_alpha = cl_double2{{alpha.real(), alpha.imag()}};
+    auto cl_beta = cl_double2{{beta.real(), beta.imag()}};
+    return clblasZhbmv(layout, triangle, n, k, cl_alpha,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc), cl_beta,
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasSspmv, clblasDspmv} with the arguments forwarded.
+clblasStatus clblasXspmv(
+  clblasOrder layout, clblasUplo triangle, size_t n, float alpha,
+  const cl_mem ap_mat, size_t ap_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc, float beta,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasSspmv(layout, triangle, n, alpha,
+                       ap_mat, ap_offset,
+                       x_vec, x_offset, static_cast<int>(x_inc), beta,
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+clblasStatus clblasXspmv(
+  clblasOrder layout, clblasUplo triangle, size_t n, double alpha,
+  const cl_mem ap_mat, size_t ap_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc, double beta,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasDspmv(layout, triangle, n, alpha,
+                       ap_mat, ap_offset,
+                       x_vec, x_offset, static_cast<int>(x_inc), beta,
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasChpmv, clblasZhpmv} with the arguments forwarded.
+clblasStatus clblasXhpmv(
+  clblasOrder layout, clblasUplo triangle, size_t n, float2 alpha,
+  const cl_mem ap_mat, size_t ap_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc, float2 beta,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto cl_alpha = cl_float2{{alpha.real(), alpha.imag()}};
+    auto cl_beta = cl_float2{{beta.real(), beta.imag()}};
+    return clblasChpmv(layout, triangle, n, cl_alpha,
+                       ap_mat, ap_offset,
+                       x_vec, x_offset, static_cast<int>(x_inc), cl_beta,
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+clblasStatus clblasXhpmv(
+  clblasOrder layout, clblasUplo triangle, size_t n, double2 alpha,
+  const cl_mem ap_mat, size_t ap_offset,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc, double2 beta,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto cl_alpha = cl_double2{{alpha.real(), alpha.imag()}};
+    auto cl_beta = cl_double2{{beta.real(), beta.imag()}};
+    return clblasZhpmv(layout, triangle, n, cl_alpha,
+                       ap_mat, ap_offset,
+                       x_vec, x_offset, static_cast<int>(x_inc), cl_beta,
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasStrmv, clblasDtrmv, clblasCtrmv, clblasZtrmv} with the arguments forwarded. The
+// precision is given as template argument, since there is no scalar argument to determine it. A
+// scratch buffer is created here.
+template <typename T>
+clblasStatus clblasXtrmv(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events);
+template <> clblasStatus clblasXtrmv<float>(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 (1 + (n - 1)*x_inc)*sizeof(float));
+    return clblasStrmv(layout, triangle, a_transpose, diagonal,
+                       n,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       scratch_buffer(),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXtrmv<double>(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 (1 + (n - 1)*x_inc)*sizeof(double));
+    return clblasDtrmv(layout, triangle, a_transpose, diagonal,
+                       n,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       scratch_buffer(),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXtrmv<float2>(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 (1 + (n - 1)*x_inc)*sizeof(float2));
+    return clblasCtrmv(layout, triangle, a_transpose, diagonal,
+                       n,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       scratch_buffer(),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXtrmv<double2>(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 (1 + (n - 1)*x_inc)*sizeof(double2));
+    return clblasZtrmv(layout, triangle, a_transpose, diagonal,
+                       n,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       scratch_buffer(),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasStbmv, clblasDtbmv, clblasCtbmv, clblasZtbmv} with the arguments forwarded. The
+// precision is given as template argument, since there is no scalar argument to determine it. A
+// scratch buffer is created here.
+template <typename T>
+clblasStatus clblasXtbmv(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n, size_t k,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events);
+template <> clblasStatus clblasXtbmv<float>(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n, size_t k,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 (1 + (n - 1)*x_inc)*sizeof(float));
+    return clblasStbmv(layout, triangle, a_transpose, diagonal,
+                       n, k,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       scratch_buffer(),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXtbmv<double>(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n, size_t k,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 (1 + (n - 1)*x_inc)*sizeof(double));
+    return clblasDtbmv(layout, triangle, a_transpose, diagonal,
+                       n, k,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       scratch_buffer(),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXtbmv<float2>(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n, size_t k,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 (1 + (n - 1)*x_inc)*sizeof(float2));
+    return clblasCtbmv(layout, triangle, a_transpose, diagonal,
+                       n, k,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       scratch_buffer(),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXtbmv<double2>(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n, size_t k,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 (1 + (n - 1)*x_inc)*sizeof(double2));
+    return clblasZtbmv(layout, triangle, a_transpose, diagonal,
+                       n, k,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       scratch_buffer(),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasStpmv, clblasDtpmv, clblasCtpmv, clblasZtpmv} with the arguments forwarded. The
+// precision is given as template argument, since there is no scalar argument to determine it. A
+// scratch buffer is created here.
+template <typename T>
+clblasStatus clblasXtpmv(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n,
+  const cl_mem ap_mat, size_t ap_offset,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events);
+template <> clblasStatus clblasXtpmv<float>(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n,
+  const cl_mem ap_mat, size_t ap_offset,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 (1 + (n - 1)*x_inc)*sizeof(float));
+    return clblasStpmv(layout, triangle, a_transpose, diagonal,
+                       n,
+                       ap_mat, ap_offset,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       scratch_buffer(),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXtpmv<double>(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n,
+  const cl_mem ap_mat, size_t ap_offset,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 (1 + (n - 1)*x_inc)*sizeof(double));
+    return clblasDtpmv(layout, triangle, a_transpose, diagonal,
+                       n,
+                       ap_mat, ap_offset,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       scratch_buffer(),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXtpmv<float2>(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n,
+  const cl_mem ap_mat, size_t ap_offset,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 (1 + (n - 1)*x_inc)*sizeof(float2));
+    return clblasCtpmv(layout, triangle, a_transpose, diagonal,
+                       n,
+                       ap_mat, ap_offset,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       scratch_buffer(),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXtpmv<double2>(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n,
+  const cl_mem ap_mat, size_t ap_offset,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto scratch_buffer = Buffer(CommandQueue(queues[0]).GetContext(), CL_MEM_READ_WRITE,
+                                 (1 + (n - 1)*x_inc)*sizeof(double2));
+    return clblasZtpmv(layout, triangle, a_transpose, diagonal,
+                       n,
+                       ap_mat, ap_offset,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       scratch_buffer(),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasStrsv, clblasDtrsv, clblasCtrsv, clblasZtrsv} with the arguments forwarded. The
+// precision is given as template argument, since there is no scalar argument to determine it.
+template <typename T>
+clblasStatus clblasXtrsv(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events);
+template <> clblasStatus clblasXtrsv<float>(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasStrsv(layout, triangle, a_transpose, diagonal,
+                       n,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXtrsv<double>(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasDtrsv(layout, triangle, a_transpose, diagonal,
+                       n,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXtrsv<float2>(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasCtrsv(layout, triangle, a_transpose, diagonal,
+                       n,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXtrsv<double2>(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasZtrsv(layout, triangle, a_transpose, diagonal,
+                       n,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasStbsv, clblasDtbsv, clblasCtbsv, clblasZtbsv} with the arguments forwarded. The
+// precision is given as template argument, since there is no scalar argument to determine it.
+template <typename T>
+clblasStatus clblasXtbsv(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n, size_t k,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events);
+template <> clblasStatus clblasXtbsv<float>(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n, size_t k,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasStbsv(layout, triangle, a_transpose, diagonal,
+                       n, k,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXtbsv<double>(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n, size_t k,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasDtbsv(layout, triangle, a_transpose, diagonal,
+                       n, k,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXtbsv<float2>(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n, size_t k,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasCtbsv(layout, triangle, a_transpose, diagonal,
+                       n, k,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXtbsv<double2>(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n, size_t k,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasZtbsv(layout, triangle, a_transpose, diagonal,
+                       n, k,
+                       a_mat, a_offset, a_ld,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasStpsv, clblasDtpsv, clblasCtpsv, clblasZtpsv} with the arguments forwarded. The
+// precision is given as template argument, since there is no scalar argument to determine it.
+template <typename T>
+clblasStatus clblasXtpsv(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n,
+  const cl_mem ap_mat, size_t ap_offset,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events);
+template <> clblasStatus clblasXtpsv<float>(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n,
+  const cl_mem ap_mat, size_t ap_offset,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasStpsv(layout, triangle, a_transpose, diagonal,
+                       n,
+                       ap_mat, ap_offset,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXtpsv<double>(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n,
+  const cl_mem ap_mat, size_t ap_offset,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasDtpsv(layout, triangle, a_transpose, diagonal,
+                       n,
+                       ap_mat, ap_offset,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXtpsv<float2>(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n,
+  const cl_mem ap_mat, size_t ap_offset,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasCtpsv(layout, triangle, a_transpose, diagonal,
+                       n,
+                       ap_mat, ap_offset,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+template <> clblasStatus clblasXtpsv<double2>(
+  clblasOrder layout, clblasUplo triangle, clblasTranspose a_transpose, clblasDiag diagonal,
+  size_t n,
+  const cl_mem ap_mat, size_t ap_offset,
+  cl_mem x_vec, size_t x_offset, size_t x_inc,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasZtpsv(layout, triangle, a_transpose, diagonal,
+                       n,
+                       ap_mat, ap_offset,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasSger, clblasDger} with the arguments forwarded.
+clblasStatus clblasXger(
+  clblasOrder layout, size_t m, size_t n, float alpha,
   const cl_mem x_vec, size_t x_offset, size_t x_inc,
   const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
   cl_uint num_queues, cl_command_queue *queues,
   cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
-    return clblasSaxpy(n, alpha,
+    return clblasSger(layout, m, n, alpha,
+                      x_vec, x_offset, static_cast<int>(x_inc),
+                      y_vec, y_offset, static_cast<int>(y_inc),
+                      a_mat, a_offset, a_ld,
+                      num_queues, queues, num_wait_events, wait_events, events);
+}
+clblasStatus clblasXger(
+  clblasOrder layout, size_t m, size_t n, double alpha,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasDger(layout, m, n, alpha,
+                      x_vec, x_offset, static_cast<int>(x_inc),
+                      y_vec, y_offset, static_cast<int>(y_inc),
+                      a_mat, a_offset, a_ld,
+                      num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasCgeru, clblasZgeru} with the arguments forwarded.
+clblasStatus clblasXgeru(
+  clblasOrder layout, size_t m, size_t n, float2 alpha,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto cl_alpha = cl_float2{{alpha.real(), alpha.imag()}};
+    return clblasCgeru(layout, m, n, cl_alpha,
                        x_vec, x_offset, static_cast<int>(x_inc),
                        y_vec, y_offset, static_cast<int>(y_inc),
+                       a_mat, a_offset, a_ld,
                        num_queues, queues, num_wait_events, wait_events, events);
 }
-clblasStatus clblasXaxpy(
-  size_t n, double alpha,
+clblasStatus clblasXgeru(
+  clblasOrder layout, size_t m, size_t n, double2 alpha,
   const cl_mem x_vec, size_t x_offset, size_t x_inc,
   const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
   cl_uint num_queues, cl_command_queue *queues,
   cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
-    return clblasDaxpy(n, alpha,
+    auto cl_alpha = cl_double2{{alpha.real(), alpha.imag()}};
+    return clblasZgeru(layout, m, n, cl_alpha,
                        x_vec, x_offset, static_cast<int>(x_inc),
                        y_vec, y_offset, static_cast<int>(y_inc),
+                       a_mat, a_offset, a_ld,
                        num_queues, queues, num_wait_events, wait_events, events);
 }
-clblasStatus clblasXaxpy(
-  size_t n, float2 alpha,
+
+// Calls {clblasCgerc, clblasZgerc} with the arguments forwarded.
+clblasStatus clblasXgerc(
+  clblasOrder layout, size_t m, size_t n, float2 alpha,
   const cl_mem x_vec, size_t x_offset, size_t x_inc,
   const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
   cl_uint num_queues, cl_command_queue *queues,
   cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
     auto cl_alpha = cl_float2{{alpha.real(), alpha.imag()}};
-    return clblasCaxpy(n, cl_alpha,
+    return clblasCgerc(layout, m, n, cl_alpha,
                        x_vec, x_offset, static_cast<int>(x_inc),
                        y_vec, y_offset, static_cast<int>(y_inc),
+                       a_mat, a_offset, a_ld,
                        num_queues, queues, num_wait_events, wait_events, events);
 }
-clblasStatus clblasXaxpy(
-  size_t n, double2 alpha,
+clblasStatus clblasXgerc(
+  clblasOrder layout, size_t m, size_t n, double2 alpha,
   const cl_mem x_vec, size_t x_offset, size_t x_inc,
   const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
   cl_uint num_queues, cl_command_queue *queues,
   cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
     auto cl_alpha = cl_double2{{alpha.real(), alpha.imag()}};
-    return clblasZaxpy(n, cl_alpha,
+    return clblasZgerc(layout, m, n, cl_alpha,
                        x_vec, x_offset, static_cast<int>(x_inc),
                        y_vec, y_offset, static_cast<int>(y_inc),
+                       a_mat, a_offset, a_ld,
                        num_queues, queues, num_wait_events, wait_events, events);
 }
 
-// =================================================================================================
-// BLAS level-2 (matrix-vector) routines
+// Calls {clblasSsyr, clblasDsyr} with the arguments forwarded.
+clblasStatus clblasXsyr(
+  clblasOrder layout, clblasUplo triangle, size_t n, float alpha,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasSsyr(layout, triangle, n, alpha,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       a_mat, a_offset, a_ld,
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+clblasStatus clblasXsyr(
+  clblasOrder layout, clblasUplo triangle, size_t n, double alpha,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasDsyr(layout, triangle, n, alpha,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       a_mat, a_offset, a_ld,
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
 
-// Calls {clblasSgemv, clblasDgemv, clblasCgemv, clblasZgemv} with the arguments forwarded.
-clblasStatus clblasXgemv(
-  clblasOrder layout, clblasTranspose a_transpose, size_t m, size_t n, float alpha,
+// Calls {clblasCher, clblasZher} with the arguments forwarded.
+clblasStatus clblasXher(
+  clblasOrder layout, clblasUplo triangle, size_t n, float alpha,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
   const cl_mem a_mat, size_t a_offset, size_t a_ld,
-  const cl_mem x_vec, size_t x_offset, size_t x_inc, float beta,
-  const cl_mem y_vec, size_t y_offset, size_t y_inc,
   cl_uint num_queues, cl_command_queue *queues,
   cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
-    return clblasSgemv(layout, a_transpose, m, n, alpha,
+    return clblasCher(layout, triangle, n, alpha,
+                       x_vec, x_offset, static_cast<int>(x_inc),
                        a_mat, a_offset, a_ld,
-                       x_vec, x_offset, static_cast<int>(x_inc), beta,
-                       y_vec, y_offset, static_cast<int>(y_inc),
                        num_queues, queues, num_wait_events, wait_events, events);
 }
-clblasStatus clblasXgemv(
-  clblasOrder layout, clblasTranspose a_transpose, size_t m, size_t n, double alpha,
+clblasStatus clblasXher(
+  clblasOrder layout, clblasUplo triangle, size_t n, double alpha,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
   const cl_mem a_mat, size_t a_offset, size_t a_ld,
-  const cl_mem x_vec, size_t x_offset, size_t x_inc, double beta,
-  const cl_mem y_vec, size_t y_offset, size_t y_inc,
   cl_uint num_queues, cl_command_queue *queues,
   cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
-    return clblasDgemv(layout, a_transpose, m, n, alpha,
+    return clblasZher(layout, triangle, n, alpha,
+                       x_vec, x_offset, static_cast<int>(x_inc),
                        a_mat, a_offset, a_ld,
-                       x_vec, x_offset, static_cast<int>(x_inc), beta,
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasSspr, clblasDspr} with the arguments forwarded.
+clblasStatus clblasXspr(
+  clblasOrder layout, clblasUplo triangle, size_t n, float alpha,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem ap_mat, size_t ap_offset,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasSspr(layout, triangle, n, alpha,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       ap_mat, ap_offset,
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+clblasStatus clblasXspr(
+  clblasOrder layout, clblasUplo triangle, size_t n, double alpha,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem ap_mat, size_t ap_offset,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasDspr(layout, triangle, n, alpha,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       ap_mat, ap_offset,
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasChpr, clblasZhpr} with the arguments forwarded.
+clblasStatus clblasXhpr(
+  clblasOrder layout, clblasUplo triangle, size_t n, float alpha,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem ap_mat, size_t ap_offset,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasChpr(layout, triangle, n, alpha,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       ap_mat, ap_offset,
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+clblasStatus clblasXhpr(
+  clblasOrder layout, clblasUplo triangle, size_t n, double alpha,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem ap_mat, size_t ap_offset,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasZhpr(layout, triangle, n, alpha,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       ap_mat, ap_offset,
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasSsyr2, clblasDsyr2} with the arguments forwarded.
+clblasStatus clblasXsyr2(
+  clblasOrder layout, clblasUplo triangle, size_t n, float alpha,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasSsyr2(layout, triangle, n, alpha,
+                       x_vec, x_offset, static_cast<int>(x_inc),
                        y_vec, y_offset, static_cast<int>(y_inc),
+                       a_mat, a_offset, a_ld,
                        num_queues, queues, num_wait_events, wait_events, events);
 }
-clblasStatus clblasXgemv(
-  clblasOrder layout, clblasTranspose a_transpose, size_t m, size_t n, float2 alpha,
+clblasStatus clblasXsyr2(
+  clblasOrder layout, clblasUplo triangle, size_t n, double alpha,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
+  const cl_mem y_vec, size_t y_offset, size_t y_inc,
   const cl_mem a_mat, size_t a_offset, size_t a_ld,
-  const cl_mem x_vec, size_t x_offset, size_t x_inc, float2 beta,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    return clblasDsyr2(layout, triangle, n, alpha,
+                       x_vec, x_offset, static_cast<int>(x_inc),
+                       y_vec, y_offset, static_cast<int>(y_inc),
+                       a_mat, a_offset, a_ld,
+                       num_queues, queues, num_wait_events, wait_events, events);
+}
+
+// Calls {clblasCher2, clblasZher2} with the arguments forwarded.
+clblasStatus clblasXher2(
+  clblasOrder layout, clblasUplo triangle, size_t n, float2 alpha,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
   const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
   cl_uint num_queues, cl_command_queue *queues,
   cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
     auto cl_alpha = cl_float2{{alpha.real(), alpha.imag()}};
-    auto cl_beta = cl_float2{{beta.real(), beta.imag()}};
-    return clblasCgemv(layout, a_transpose, m, n, cl_alpha,
-                       a_mat, a_offset, a_ld,
-                       x_vec, x_offset, static_cast<int>(x_inc), cl_beta,
+    return clblasCher2(layout, triangle, n, cl_alpha,
+                       x_vec, x_offset, static_cast<int>(x_inc),
                        y_vec, y_offset, static_cast<int>(y_inc),
+                       a_mat, a_offset, a_ld,
                        num_queues, queues, num_wait_events, wait_events, events);
 }
-clblasStatus clblasXgemv(
-  clblasOrder layout, clblasTranspose a_transpose, size_t m, size_t n, double2 alpha,
-  const cl_mem a_mat, size_t a_offset, size_t a_ld,
-  const cl_mem x_vec, size_t x_offset, size_t x_inc, double2 beta,
+clblasStatus clblasXher2(
+  clblasOrder layout, clblasUplo triangle, size_t n, double2 alpha,
+  const cl_mem x_vec, size_t x_offset, size_t x_inc,
   const cl_mem y_vec, size_t y_offset, size_t y_inc,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
   cl_uint num_queues, cl_command_queue *queues,
   cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
     auto cl_alpha = cl_double2{{alpha.real(), alpha.imag()}};
-    auto cl_beta = cl_double2{{beta.real(), beta.imag()}};
-    return clblasZgemv(layout, a_transpose, m, n, cl_alpha,
-                       a_mat, a_offset, a_ld,
-                       x_vec, x_offset, static_cast<int>(x_inc), cl_beta,
+    return clblasZher2(layout, triangle, n, cl_alpha,
+                       x_vec, x_offset, static_cast<int>(x_inc),
                        y_vec, y_offset, static_cast<int>(y_inc),
+                       a_mat, a_offset, a_ld,
                        num_queues, queues, num_wait_events, wait_events, events);
 }
 
@@ -200,6 +1908,26 @@ clblasStatus clblasXgemm(
                        c_mat, c_offset, c_ld,
                        num_queues, queues, num_wait_events, wait_events, events);
 }
+clblasStatus clblasXgemm(
+  clblasOrder layout, clblasTranspose a_transpose, clblasTranspose b_transpose,
+  size_t m, size_t n, size_t k, half alpha,
+  const cl_mem a_mat, size_t a_offset, size_t a_ld,
+  const cl_mem b_mat, size_t b_offset, size_t b_ld, half beta,
+  const cl_mem c_mat, size_t c_offset, size_t c_ld,
+  cl_uint num_queues, cl_command_queue *queues,
+  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+    auto a_float = HalfToFloatBuffer(a_mat, queues[0]);
+    auto b_float = HalfToFloatBuffer(b_mat, queues[0]);
+    auto c_float = HalfToFloatBuffer(c_mat, queues[0]);
+    auto status = clblasXgemm(layout, a_transpose, b_transpose,
+                              m, n, k, HalfToFloat(alpha),
+                              a_float(), a_offset, a_ld,
+                              b_float(), b_offset, b_ld, HalfToFloat(beta),
+                              c_float(), c_offset, c_ld,
+                              num_queues, queues, num_wait_events, wait_events, events);
+    if (status == clblasSuccess) { FloatToHalfBuffer(c_mat, c_float, queues[0]); }
+    return status;
+}
 
 // This calls {clblasSsymm, clblasDsymm, clblasCsymm, clblasZsymm} with the arguments forwarded.
 clblasStatus clblasXsymm(